@@ -15,8 +15,66 @@ import networks.core.socket;
 
 import iocp_service_mode;
 
+// 서버 실행 인자. 스레딩 모델 — Shared(완료 포트 1개 공유) / Sharded(코어당 shard, 세션 코어 고정). IOCPServiceMode 참고.
+//   --threading <shared|sharded>  (기본 shared)
+//   --shards <n>                  Sharded shard 수 (기본 0 = 논리 프로세서 수)
+// 나머지 인자 (--install / --run ...) 는 그대로 ServiceMode::Execute 로 넘긴다.
+struct ServerArgs
+{
+    EServerThreadingModel ThreadingModel = EServerThreadingModel::Shared;
+    unsigned int ShardCount = 0;
+    std::vector<const char*> ServiceArgs;
+    std::string Error;
+
+    static ServerArgs Parse(int argc, const char* argv[])
+    {
+        ServerArgs args;
+        for (int i = 0; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            if (i > 0 && arg == "--threading" && i + 1 < argc)
+            {
+                const std::string_view value = argv[++i];
+                if (value == "shared")
+                {
+                    args.ThreadingModel = EServerThreadingModel::Shared;
+                }
+                else if (value == "sharded")
+                {
+                    args.ThreadingModel = EServerThreadingModel::Sharded;
+                }
+                else
+                {
+                    args.Error = std::format("Unknown threading model : {} (shared | sharded)", value);
+                }
+            }
+            else if (i > 0 && arg == "--shards" && i + 1 < argc)
+            {
+                const std::string_view value = argv[++i];
+                const auto [pEnd, ec] = std::from_chars(value.data(), value.data() + value.size(), args.ShardCount);
+                if (std::errc{} != ec || value.data() + value.size() != pEnd)
+                {
+                    args.Error = std::format("Invalid shard count : {}", value);
+                }
+            }
+            else
+            {
+                args.ServiceArgs.push_back(argv[i]);
+            }
+        }
+        return args;
+    }
+};
+
 int main(int argc, const char* argv[])
 {
+    ServerArgs serverArgs = ServerArgs::Parse(argc, argv);
+    if (!serverArgs.Error.empty())
+    {
+        std::cerr << serverArgs.Error << std::endl;
+        return 1;
+    }
+
     std::string location = std::filesystem::current_path().string();
 
     // 1. 로거 및 기본 환경 설정
@@ -30,16 +88,18 @@ int main(int argc, const char* argv[])
 
     auto& logger = LibCommons::Logger::GetInstance();
     logger.Create(location + "/" + "loggers", fileName, 1024 * 1024 * 10, 3, bServiceMode);
+    // 워커 스레드의 로그는 인자 복사만 — 포맷 / 파일 기록은 로거 스레드.
+    logger.EnableAsyncBackend();
 
     LibNetworks::Core::Socket::Initialize();
     LibCommons::EventListener::GetInstance().Init(std::thread::hardware_concurrency());
 
     // 2. IOCP 서비스 생성 및 실행
-    auto pService = std::make_shared<IOCPServiceMode>();
+    auto pService = std::make_shared<IOCPServiceMode>(serverArgs.ThreadingModel, serverArgs.ShardCount);
 
-    logger.LogInfo("Main", "FastPortServer Starting (IOCP mode)...");
+    logger.LogInfo("Main", "FastPortServer Starting (IOCP mode, {} threading)...", EServerThreadingModel::Sharded == serverArgs.ThreadingModel ? "sharded" : "shared");
 
-    pService->Execute(static_cast<DWORD>(argc), argv);
+    pService->Execute(static_cast<DWORD>(serverArgs.ServiceArgs.size()), serverArgs.ServiceArgs.data());
 
 #if _DEBUG
     pService->Wait();
@@ -11,11 +11,11 @@
 
 module iocp_inbound_session;
 import commons.logger;
-import commons.container;
 import commons.singleton;
 import networks.admin.admin_packet_handler;
-
-using SessionContainer = LibCommons::Container<uint64_t, std::shared_ptr<LibNetworks::Sessions::InboundSession>>;
+import networks.core.packet_dispatcher;
+import networks.sessions.idle_checker;
+import iocp_session_registry;
 
 // IOCPServiceMode.cpp 에서 정의한 전역 AdminPacketHandler 액세스 (동일 exe 내).
 LibNetworks::Admin::AdminPacketHandler* GetGlobalIOCPAdminHandler() noexcept;
@@ -35,10 +35,22 @@ namespace
     }
 }
 
+struct IOCPInboundSession::PacketTable
+{
+    using Dispatcher = LibNetworks::Core::PacketDispatcher<IOCPInboundSession,
+        LibNetworks::Core::PacketHandler<PACKET_ID_BENCHMARK_REQUEST, ::fastport::protocols::benchmark::BenchmarkRequest, &IOCPInboundSession::HandleBenchmarkRequest>,
+        LibNetworks::Core::PacketHandler<PACKET_ID_ECHO_REQUEST, ::fastport::protocols::tests::EchoRequest, &IOCPInboundSession::HandleEchoRequest>,
+        LibNetworks::Core::RawPacketHandler<LibNetworks::Admin::kPacketId_SummaryRequest, &IOCPInboundSession::HandleAdminPacket>,
+        LibNetworks::Core::RawPacketHandler<LibNetworks::Admin::kPacketId_SessionListReq, &IOCPInboundSession::HandleAdminPacket>,
+        LibNetworks::Core::RawPacketHandler<LibNetworks::Admin::kPacketId_LogSuppressionReq, &IOCPInboundSession::HandleAdminPacket>>;
+};
+
 IOCPInboundSession::IOCPInboundSession(const std::shared_ptr<LibNetworks::Core::Socket>& pSocket,
     std::unique_ptr<LibCommons::Buffers::IBuffer> pReceiveBuffer,
-    std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer)
+    std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer,
+    std::uint32_t shardIndex)
     : LibNetworks::Sessions::InboundSession(pSocket, std::move(pReceiveBuffer), std::move(pSendBuffer))
+    , m_ShardIndex(shardIndex)
 {
 
 }
@@ -48,10 +60,22 @@ IOCPInboundSession::~IOCPInboundSession()
     LibCommons::Logger::GetInstance().LogInfo("IOCPInboundSession", "Destructor called. Session Id : {}", GetSessionId());
 }
 
+void IOCPInboundSession::ResetForReuse(const std::shared_ptr<LibNetworks::Core::Socket>& pSocket, std::uint32_t shardIndex)
+{
+    m_ShardIndex = shardIndex;
+    IOSession::ResetForReuse(pSocket);
+}
+
 void IOCPInboundSession::OnAccepted()
 {
-    auto& sessions = LibCommons::SingleTon<SessionContainer>::GetInstance();
-    sessions.Add(GetSessionId(), std::dynamic_pointer_cast<IOCPInboundSession>(shared_from_this()));
+    auto& registry = LibCommons::SingleTon<IOCPSessionRegistry>::GetInstance();
+    registry.GetShard(m_ShardIndex).Add(GetSessionId(), std::dynamic_pointer_cast<IOCPInboundSession>(shared_from_this()));
+
+    // idle 검사는 deadline 추적 — 수신 경로는 lastRecv 갱신만, 등록은 여기서 1회.
+    if (auto const& pIdleChecker = registry.GetIdleChecker(m_ShardIndex))
+    {
+        pIdleChecker->Track(shared_from_this());
+    }
 
     __super::OnAccepted();
 }
@@ -60,58 +84,51 @@ void IOCPInboundSession::OnDisconnected()
 {
     __super::OnDisconnected();
 
-    auto& sessions = LibCommons::SingleTon<SessionContainer>::GetInstance();
+    auto& sessions = LibCommons::SingleTon<IOCPSessionRegistry>::GetInstance().GetShard(m_ShardIndex);
     sessions.Remove(GetSessionId());
 
-	LibCommons::Logger::GetInstance().LogInfo("IOCPInboundSession", "Session disconnected. Session Id : {}, Sessions Count : {}", GetSessionId(), sessions.Size());
+	LibCommons::Logger::GetInstance().LogInfo("IOCPInboundSession", "Session disconnected. Session Id : {}, Shard : {}, Shard Sessions Count : {}", GetSessionId(), m_ShardIndex, sessions.Size());
 }
 
-void IOCPInboundSession::OnPacketReceived(const LibNetworks::Core::Packet& rfPacket)
+void IOCPInboundSession::OnPacketViewReceived(const LibNetworks::Core::PacketView& rfView)
 {
-    __super::OnPacketReceived(rfPacket);
-
-    const auto packetId = rfPacket.GetPacketId();
+    if (!PacketTable::Dispatcher::Dispatch(*this, rfView))
+    {
+        LibCommons::Logger::GetInstance().LogWarning("IOCPInboundSession", "OnPacketViewReceived, Unknown packet id : {}. Session Id : {}", rfView.GetPacketId(), GetSessionId());
+    }
+}
 
-    // Design Ref: server-status §4.4 — Admin 패킷(0x8xxx) dispatch.
-    if (LibNetworks::Admin::IsAdminPacketId(packetId))
+void IOCPInboundSession::LogPacketStats()
+{
+    for (const auto& stats : PacketTable::Dispatcher::Snapshot())
     {
-        if (auto* pAdmin = GetGlobalIOCPAdminHandler())
+        if (stats.CallCount == 0)
         {
-            if (pAdmin->HandlePacket(*this, rfPacket)) return;
+            continue;
         }
-        LibCommons::Logger::GetInstance().LogWarning("IOCPInboundSession",
-            "Admin packet {:#06x} received but handler unavailable. Session Id : {}",
-            packetId, GetSessionId());
-        return;
+
+        LibCommons::Logger::GetInstance().LogInfo("IOCPInboundSession",
+            "Packet stats. Packet Id : {:#06x}, Calls : {}, ParseFailures : {}, HandlerUs : {}",
+            stats.PacketId, stats.CallCount, stats.ParseFailureCount, stats.DescribeTimeBuckets());
     }
+}
 
-    switch (packetId)
+void IOCPInboundSession::HandleAdminPacket(const LibNetworks::Core::PacketView& rfView)
+{
+    // Design Ref: server-status §4.4 — Admin 패킷(0x8xxx) dispatch.
+    if (auto* pAdmin = GetGlobalIOCPAdminHandler())
     {
-    case PACKET_ID_BENCHMARK_REQUEST:
-        HandleBenchmarkRequest(rfPacket);
-        break;
-
-    case PACKET_ID_ECHO_REQUEST:
-        HandleEchoRequest(rfPacket);
-        break;
-    default:
-        LibCommons::Logger::GetInstance().LogWarning("IOCPInboundSession", "OnPacketReceived, Unknown packet id : {}. Session Id : {}", packetId, GetSessionId());
-        break;
+        if (pAdmin->HandlePacket(*this, rfView)) return;
     }
+    LibCommons::Logger::GetInstance().LogWarning("IOCPInboundSession",
+        "Admin packet {:#06x} received but handler unavailable. Session Id : {}",
+        rfView.GetPacketId(), GetSessionId());
 }
 
-void IOCPInboundSession::HandleBenchmarkRequest(const LibNetworks::Core::Packet& rfPacket)
+void IOCPInboundSession::HandleBenchmarkRequest(const ::fastport::protocols::benchmark::BenchmarkRequest& request)
 {
     uint64_t recvTimestamp = GetCurrentTimeNs();
 
-    ::fastport::protocols::benchmark::BenchmarkRequest request;
-    if (!rfPacket.ParseMessage(request))
-    {
-        LibCommons::Logger::GetInstance().LogError("IOCPInboundSession", 
-            "HandleBenchmarkRequest, Failed to parse. Session Id : {}", GetSessionId());
-        return;
-    }
-
     ::fastport::protocols::benchmark::BenchmarkResponse response;
     
     auto pHeader = response.mutable_header();
@@ -128,20 +145,12 @@ void IOCPInboundSession::HandleBenchmarkRequest(const LibNetworks::Core::Packet&
     SendMessage(PACKET_ID_BENCHMARK_RESPONSE, response);
 }
 
-void IOCPInboundSession::HandleEchoRequest(const LibNetworks::Core::Packet& rfPacket)
+void IOCPInboundSession::HandleEchoRequest(const ::fastport::protocols::tests::EchoRequest& request)
 {
-    const auto packetId = rfPacket.GetPacketId();
+    const auto packetId = PACKET_ID_ECHO_REQUEST;
 
     LibCommons::Logger::GetInstance().LogInfo("IOCPInboundSession", 
-        "HandleEchoRequest. Session Id : {}, Data Length : {}", GetSessionId(), rfPacket.GetPacketSize());
-
-    ::fastport::protocols::tests::EchoRequest request;
-    if (!rfPacket.ParseMessage(request))
-    {
-        LibCommons::Logger::GetInstance().LogError("IOCPInboundSession", 
-            "HandleEchoRequest, Failed to parse. Session Id : {}, Packet Id : {}", GetSessionId(), packetId);
-        return;
-    }
+        "HandleEchoRequest. Session Id : {}, Data Length : {}", GetSessionId(), request.data_str().size());
 
     ::fastport::protocols::tests::EchoResponse response;
     auto pHeader = response.mutable_header();
@@ -161,3 +170,18 @@ void IOCPInboundSession::OnSent(size_t bytesSent)
 {
     __super::OnSent(bytesSent);
 }
+
+void IOCPInboundSession::OnSendBackpressure(bool bBackpressured)
+{
+    // 느린 클라이언트 감지 — 버릴 수 있는 트래픽은 TrySendMessage 로 보내 WouldBlock 시 생략한다.
+    if (bBackpressured)
+    {
+        LibCommons::Logger::GetInstance().LogWarning("IOCPInboundSession",
+            "Send backpressure on. Session Id : {}", GetSessionId());
+    }
+    else
+    {
+        LibCommons::Logger::GetInstance().LogInfo("IOCPInboundSession",
+            "Send backpressure off. Session Id : {}", GetSessionId());
+    }
+}
@@ -1,9 +1,14 @@
 module;
 
+#include <cstdint>
+#include <Protocols/Tests.pb.h>
+#include <Protocols/Benchmark.pb.h>
+
 export module iocp_inbound_session;
 import networks.sessions.inbound_session;
 import commons.buffers.ibuffer;
 import networks.core.packet;
+import networks.core.packet_view;
 
 export class IOCPInboundSession : public LibNetworks::Sessions::InboundSession
 {
@@ -14,19 +19,39 @@ public:
 
     explicit IOCPInboundSession(const std::shared_ptr<LibNetworks::Core::Socket>& pSocket,
         std::unique_ptr<LibCommons::Buffers::IBuffer> pReceiveBuffer,
-        std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer);
+        std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer,
+        std::uint32_t shardIndex = 0);
     virtual ~IOCPInboundSession() override; 
 
+    // 세션이 고정된 shard (IOCPSessionRegistry 컨테이너 선택). shared 모드는 0.
+    std::uint32_t GetShardIndex() const { return m_ShardIndex; }
+
+    // 세션 풀에서 꺼낸 세션을 새 소켓/shard 로 재사용.
+    void ResetForReuse(const std::shared_ptr<LibNetworks::Core::Socket>& pSocket, std::uint32_t shardIndex);
+
     void OnAccepted() override;
 
     void OnDisconnected() override;
 
+    // 패킷 ID 별 dispatch 통계 (호출 수 / 파싱 실패 / 핸들러 시간 분포) 로그.
+    static void LogPacketStats();
+
 protected:
-    void OnPacketReceived(const LibNetworks::Core::Packet& rfPacket) override;
+    void OnPacketViewReceived(const LibNetworks::Core::PacketView& rfView) override;
 
     void OnSent(size_t bytesSent) override;
 
+    void OnSendBackpressure(bool bBackpressured) override;
+
+private:
+    // 패킷 ID → 핸들러 표 (PacketDispatcher). private 핸들러 접근을 위해 중첩 타입으로 둔다.
+    struct PacketTable;
+
+    void HandleBenchmarkRequest(const ::fastport::protocols::benchmark::BenchmarkRequest& request);
+    void HandleEchoRequest(const ::fastport::protocols::tests::EchoRequest& request);
+    // Admin 패킷(0x8xxx) 은 AdminPacketHandler 로 위임.
+    void HandleAdminPacket(const LibNetworks::Core::PacketView& rfView);
+
 private:
-    void HandleBenchmarkRequest(const LibNetworks::Core::Packet& rfPacket);
-    void HandleEchoRequest(const LibNetworks::Core::Packet& rfPacket);
+    std::uint32_t m_ShardIndex = 0;
 };
\ No newline at end of file
@@ -9,19 +9,13 @@ module iocp_service_mode;
 
 import std;
 import commons.logger;
-import commons.container;                 // SessionContainer ForEach
-import commons.singleton;                  // SingleTon<SessionContainer>
+import commons.singleton;                  // SingleTon<IOCPSessionRegistry>
 import networks.sessions.inetwork_session;
 import networks.sessions.inbound_session;
+import networks.sessions.io_session;     // SetAdaptiveSendFlush
 import networks.sessions.iidle_aware;     // SnapshotProvider target
 import networks.sessions.isession_stats;  // server-status
-
-
-// Design Ref: session-idle-timeout §4.4 / server-status §4.2 — 활성 세션 전역 컨테이너.
-// IOCPInboundSession.cpp 와 동일 타입으로 같은 SingleTon 인스턴스 공유.
-using SessionContainer = LibCommons::Container<
-    uint64_t,
-    std::shared_ptr<LibNetworks::Sessions::InboundSession>>;
+import iocp_session_registry;             // shard 별 활성 세션 컨테이너 (IOCPInboundSession 과 공유)
 
 
 // Design Ref: server-status §4.4 — AdminPacketHandler 전역 액세스 포인트.
@@ -32,8 +26,83 @@ namespace
 std::atomic<LibNetworks::Admin::AdminPacketHandler*> g_pAdminHandler { nullptr };
 
 constexpr size_t kSessionBufferSize = 64 * 1024;
+
+// 세션 풀 free list 상한. 지연 부착 버퍼를 끄면 유휴 세션 1개가 송수신 버퍼 2개(kSessionBufferSize)를
+// 쥐고 있으므로 상한 × 128KB 만큼이 재사용 대기 메모리 상한이 된다.
+constexpr std::size_t kSessionPoolMaxIdle = 1024;
+
+// 지연 부착 버퍼 — 세션은 송수신 데이터가 남아 있는 동안에만 공유 풀에서 ring 을 빌린다.
+// zero-byte Recv 로 대기 중인 유휴 연결은 ring 을 하나도 들고 있지 않아, 세션당 상주 메모리가
+// 세션 수가 아니라 동시에 데이터가 오가는 세션 수에 비례한다.
+constexpr bool kLazySessionBuffers = true;
+
+// 반환된 ring 보관 상한 (송수신 각각). 초과분은 해제.
+constexpr std::size_t kRingPoolMaxIdle = 256;
+
 constexpr unsigned long kListenBacklog = 1024;
 constexpr unsigned int kInitialAcceptCount = 256;
+
+// Sharded 모드 shard 워커 코어 고정 여부. shard 수는 실행 인자로 받는다 (FastPortServer.cpp).
+constexpr bool kPinShardWorkers = true;
+
+// 세션 송수신 버퍼 구현 선택.
+// - Locked : CircleBufferQueue (RWLock, 다중 생산자/소비자 안전)
+// - SPSC     : SPSCCircleBufferQueue (lock-free, 생산자/소비자 각 1 스레드 전용)
+// - Mirrored : MirroredCircleBufferQueue (이중 매핑, 항상 단일 span → protobuf 제자리 직렬화)
+// - Segmented: SegmentedBuffer (SlabPool chunk 를 이어 붙여 상한까지 증가, 비면 chunk 반환)
+enum class ESessionBufferType
+{
+    Locked,
+    SPSC,
+    Mirrored,
+    Segmented,
+};
+
+// 수신 버퍼는 Recv 완료(CommitWrite) → ReadReceivedBuffers(Consume) 가 outstanding Recv 1개로
+// 직렬화되므로 SPSC 조건을 만족한다.
+// 송신 버퍼는 SendMessage 가 임의 스레드(로직/타이머/브로드캐스트)에서 호출되므로 락 기반인
+// Segmented 사용 — 버스트가 64KB 를 넘어도 상한까지 늘어나 연결을 끊지 않고, 비면 chunk 를 돌려준다.
+// chunk 크기 이하 패킷은 AllocateWrite 가 단일 span 이라 임시 string fallback 이 없다.
+constexpr ESessionBufferType kReceiveBufferType = ESessionBufferType::SPSC;
+constexpr ESessionBufferType kSendBufferType = ESessionBufferType::Segmented;
+
+// Segmented 버퍼 chunk 크기 (SlabPool size class) 와 세션당 증가 상한.
+constexpr size_t kSegmentChunkSize = 16 * 1024;
+constexpr size_t kSegmentedBufferMaxSize = 4 * 1024 * 1024;
+
+// 송신 watermark — 적재량이 high 이상이면 OnSendBackpressure(true), low 이하로 빠지면 (false).
+// high 이상에서 TrySendMessage 는 WouldBlock. 버퍼 상한 (kSegmentedBufferMaxSize) 보다 충분히 낮게 둔다.
+constexpr size_t kSendLowWatermark = 256 * 1024;
+constexpr size_t kSendHighWatermark = 1024 * 1024;
+
+// Adaptive send flush — 세션 송신율이 임계 이상이면 flush 를 워커 완료 배치 종료까지(최대 지연 상한) 미뤄
+// 여러 SendMessage 를 WSASend 1회로 합친다. 저부하 세션은 즉시 송신.
+constexpr std::chrono::microseconds kAdaptiveSendFlushMaxDelay { 50 };
+constexpr std::uint32_t kAdaptiveSendFlushPpsThreshold = 10'000;
+
+std::unique_ptr<LibCommons::Buffers::IBuffer> CreateSessionBuffer(ESessionBufferType type, size_t capacity)
+{
+    switch (type)
+    {
+    case ESessionBufferType::SPSC:
+        return std::make_unique<LibCommons::Buffers::SPSCCircleBufferQueue>(capacity);
+    case ESessionBufferType::Mirrored:
+    {
+        auto pBuffer = std::make_unique<LibCommons::Buffers::MirroredCircleBufferQueue>(capacity);
+        if (pBuffer->IsValid())
+        {
+            return pBuffer;
+        }
+        // 매핑 실패(주소 공간/커밋 한도) 시 일반 원형 버퍼로 대체.
+        return std::make_unique<LibCommons::Buffers::CircleBufferQueue>(capacity);
+    }
+    case ESessionBufferType::Segmented:
+        return std::make_unique<LibCommons::Buffers::SegmentedBuffer>(kSegmentChunkSize, (std::max)(capacity, kSegmentedBufferMaxSize));
+    case ESessionBufferType::Locked:
+    default:
+        return std::make_unique<LibCommons::Buffers::CircleBufferQueue>(capacity);
+    }
+}
 }
 
 // IOCPInboundSession.cpp 에서 extern 으로 선언/호출 (동일 exe 내 링크).
@@ -47,49 +116,115 @@ void IOCPServiceMode::OnStarted()
 {
     LibCommons::Logger::GetInstance().LogInfo("IOCPServiceMode", "Starting IOCP Mode...");
 
-    auto pOnFuncCreateSession = [](const std::shared_ptr<LibNetworks::Core::Socket>& pSocket) -> std::shared_ptr<LibNetworks::Sessions::INetworkSession>
+    LibNetworks::Sessions::IOSession::SetAdaptiveSendFlush(kAdaptiveSendFlushMaxDelay, kAdaptiveSendFlushPpsThreshold);
+    LibNetworks::Sessions::SendWatermark::SetDefaults(kSendLowWatermark, kSendHighWatermark);
+
+    auto& registry = LibCommons::SingleTon<IOCPSessionRegistry>::GetInstance();
+
+    const unsigned int shardCount = EServerThreadingModel::Sharded == m_ThreadingModel
+        ? (m_ShardCount > 0 ? m_ShardCount : (std::max)(std::thread::hardware_concurrency(), 1u))
+        : 1u;
+    registry.Configure(shardCount);
+
+    // 종료된 세션은 풀로 돌아가 다음 accept 에 재사용 — 세션 객체와 링 버퍼를 다시 할당하지 않는다.
+    // 세션 풀과 ring 풀은 shard 마다 1개 — shard 사이에 풀 mutex 를 공유하지 않고, 세션은 자기 shard 풀로만 돌아간다.
+    // 보관 상한은 shard 수로 나눠 전체 재사용 대기 메모리는 그대로 둔다.
+    const std::size_t sessionPoolMaxIdle = (std::max)(kSessionPoolMaxIdle / shardCount, std::size_t{ 1 });
+    const std::size_t ringPoolMaxIdle = (std::max)(kRingPoolMaxIdle / shardCount, std::size_t{ 1 });
+
+    for (unsigned int shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+    {
+        m_SessionPools.push_back(LibNetworks::Sessions::SessionPool<IOCPInboundSession>::Create(sessionPoolMaxIdle));
+
+        // Segmented 는 비면 스스로 chunk 를 반환하므로 ring 풀을 거치지 않는다.
+        if (kLazySessionBuffers && kReceiveBufferType != ESessionBufferType::Segmented)
         {
-            auto pReceiveBuffer = std::make_unique<LibCommons::Buffers::CircleBufferQueue>(kSessionBufferSize);
-            auto pSendBuffer = std::make_unique<LibCommons::Buffers::CircleBufferQueue>(kSessionBufferSize);
-            return std::make_shared<IOCPInboundSession>(pSocket, std::move(pReceiveBuffer), std::move(pSendBuffer));
-        };
+            m_ReceiveRingPools.push_back(std::make_shared<LibCommons::Buffers::RingBufferPool>(kSessionBufferSize,
+                [](size_t capacity) { return CreateSessionBuffer(kReceiveBufferType, capacity); }, ringPoolMaxIdle));
+        }
+        if (kLazySessionBuffers && kSendBufferType != ESessionBufferType::Segmented)
+        {
+            m_SendRingPools.push_back(std::make_shared<LibCommons::Buffers::RingBufferPool>(kSessionBufferSize,
+                [](size_t capacity) { return CreateSessionBuffer(kSendBufferType, capacity); }, ringPoolMaxIdle));
+        }
+    }
 
-    m_Acceptor = LibNetworks::Core::IOSocketAcceptor::Create(
-        LibNetworks::Core::Socket::ENetworkMode::IOCP,
-        m_ListenSocket,
-        pOnFuncCreateSession,
-        C_LISTEN_PORT,
-        kListenBacklog,
-        std::thread::hardware_concurrency() * 2,
-        kInitialAcceptCount);
-    m_bRunning = nullptr != m_Acceptor;
+    auto pOnFuncCreateSession = [sessionPools = m_SessionPools, receiveRingPools = m_ReceiveRingPools, sendRingPools = m_SendRingPools](const std::shared_ptr<LibNetworks::Core::Socket>& pSocket, std::uint32_t shardIndex) -> std::shared_ptr<LibNetworks::Sessions::INetworkSession>
+        {
+            const auto pReceiveRingPool = receiveRingPools.empty() ? nullptr : receiveRingPools[shardIndex];
+            const auto pSendRingPool = sendRingPools.empty() ? nullptr : sendRingPools[shardIndex];
+
+            return sessionPools[shardIndex]->Acquire(
+                [&pSocket, shardIndex, &pReceiveRingPool, &pSendRingPool]()
+                {
+                    std::unique_ptr<LibCommons::Buffers::IBuffer> pReceiveBuffer;
+                    if (pReceiveRingPool)
+                    {
+                        // 수신은 outstanding Recv 1개로 직렬화되므로 락 없이 ring 을 교체한다 (SPSC 경로 유지).
+                        pReceiveBuffer = std::make_unique<LibCommons::Buffers::LazyBuffer>(pReceiveRingPool, LibCommons::Buffers::ELazyRingAccess::Serialized);
+                    }
+                    else
+                    {
+                        pReceiveBuffer = CreateSessionBuffer(kReceiveBufferType, kSessionBufferSize);
+                    }
+
+                    std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer;
+                    if (pSendRingPool)
+                    {
+                        pSendBuffer = std::make_unique<LibCommons::Buffers::LazyBuffer>(pSendRingPool);
+                    }
+                    else
+                    {
+                        pSendBuffer = CreateSessionBuffer(kSendBufferType, kSessionBufferSize);
+                    }
+                    return std::make_unique<IOCPInboundSession>(pSocket, std::move(pReceiveBuffer), std::move(pSendBuffer), shardIndex);
+                },
+                [&pSocket, shardIndex](IOCPInboundSession& rfSession) { rfSession.ResetForReuse(pSocket, shardIndex); });
+        };
 
     using namespace std::chrono_literals;
 
-    // Design Ref: session-idle-timeout §4.4 — SessionIdleChecker.
+    // Design Ref: session-idle-timeout §4.4 — SessionIdleChecker. shard 마다 deadline 추적 모드 1개.
+    // 세션은 accept 시 자기 shard checker 에 Track — tick 은 deadline 이 도래한 세션만 검사한다.
+    // accept 가 시작되기 전에 registry 에 걸어 둔다.
     LibNetworks::Sessions::IdleCheckerConfig idleCfg;
     idleCfg.thresholdMs    = 60'000ms;
     idleCfg.tickIntervalMs = 1'000ms;
     idleCfg.enabled        = true;
 
-    auto idleSnapshotProvider = []()
-        -> std::vector<std::shared_ptr<LibNetworks::Sessions::IIdleAware>>
-        {
-            std::vector<std::shared_ptr<LibNetworks::Sessions::IIdleAware>> result;
-            auto& container = LibCommons::SingleTon<SessionContainer>::GetInstance();
-            container.ForEach(
-                [&result](uint64_t /*id*/, std::shared_ptr<LibNetworks::Sessions::InboundSession> const& pSession) {
-                    if (pSession) {
-                        result.push_back(
-                            std::static_pointer_cast<LibNetworks::Sessions::IIdleAware>(pSession));
-                    }
-                });
-            return result;
-        };
+    for (std::uint32_t shardIndex = 0; shardIndex < registry.GetShardCount(); ++shardIndex)
+    {
+        auto pIdleChecker = std::make_shared<LibNetworks::Sessions::SessionIdleChecker>(idleCfg);
+        pIdleChecker->Start();
+        registry.SetIdleChecker(shardIndex, pIdleChecker);
+        m_IdleCheckers.push_back(std::move(pIdleChecker));
+    }
 
-    m_IdleChecker = std::make_shared<LibNetworks::Sessions::SessionIdleChecker>(
-        idleCfg, std::move(idleSnapshotProvider));
-    m_IdleChecker->Start();
+    if (EServerThreadingModel::Sharded == m_ThreadingModel)
+    {
+        m_Acceptor = LibNetworks::Core::IOSocketAcceptor::CreateSharded(
+            m_ListenSocket,
+            pOnFuncCreateSession,
+            C_LISTEN_PORT,
+            kListenBacklog,
+            shardCount,
+            kInitialAcceptCount,
+            kPinShardWorkers ? std::optional<std::uint32_t>(0) : std::nullopt);
+
+        LibCommons::Logger::GetInstance().LogInfo("IOCPServiceMode", "Sharded threading model. Shard Count : {}", shardCount);
+    }
+    else
+    {
+        m_Acceptor = LibNetworks::Core::IOSocketAcceptor::Create(
+            LibNetworks::Core::Socket::ENetworkMode::IOCP,
+            m_ListenSocket,
+            [pOnFuncCreateSession](const std::shared_ptr<LibNetworks::Core::Socket>& pSocket) { return pOnFuncCreateSession(pSocket, 0); },
+            C_LISTEN_PORT,
+            kListenBacklog,
+            std::thread::hardware_concurrency() * 2,
+            kInitialAcceptCount);
+    }
+    m_bRunning = nullptr != m_Acceptor;
 
     // Design Ref: server-status §4 — Stats Sampler + Collector + Admin Handler.
     // 순서: Sampler Start → Collector 생성 (Sampler 캐시 사용) → Handler 생성 → 전역 등록.
@@ -103,8 +238,8 @@ void IOCPServiceMode::OnStarted()
         -> std::vector<std::shared_ptr<LibNetworks::Sessions::ISessionStats>>
         {
             std::vector<std::shared_ptr<LibNetworks::Sessions::ISessionStats>> result;
-            auto& container = LibCommons::SingleTon<SessionContainer>::GetInstance();
-            container.ForEach(
+            auto& registry = LibCommons::SingleTon<IOCPSessionRegistry>::GetInstance();
+            registry.ForEach(
                 [&result](uint64_t /*id*/, std::shared_ptr<LibNetworks::Sessions::InboundSession> const& pSession) {
                     if (pSession) {
                         result.push_back(
@@ -114,9 +249,14 @@ void IOCPServiceMode::OnStarted()
             return result;
         };
 
-    auto idleCountProvider = [pChecker = m_IdleChecker]() -> std::uint64_t
+    auto idleCountProvider = [checkers = m_IdleCheckers]() -> std::uint64_t
         {
-            return pChecker ? pChecker->GetDisconnectCount() : 0ULL;
+            std::uint64_t total = 0;
+            for (auto const& pChecker : checkers)
+            {
+                total += pChecker->GetDisconnectCount();
+            }
+            return total;
         };
 
     m_StatsCollector = std::make_shared<LibNetworks::Stats::ServerStatsCollector>(
@@ -136,11 +276,11 @@ void IOCPServiceMode::OnStopped()
     // 전역 핸들러 포인터를 먼저 null 로 set → 신규 admin 패킷 dispatch 차단.
     g_pAdminHandler.store(nullptr, std::memory_order_release);
 
-    if (m_IdleChecker)
+    for (auto& pIdleChecker : m_IdleCheckers)
     {
-        m_IdleChecker->Stop();
-        m_IdleChecker.reset();
+        pIdleChecker->Stop();
     }
+    m_IdleCheckers.clear();
 
     if (m_StatsSampler)
     {
@@ -152,6 +292,12 @@ void IOCPServiceMode::OnStopped()
     m_StatsCollector.reset();
     m_StatsSampler.reset();
 
+    IOCPInboundSession::LogPacketStats();
+    LogSessionPoolStats();
+    m_SessionPools.clear();
+    m_ReceiveRingPools.clear();
+    m_SendRingPools.clear();
+
     LibCommons::Logger::GetInstance().LogInfo("IOCPServiceMode", "Stopped.");
 }
 
@@ -160,11 +306,11 @@ void IOCPServiceMode::OnShutdown()
 {
     g_pAdminHandler.store(nullptr, std::memory_order_release);
 
-    if (m_IdleChecker)
+    for (auto& pIdleChecker : m_IdleCheckers)
     {
-        m_IdleChecker->Stop();
-        m_IdleChecker.reset();
+        pIdleChecker->Stop();
     }
+    m_IdleCheckers.clear();
 
     if (m_StatsSampler)
     {
@@ -180,4 +326,56 @@ void IOCPServiceMode::OnShutdown()
         m_Acceptor->Shutdown();
         m_Acceptor.reset();
     }
+
+    IOCPInboundSession::LogPacketStats();
+    LogSessionPoolStats();
+    m_SessionPools.clear();
+    m_ReceiveRingPools.clear();
+    m_SendRingPools.clear();
+}
+
+
+void IOCPServiceMode::LogSessionPoolStats() const
+{
+    if (m_SessionPools.empty())
+    {
+        return;
+    }
+
+    // shard 별 풀 합계.
+    LibNetworks::Sessions::SessionPoolStats stats;
+    for (const auto& pSessionPool : m_SessionPools)
+    {
+        const auto shardStats = pSessionPool->GetStats();
+        stats.Hits += shardStats.Hits;
+        stats.Misses += shardStats.Misses;
+        stats.Recycled += shardStats.Recycled;
+        stats.Discarded += shardStats.Discarded;
+        stats.Idle += shardStats.Idle;
+    }
+
+    const auto acquired = stats.Hits + stats.Misses;
+    LibCommons::Logger::GetInstance().LogInfo("IOCPServiceMode",
+        "SessionPool stats. Pools : {}, Hits : {}, Misses : {}, HitRate : {:.1f}%, Recycled : {}, Discarded : {}, Idle : {}",
+        m_SessionPools.size(), stats.Hits, stats.Misses, acquired > 0 ? stats.Hits * 100.0 / acquired : 0.0,
+        stats.Recycled, stats.Discarded, stats.Idle);
+
+    for (const auto& [pRingPools, pName] : { std::pair{ &m_ReceiveRingPools, "Recv" }, std::pair{ &m_SendRingPools, "Send" } })
+    {
+        if (pRingPools->empty())
+        {
+            continue;
+        }
+
+        std::size_t borrowed = 0;
+        std::size_t idle = 0;
+        for (const auto& pRingPool : *pRingPools)
+        {
+            borrowed += pRingPool->GetBorrowedCount();
+            idle += pRingPool->GetIdleCount();
+        }
+        LibCommons::Logger::GetInstance().LogInfo("IOCPServiceMode",
+            "RingBufferPool stats ({}). Pools : {}, Borrowed : {}, Idle : {}",
+            pName, pRingPools->size(), borrowed, idle);
+    }
 }
@@ -10,16 +10,34 @@ import commons.service_mode;
 import networks.core.socket;
 import networks.core.io_socket_acceptor;
 import networks.sessions.idle_checker;  // SessionIdleChecker
+import networks.sessions.session_pool;  // SessionPool
 import networks.stats.stats_sampler;
 import networks.stats.server_stats_collector;
 import networks.admin.admin_packet_handler;
 import iocp_inbound_session;
+import commons.buffers.ibuffer;
 import commons.buffers.circle_buffer_queue;
+import commons.buffers.spsc_circle_buffer_queue;
+import commons.buffers.mirrored_circle_buffer_queue;
+import commons.buffers.lazy_buffer;
+import commons.buffers.segmented_buffer;
+
+// 서버 스레딩 모델.
+// - Shared  : 완료 포트 1개를 hardware_concurrency()*2 워커가 공유. 세션 목록 / idle 타이머 1개.
+// - Sharded : 코어당 shard 1개 (완료 포트 + 코어 고정 워커 1개 + 세션 목록 + idle 타이머).
+//             세션은 수명 내내 한 shard 에만 머문다 — 세션 atomic / 컨테이너 락이 코어 사이를 오가지 않는다.
+export enum class EServerThreadingModel
+{
+    Shared,
+    Sharded,
+};
 
 export class IOCPServiceMode : public LibCommons::ServiceMode
 {
 public:
-    IOCPServiceMode() : ServiceMode(true, true, false) {}
+    // shardCount 는 Sharded 에서만 사용 (0 = 논리 프로세서 수).
+    explicit IOCPServiceMode(EServerThreadingModel threadingModel = EServerThreadingModel::Shared, unsigned int shardCount = 0)
+        : ServiceMode(true, true, false), m_ThreadingModel(threadingModel), m_ShardCount(shardCount) {}
 
 protected:
     void OnStarted() override;
@@ -30,14 +48,28 @@ protected:
     std::wstring GetDisplayName() override { return L"FastPortServer IOCP Service"; }
     const DWORD GetStartType() const override { return SERVICE_DEMAND_START; }
 
+private:
+    void LogSessionPoolStats() const;
+
 private:
     const unsigned short C_LISTEN_PORT = 6628;
     LibNetworks::Core::Socket m_ListenSocket{};
     std::shared_ptr<LibNetworks::Core::IOSocketAcceptor> m_Acceptor{};
 
-    // Design Ref: session-idle-timeout §4.4 — 세션 idle 감지.
+    const EServerThreadingModel m_ThreadingModel = EServerThreadingModel::Shared;
+    const unsigned int m_ShardCount = 0;
+
+    // Design Ref: session-idle-timeout §4.4 — 세션 idle 감지 (shard 마다 1개, shared 모드는 1개).
     // OnStarted 에서 생성/Start, OnStopped 또는 OnShutdown 에서 Stop.
-    std::shared_ptr<LibNetworks::Sessions::SessionIdleChecker> m_IdleChecker{};
+    std::vector<std::shared_ptr<LibNetworks::Sessions::SessionIdleChecker>> m_IdleCheckers{};
+
+    // 종료된 세션 재사용 풀 (세션 객체 + 송수신 링 버퍼). shard 마다 1개, shardIndex 로 접근.
+    // OnStarted 에서 생성, 종료 시 통계 로그 후 해제.
+    std::vector<std::shared_ptr<LibNetworks::Sessions::SessionPool<IOCPInboundSession>>> m_SessionPools{};
+
+    // 지연 부착 버퍼가 빌려 쓰는 송수신 ring 풀. shard 마다 1개 (kLazySessionBuffers 일 때만 생성, 아니면 비어 있음).
+    std::vector<std::shared_ptr<LibCommons::Buffers::RingBufferPool>> m_ReceiveRingPools{};
+    std::vector<std::shared_ptr<LibCommons::Buffers::RingBufferPool>> m_SendRingPools{};
 
     // Design Ref: server-status §4 — Admin 통계/샘플러/핸들러.
     std::shared_ptr<LibNetworks::Stats::StatsSampler>           m_StatsSampler{};
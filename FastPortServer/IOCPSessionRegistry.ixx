@@ -0,0 +1,85 @@
+﻿module;
+
+#include <cstdint>
+#include <memory>
+
+export module iocp_session_registry;
+
+import std;
+import commons.container;
+import networks.sessions.inbound_session;
+import networks.sessions.idle_checker;
+
+// IOCPInboundSession / IOCPServiceMode 가 공유하는 세션 컨테이너 타입.
+export using SessionContainer = LibCommons::Container<
+    std::uint64_t,
+    std::shared_ptr<LibNetworks::Sessions::InboundSession>>;
+
+/**
+ * IOCPSessionRegistry
+ * shard 별 활성 세션 목록 (SingleTon). shared 모드는 shard 1개 — 기존 전역 컨테이너와 동일.
+ *
+ * - sharded 모드에서 세션은 자기 shard 컨테이너만 Add/Remove → 락 경합과 캐시 라인 이동이 shard 안에 갇힌다.
+ * - ForEach / Size 는 전체 shard 를 순회 (통계용, 저빈도 경로).
+ * - shard 마다 deadline 추적 모드 idle checker 를 둘 수 있다 — 세션은 accept 시 자기 shard checker 에 Track.
+ * - Configure / SetIdleChecker 는 accept 시작 전에 호출. 이후 shard 수와 checker 는 바뀌지 않는다.
+ */
+export class IOCPSessionRegistry
+{
+public:
+    IOCPSessionRegistry() { Configure(1); }
+
+    IOCPSessionRegistry(const IOCPSessionRegistry&) = delete;
+    IOCPSessionRegistry& operator=(const IOCPSessionRegistry&) = delete;
+
+    void Configure(std::uint32_t shardCount)
+    {
+        m_Shards.clear();
+        m_Shards.reserve((std::max)(shardCount, 1u));
+        for (std::uint32_t i = 0; i < (std::max)(shardCount, 1u); ++i)
+        {
+            m_Shards.push_back(std::make_unique<SessionContainer>());
+        }
+        m_IdleCheckers.assign(m_Shards.size(), nullptr);
+    }
+
+    void SetIdleChecker(std::uint32_t shardIndex, std::shared_ptr<LibNetworks::Sessions::SessionIdleChecker> pIdleChecker)
+    {
+        m_IdleCheckers[shardIndex % m_IdleCheckers.size()] = std::move(pIdleChecker);
+    }
+
+    // shard 의 idle checker (없으면 nullptr).
+    const std::shared_ptr<LibNetworks::Sessions::SessionIdleChecker>& GetIdleChecker(std::uint32_t shardIndex) const
+    {
+        return m_IdleCheckers[shardIndex % m_IdleCheckers.size()];
+    }
+
+    std::uint32_t GetShardCount() const { return static_cast<std::uint32_t>(m_Shards.size()); }
+
+    SessionContainer& GetShard(std::uint32_t shardIndex) { return *m_Shards[shardIndex % m_Shards.size()]; }
+    const SessionContainer& GetShard(std::uint32_t shardIndex) const { return *m_Shards[shardIndex % m_Shards.size()]; }
+
+    // shard 순서대로 각 컨테이너의 ForEach (콜백 제약은 Container::ForEach 와 동일).
+    template<typename Fn>
+    void ForEach(Fn&& fn) const
+    {
+        for (auto const& pShard : m_Shards)
+        {
+            pShard->ForEach(fn);
+        }
+    }
+
+    std::size_t Size() const
+    {
+        std::size_t total = 0;
+        for (auto const& pShard : m_Shards)
+        {
+            total += pShard->Size();
+        }
+        return total;
+    }
+
+private:
+    std::vector<std::unique_ptr<SessionContainer>> m_Shards;
+    std::vector<std::shared_ptr<LibNetworks::Sessions::SessionIdleChecker>> m_IdleCheckers;
+};
@@ -50,6 +50,8 @@ int main(int argc, const char* argv[])
 
     auto& logger = LibCommons::Logger::GetInstance();
     logger.Create(location + "/" + "loggers", fileName, 1024 * 1024 * 10, 3, bServiceMode);
+    // 완료 처리 경로의 로그는 인자 복사만 — 포맷 / 파일 기록은 로거 스레드.
+    logger.EnableAsyncBackend();
 
     // 2) 네트워크 전역 초기화 (WSAStartup 등) + 이벤트 리스너 스레드 풀 준비.
     LibNetworks::Core::Socket::Initialize();
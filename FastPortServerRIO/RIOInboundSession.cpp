@@ -20,6 +20,7 @@ import commons.logger;
 import commons.container;
 import commons.singleton;
 import networks.admin.admin_packet_handler;
+import networks.core.packet_dispatcher;
 
 
 // RIOServiceMode.cpp 의 전역 핸들러 액세스.
@@ -54,6 +55,18 @@ uint64_t GetCurrentTimeNs()
 } // anonymous namespace
 
 
+// 신규 패킷은 여기에 핸들러 추가 — 메시지 파싱/통계는 PacketDispatcher 가 담당.
+struct RIOInboundSession::PacketTable
+{
+    using Dispatcher = LibNetworks::Core::PacketDispatcher<RIOInboundSession,
+        LibNetworks::Core::PacketHandler<PACKET_ID_BENCHMARK_REQUEST, ::fastport::protocols::benchmark::BenchmarkRequest, &RIOInboundSession::HandleBenchmarkRequest>,
+        LibNetworks::Core::PacketHandler<PACKET_ID_ECHO_REQUEST, ::fastport::protocols::tests::EchoRequest, &RIOInboundSession::HandleEchoRequest>,
+        LibNetworks::Core::RawPacketHandler<LibNetworks::Admin::kPacketId_SummaryRequest, &RIOInboundSession::HandleAdminPacket>,
+        LibNetworks::Core::RawPacketHandler<LibNetworks::Admin::kPacketId_SessionListReq, &RIOInboundSession::HandleAdminPacket>,
+        LibNetworks::Core::RawPacketHandler<LibNetworks::Admin::kPacketId_LogSuppressionReq, &RIOInboundSession::HandleAdminPacket>>;
+};
+
+
 RIOInboundSession::RIOInboundSession(const std::shared_ptr<LibNetworks::Core::Socket>& pSocket,
                                      const LibNetworks::Core::RioBufferSlice& recvSlice,
                                      const LibNetworks::Core::RioBufferSlice& sendSlice,
@@ -97,58 +110,51 @@ void RIOInboundSession::OnDisconnected()
 }
 
 
-void RIOInboundSession::OnPacketReceived(const LibNetworks::Core::Packet& rfPacket)
+void RIOInboundSession::OnPacketViewReceived(const LibNetworks::Core::PacketView& rfView)
 {
-    __super::OnPacketReceived(rfPacket);
+    if (!PacketTable::Dispatcher::Dispatch(*this, rfView))
+    {
+        // 알 수 없는 패킷은 로그만 — 클라이언트 연결을 끊지 않는 보수적 정책.
+        // 악의적 패킷 공격 대응이 필요하면 추후 임계치/연결 종료 로직 추가.
+        LibCommons::Logger::GetInstance().LogWarning("RIOInboundSession", "OnPacketViewReceived, Unknown packet id : {}. Session Id : {}", rfView.GetPacketId(), GetSessionId());
+    }
+}
 
-    // 패킷 ID 기반 dispatch. 신규 패킷 추가 시 여기에 case 확장.
-    const auto packetId = rfPacket.GetPacketId();
 
-    // Design Ref: server-status §4.4 — Admin 패킷(0x8xxx) dispatch.
-    if (LibNetworks::Admin::IsAdminPacketId(packetId))
+void RIOInboundSession::LogPacketStats()
+{
+    for (const auto& stats : PacketTable::Dispatcher::Snapshot())
     {
-        if (auto* pAdmin = GetGlobalRIOAdminHandler())
+        if (stats.CallCount == 0)
         {
-            if (pAdmin->HandlePacket(*this, rfPacket)) return;
+            continue;
         }
-        LibCommons::Logger::GetInstance().LogWarning("RIOInboundSession",
-            "Admin packet {:#06x} received but handler unavailable. Session Id : {}",
-            packetId, GetSessionId());
-        return;
-    }
 
-    switch (packetId)
-    {
-    case PACKET_ID_BENCHMARK_REQUEST:
-        HandleBenchmarkRequest(rfPacket);
-        break;
+        LibCommons::Logger::GetInstance().LogInfo("RIOInboundSession",
+            "Packet stats. Packet Id : {:#06x}, Calls : {}, ParseFailures : {}, HandlerUs : {}",
+            stats.PacketId, stats.CallCount, stats.ParseFailureCount, stats.DescribeTimeBuckets());
+    }
+}
 
-    case PACKET_ID_ECHO_REQUEST:
-        HandleEchoRequest(rfPacket);
-        break;
 
-    default:
-        // 알 수 없는 패킷은 로그만 — 클라이언트 연결을 끊지 않는 보수적 정책.
-        // 악의적 패킷 공격 대응이 필요하면 추후 임계치/연결 종료 로직 추가.
-        LibCommons::Logger::GetInstance().LogWarning("RIOInboundSession", "OnPacketReceived, Unknown packet id : {}. Session Id : {}", packetId, GetSessionId());
-        break;
+void RIOInboundSession::HandleAdminPacket(const LibNetworks::Core::PacketView& rfView)
+{
+    // Design Ref: server-status §4.4 — Admin 패킷(0x8xxx) dispatch.
+    if (auto* pAdmin = GetGlobalRIOAdminHandler())
+    {
+        if (pAdmin->HandlePacket(*this, rfView)) return;
     }
+    LibCommons::Logger::GetInstance().LogWarning("RIOInboundSession",
+        "Admin packet {:#06x} received but handler unavailable. Session Id : {}",
+        rfView.GetPacketId(), GetSessionId());
 }
 
 
-void RIOInboundSession::HandleBenchmarkRequest(const LibNetworks::Core::Packet& rfPacket)
+void RIOInboundSession::HandleBenchmarkRequest(const ::fastport::protocols::benchmark::BenchmarkRequest& request)
 {
     // 서버 측 수신 타임스탬프 — 네트워크 왕복 레이턴시 분해용.
     uint64_t recvTimestamp = GetCurrentTimeNs();
 
-    ::fastport::protocols::benchmark::BenchmarkRequest request;
-    if (!rfPacket.ParseMessage(request))
-    {
-        LibCommons::Logger::GetInstance().LogError("RIOInboundSession",
-            "HandleBenchmarkRequest, Failed to parse. Session Id : {}", GetSessionId());
-        return;
-    }
-
     // 응답 패킷 구성.
     ::fastport::protocols::benchmark::BenchmarkResponse response;
 
@@ -176,18 +182,11 @@ void RIOInboundSession::HandleBenchmarkRequest(const LibNetworks::Core::Packet&
 }
 
 
-void RIOInboundSession::HandleEchoRequest(const LibNetworks::Core::Packet& rfPacket)
+void RIOInboundSession::HandleEchoRequest(const ::fastport::protocols::tests::EchoRequest& request)
 {
-    const auto packetId = rfPacket.GetPacketId();
+    const auto packetId = PACKET_ID_ECHO_REQUEST;
 
-    LibCommons::Logger::GetInstance().LogInfo("RIOInboundSession", "HandleEchoRequest. Session Id : {}, Data Length : {}", GetSessionId(), rfPacket.GetPacketSize());
-
-    ::fastport::protocols::tests::EchoRequest request;
-    if (!rfPacket.ParseMessage(request))
-    {
-        LibCommons::Logger::GetInstance().LogError("RIOInboundSession", "HandleEchoRequest, Failed to parse. Session Id : {}, Packet Id : {}", GetSessionId(), packetId);
-        return;
-    }
+    LibCommons::Logger::GetInstance().LogInfo("RIOInboundSession", "HandleEchoRequest. Session Id : {}, Data Length : {}", GetSessionId(), request.data_str().size());
 
     // 에코 응답: request_id 에 +1 (ack 의미), 나머지는 그대로 반사.
     ::fastport::protocols::tests::EchoResponse response;
@@ -6,7 +6,7 @@
 //   - LibNetworks::Sessions::RIOSession 상속 → RIO 수신/송신 루프와 패킷 프레이밍
 //     기반 위에서 애플리케이션 레벨 패킷 핸들러(에코, 벤치마크)만 구현.
 //   - OnAccepted / OnDisconnected 시 전역 SessionContainer 에 등록·제거.
-//   - OnPacketReceived 에서 패킷 ID 기반 dispatch.
+//   - OnPacketViewReceived 에서 PacketDispatcher 로 패킷 ID 기반 dispatch (수신 버퍼 zero-copy 뷰).
 //
 // 지원 패킷:
 //   - ECHO_REQUEST       : 수신 데이터를 그대로 응답 (기능 검증용)
@@ -16,6 +16,8 @@ module;
 
 #include <WinSock2.h>
 #include <MSWSock.h>
+#include <Protocols/Tests.pb.h>
+#include <Protocols/Benchmark.pb.h>
 
 export module rio_inbound_session;
 
@@ -24,6 +26,7 @@ import commons.buffers.ibuffer;
 import networks.core.packet;
 // 동일 import 반복은 의도 없음. 추후 정리 가능.
 import networks.core.packet;
+import networks.core.packet_view;
 import networks.core.rio_buffer_manager;
 
 
@@ -52,14 +55,23 @@ public:
     // 세션 종료 → 컨테이너에서 제거.
     void OnDisconnected() override;
 
+    // 패킷 ID 별 dispatch 통계 (호출 수 / 파싱 실패 / 핸들러 시간 분포) 로그.
+    static void LogPacketStats();
+
 protected:
     // 패킷 프레이밍 완료 후 상위에서 호출되는 훅. 패킷 ID 로 dispatch.
-    void OnPacketReceived(const LibNetworks::Core::Packet& rfPacket) override;
+    void OnPacketViewReceived(const LibNetworks::Core::PacketView& rfView) override;
 
 private:
+    // 패킷 ID → 핸들러 표 (PacketDispatcher). private 핸들러 접근을 위해 중첩 타입으로 둔다.
+    struct PacketTable;
+
     // 벤치마크 요청 처리: 서버 수신/송신 타임스탬프 기록 후 동일 페이로드로 응답.
-    void HandleBenchmarkRequest(const LibNetworks::Core::Packet& rfPacket);
+    void HandleBenchmarkRequest(const ::fastport::protocols::benchmark::BenchmarkRequest& request);
 
     // 에코 요청 처리: 요청의 data_str 을 그대로 응답에 반영.
-    void HandleEchoRequest(const LibNetworks::Core::Packet& rfPacket);
+    void HandleEchoRequest(const ::fastport::protocols::tests::EchoRequest& request);
+
+    // Admin 패킷(0x8xxx) 은 AdminPacketHandler 로 위임.
+    void HandleAdminPacket(const LibNetworks::Core::PacketView& rfView);
 };
@@ -160,6 +160,8 @@ void RIOServiceMode::OnStopped()
     m_StatsCollector.reset();
     m_StatsSampler.reset();
 
+    RIOInboundSession::LogPacketStats();
+
     // RIO 루프 먼저 종료.
     if (m_RioService)
     {
@@ -186,4 +188,6 @@ void RIOServiceMode::OnShutdown()
         m_Acceptor->Shutdown();
         m_Acceptor.reset();
     }
+
+    RIOInboundSession::LogPacketStats();
 }
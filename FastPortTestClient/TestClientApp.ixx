@@ -477,6 +477,9 @@ private:
             ImGui::Text("Idle Disconnects  : %llu",
                 static_cast<unsigned long long>(summary.idle_disconnect_count()));
             ImGui::Text("Process Memory    : %s", FormatBytes(summary.process_memory_bytes()).c_str());
+            ImGui::Text("Session Buffers   : %s (%s / session)",
+                FormatBytes(summary.session_buffer_bytes()).c_str(),
+                FormatBytes(summary.bytes_per_session()).c_str());
             ImGui::Text("Process CPU       : %.2f %%", summary.process_cpu_percent());
             ImGui::Text("Server Timestamp  : %llu ms",
                 static_cast<unsigned long long>(summary.server_timestamp_ms()));
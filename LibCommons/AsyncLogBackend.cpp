@@ -0,0 +1,405 @@
+﻿module;
+
+#include <cstdint>
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/sink.h>
+
+module commons.async_log_backend;
+
+import std;
+
+namespace LibCommons
+{
+
+namespace
+{
+
+constexpr std::string_view kBackendCategory = "AsyncLog";
+
+// 백그라운드 스레드가 한 ring 에서 연속으로 꺼내는 record 수 (한 스레드가 다른 스레드를 굶기지 않도록).
+constexpr std::size_t kDrainBatch = 256;
+
+std::atomic<std::uint64_t> s_NextInstanceId{ 1 };
+
+} // namespace
+
+struct AsyncLogBackend::ThreadState
+{
+    std::uint64_t InstanceId = 0;
+    std::shared_ptr<ThreadRing> pRing;
+    std::unordered_map<std::string_view, std::uint16_t> Categories;  // 키는 m_CategoryNames 를 가리킨다
+
+    ~ThreadState()
+    {
+        if (pRing)
+        {
+            pRing->bRetired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+
+AsyncLogBackend::AsyncLogBackend(const AsyncLogOptions& rfOptions, std::vector<spdlog::sink_ptr> sinks, spdlog::level::level_enum minLevel)
+    : m_Options(rfOptions),
+      m_RingCapacity(std::bit_ceil((std::max)(rfOptions.RingCapacity, std::size_t{ 2 }))),
+      m_Sinks(std::move(sinks)),
+      m_MinLevel(minLevel),
+      m_InstanceId(s_NextInstanceId.fetch_add(1, std::memory_order_relaxed))
+{
+    // ID 0 은 백엔드 자신의 카테고리.
+    RegisterCategory(kBackendCategory);
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+    Stop();
+}
+
+void AsyncLogBackend::Start()
+{
+    if (m_bRunning.exchange(true))
+    {
+        return;
+    }
+
+    m_bStopRequested.store(false, std::memory_order_relaxed);
+    m_Thread = std::thread([this]() { Run(); });
+}
+
+void AsyncLogBackend::Stop()
+{
+    if (!m_bRunning.load())
+    {
+        return;
+    }
+
+    m_bStopRequested.store(true, std::memory_order_release);
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+    m_bRunning.store(false);
+}
+
+AsyncLogStats AsyncLogBackend::GetStats() const
+{
+    auto lock = std::lock_guard(m_RingsMutex);
+
+    AsyncLogStats stats = m_RetiredStats;
+    for (const auto& pRing : m_Rings)
+    {
+        stats.Enqueued += pRing->Enqueued.load(std::memory_order_relaxed);
+        stats.Dropped += pRing->Dropped.load(std::memory_order_relaxed);
+        stats.EagerFormatted += pRing->EagerFormatted.load(std::memory_order_relaxed);
+        stats.Spanned += pRing->Spanned.load(std::memory_order_relaxed);
+        stats.Truncated += pRing->Truncated.load(std::memory_order_relaxed);
+    }
+    stats.Written = m_Written.load(std::memory_order_relaxed);
+    stats.ThreadRings = m_Rings.size();
+    return stats;
+}
+
+AsyncLogBackend::ThreadState& AsyncLogBackend::GetThreadState()
+{
+    thread_local ThreadState t_State;
+    return t_State;
+}
+
+AsyncLogBackend::ThreadRing* AsyncLogBackend::GetThreadRing()
+{
+    auto& rfState = GetThreadState();
+    if (rfState.InstanceId == m_InstanceId)
+    {
+        return rfState.pRing.get();
+    }
+
+    // 처음 로그하는 스레드 (또는 다른 백엔드에서 넘어온 스레드) — ring 등록.
+    if (rfState.pRing)
+    {
+        rfState.pRing->bRetired.store(true, std::memory_order_release);
+    }
+
+    auto pRing = std::make_shared<ThreadRing>(m_RingCapacity, static_cast<std::uint32_t>(spdlog::details::os::thread_id()));
+    {
+        auto lock = std::lock_guard(m_RingsMutex);
+        m_Rings.push_back(pRing);
+    }
+
+    rfState.InstanceId = m_InstanceId;
+    rfState.pRing = std::move(pRing);
+    rfState.Categories.clear();
+    return rfState.pRing.get();
+}
+
+AsyncLogRecord* AsyncLogBackend::BeginRecord(ThreadRing& rfRing, std::size_t slots, std::uint16_t categoryId, spdlog::level::level_enum lvl)
+{
+    AsyncLogRecord* pRecord = rfRing.BeginWrite(slots);
+    if (!pRecord)
+    {
+        pRecord = WaitForSlot(rfRing, slots);
+        if (!pRecord)
+        {
+            return nullptr;
+        }
+    }
+
+    pRecord->Time = spdlog::log_clock::now();
+    pRecord->Level = static_cast<std::uint8_t>(lvl);
+    pRecord->CategoryId = categoryId;
+    pRecord->ExtraSlots = static_cast<std::uint8_t>(slots - 1);
+    return pRecord;
+}
+
+AsyncLogRecord* AsyncLogBackend::WaitForSlot(ThreadRing& rfRing, std::size_t slots)
+{
+    if (EAsyncLogOverflow::Block == m_Options.Overflow)
+    {
+        while (m_bRunning.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+            if (auto* pRecord = rfRing.BeginWrite(slots))
+            {
+                return pRecord;
+            }
+        }
+    }
+
+    rfRing.Dropped.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void AsyncLogBackend::WritePayload(ThreadRing& rfRing, const std::byte* pPayload, std::size_t size) noexcept
+{
+    const std::size_t head = rfRing.Head.load(std::memory_order_relaxed);
+
+    const std::size_t first = (std::min)(size, AsyncLogRecord::kDataCapacity);
+    std::memcpy(rfRing.pSlots[head & rfRing.Mask].Data.data(), pPayload, first);
+
+    // 뒤 칸은 record 헤더 없이 256B 전체를 payload 로 쓴다 (ring 끝에서는 앞으로 감긴다).
+    std::size_t offset = first;
+    for (std::size_t slot = head + 1; offset < size; ++slot)
+    {
+        const std::size_t bytes = (std::min)(size - offset, AsyncLogRecord::kSize);
+        std::memcpy(&rfRing.pSlots[slot & rfRing.Mask], pPayload + offset, bytes);
+        offset += bytes;
+    }
+}
+
+std::uint16_t AsyncLogBackend::ResolveCategory(std::string_view categoryName)
+{
+    auto& rfCategories = GetThreadState().Categories;
+    if (const auto it = rfCategories.find(categoryName); it != rfCategories.end())
+    {
+        return it->second;
+    }
+
+    const std::uint16_t categoryId = RegisterCategory(categoryName);
+    rfCategories.emplace(m_CategoryNames[categoryId], categoryId);
+    return categoryId;
+}
+
+std::uint16_t AsyncLogBackend::RegisterCategory(std::string_view categoryName)
+{
+    auto lock = std::lock_guard(m_CategoryMutex);
+
+    if (const auto it = m_CategoryIds.find(std::string(categoryName)); it != m_CategoryIds.end())
+    {
+        return it->second;
+    }
+
+    const std::size_t count = m_CategoryCount.load(std::memory_order_relaxed);
+    if (count >= kMaxCategories)
+    {
+        // 상한 초과는 백엔드 카테고리로 기록 (이름 대신).
+        return 0;
+    }
+
+    m_CategoryNames[count] = std::string(categoryName);
+    m_CategoryIds.emplace(m_CategoryNames[count], static_cast<std::uint16_t>(count));
+    m_CategoryCount.store(count + 1, std::memory_order_release);
+    return static_cast<std::uint16_t>(count);
+}
+
+void AsyncLogBackend::Run()
+{
+    auto nextFlush = std::chrono::steady_clock::now() + m_Options.FlushInterval;
+
+    while (!m_bStopRequested.load(std::memory_order_acquire))
+    {
+        const std::size_t drained = DrainOnce();
+
+        if (std::chrono::steady_clock::now() >= nextFlush)
+        {
+            FlushSinks();
+            nextFlush = std::chrono::steady_clock::now() + m_Options.FlushInterval;
+        }
+
+        if (0 == drained)
+        {
+            std::this_thread::sleep_for(m_Options.IdleSleep);
+        }
+    }
+
+    // 정지 요청 이전에 적재된 record 를 모두 기록.
+    while (DrainOnce() > 0)
+    {
+    }
+
+    const auto stats = GetStats();
+    WriteMessage(kBackendCategory, spdlog::level::info,
+        std::format("Async log backend stopped. Enqueued : {}, Written : {}, Dropped : {}, Eager formatted : {}, Spanned : {}, Truncated : {}",
+            stats.Enqueued, stats.Written, stats.Dropped, stats.EagerFormatted, stats.Spanned, stats.Truncated));
+    FlushSinks();
+}
+
+std::size_t AsyncLogBackend::DrainOnce()
+{
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    {
+        auto lock = std::lock_guard(m_RingsMutex);
+        rings = m_Rings;
+    }
+
+    spdlog::memory_buf_t buffer;
+    std::size_t drained = 0;
+    for (const auto& pRing : rings)
+    {
+        // bRetired 를 먼저 읽어야 종료 직전 적재분을 놓치지 않는다.
+        const bool bRetired = pRing->bRetired.load(std::memory_order_acquire);
+
+        // Head 는 record 경계에만 있으므로 record 단위로 넘기면 tail 은 head 를 지나지 않는다.
+        const std::size_t begin = pRing->Tail.load(std::memory_order_relaxed);
+        const std::size_t head = pRing->Head.load(std::memory_order_acquire);
+        const std::size_t limit = bRetired ? head : (std::min)(head, begin + kDrainBatch);
+        std::size_t tail = begin;
+        while (tail < limit)
+        {
+            tail += WriteRecord(*pRing, tail, buffer);
+        }
+        pRing->Tail.store(tail, std::memory_order_release);
+        drained += tail - begin;
+
+        ReportDrops(*pRing);
+
+        if (bRetired)
+        {
+            auto lock = std::lock_guard(m_RingsMutex);
+            m_RetiredStats.Enqueued += pRing->Enqueued.load(std::memory_order_relaxed);
+            m_RetiredStats.Dropped += pRing->Dropped.load(std::memory_order_relaxed);
+            m_RetiredStats.EagerFormatted += pRing->EagerFormatted.load(std::memory_order_relaxed);
+            m_RetiredStats.Spanned += pRing->Spanned.load(std::memory_order_relaxed);
+            m_RetiredStats.Truncated += pRing->Truncated.load(std::memory_order_relaxed);
+            std::erase(m_Rings, pRing);
+        }
+    }
+    return drained;
+}
+
+std::size_t AsyncLogBackend::WriteRecord(const ThreadRing& rfRing, std::size_t index, spdlog::memory_buf_t& rfBuffer)
+{
+    rfBuffer.clear();
+
+    const AsyncLogRecord& rfRecord = rfRing.pSlots[index & rfRing.Mask];
+    const std::size_t slots = std::size_t{ 1 } + rfRecord.ExtraSlots;
+
+    // 여러 칸이면 payload 를 이어 붙인다 (ring 끝에서 감겨 메모리가 연속이 아닐 수 있다).
+    const std::byte* pPayload = rfRecord.Data.data();
+    if (slots > 1)
+    {
+        m_SpannedPayload.resize(rfRecord.DataSize);
+        const std::size_t first = (std::min)(std::size_t{ rfRecord.DataSize }, AsyncLogRecord::kDataCapacity);
+        std::memcpy(m_SpannedPayload.data(), rfRecord.Data.data(), first);
+
+        std::size_t offset = first;
+        for (std::size_t slot = index + 1; offset < rfRecord.DataSize; ++slot)
+        {
+            const std::size_t bytes = (std::min)(rfRecord.DataSize - offset, AsyncLogRecord::kSize);
+            std::memcpy(m_SpannedPayload.data() + offset, &rfRing.pSlots[slot & rfRing.Mask], bytes);
+            offset += bytes;
+        }
+        pPayload = m_SpannedPayload.data();
+    }
+
+    if (rfRecord.pFormat)
+    {
+        const bool bCopiedFormat = (nullptr == rfRecord.pFormatText);
+        const std::string_view fmt(bCopiedFormat ? reinterpret_cast<const char*>(pPayload) : rfRecord.pFormatText, rfRecord.FormatSize);
+        try
+        {
+            rfRecord.pFormat(rfBuffer, fmt, pPayload + (bCopiedFormat ? rfRecord.FormatSize : 0));
+        }
+        catch (const std::exception& rfException)
+        {
+            rfBuffer.clear();
+            const std::string text = std::format("{} [format error: {}]", fmt, rfException.what());
+            rfBuffer.append(text.data(), text.data() + text.size());
+        }
+    }
+    else
+    {
+        const char* pText = reinterpret_cast<const char*>(pPayload);
+        rfBuffer.append(pText, pText + rfRecord.DataSize);
+    }
+
+    const std::size_t categoryCount = m_CategoryCount.load(std::memory_order_acquire);
+    const std::string& rfCategory = m_CategoryNames[rfRecord.CategoryId < categoryCount ? rfRecord.CategoryId : 0];
+
+    spdlog::details::log_msg message(rfRecord.Time, spdlog::source_loc{}, rfCategory,
+        static_cast<spdlog::level::level_enum>(rfRecord.Level), spdlog::string_view_t(rfBuffer.data(), rfBuffer.size()));
+    message.thread_id = rfRing.ThreadId;
+
+    WriteToSinks(message);
+    m_Written.fetch_add(1, std::memory_order_relaxed);
+    return slots;
+}
+
+void AsyncLogBackend::WriteMessage(std::string_view categoryName, spdlog::level::level_enum lvl, std::string_view text)
+{
+    WriteToSinks(spdlog::details::log_msg(categoryName, lvl, spdlog::string_view_t(text.data(), text.size())));
+}
+
+void AsyncLogBackend::WriteToSinks(const spdlog::details::log_msg& rfMessage)
+{
+    for (const auto& pSink : m_Sinks)
+    {
+        if (!pSink->should_log(rfMessage.level))
+        {
+            continue;
+        }
+
+        // sink 오류 (파일 회전 실패 등) 로 백그라운드 스레드가 죽지 않도록 — spdlog::logger 와 동일하게 무시.
+        try
+        {
+            pSink->log(rfMessage);
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+}
+
+void AsyncLogBackend::ReportDrops(ThreadRing& rfRing)
+{
+    const std::uint64_t dropped = rfRing.Dropped.load(std::memory_order_relaxed);
+    if (dropped == rfRing.ReportedDropped)
+    {
+        return;
+    }
+
+    WriteMessage(kBackendCategory, spdlog::level::warn,
+        std::format("{} log records dropped (thread {} ring full, capacity {})", dropped - rfRing.ReportedDropped, rfRing.ThreadId, rfRing.Mask + 1));
+    rfRing.ReportedDropped = dropped;
+}
+
+void AsyncLogBackend::FlushSinks()
+{
+    for (const auto& pSink : m_Sinks)
+    {
+        pSink->flush();
+    }
+}
+
+} // namespace LibCommons
@@ -0,0 +1,447 @@
+﻿module;
+
+#include <cstdint>
+#include <cstring>
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/sink.h>
+
+export module commons.async_log_backend;
+
+import std;
+
+namespace LibCommons
+{
+
+// 스레드 ring 이 가득 찼을 때의 처리.
+export enum class EAsyncLogOverflow : std::uint8_t
+{
+    Drop,   // 버리고 Dropped 카운트 (호출 스레드는 기다리지 않음)
+    Block,  // 빈 칸이 날 때까지 yield (백엔드 정지 중이면 Drop)
+};
+
+export struct AsyncLogOptions
+{
+    std::size_t RingCapacity = 1024;                    // 스레드당 칸 수 (2의 거듭제곱으로 올림, 칸 256B)
+    EAsyncLogOverflow Overflow = EAsyncLogOverflow::Drop;
+    std::chrono::milliseconds IdleSleep{ 1 };           // 모든 ring 이 비었을 때 백그라운드 스레드 대기
+    std::chrono::milliseconds FlushInterval{ 1000 };    // sink flush 주기
+};
+
+export struct AsyncLogStats
+{
+    std::uint64_t Enqueued       = 0;  // ring 에 적재된 record
+    std::uint64_t Dropped        = 0;  // ring 이 가득 차 버린 record
+    std::uint64_t EagerFormatted = 0;  // 인자를 보관할 수 없어 호출 스레드에서 포맷한 record
+    std::uint64_t Spanned        = 0;  // 한 칸에 안 들어가 뒤 칸까지 이어 쓴 record
+    std::uint64_t Truncated      = 0;  // 최대 칸 수로도 모자라 잘라 낸 record (메시지 끝에 표시)
+    std::uint64_t Written        = 0;  // sink 로 기록한 record
+    std::size_t   ThreadRings    = 0;  // 현재 등록된 스레드 ring 수
+};
+
+// 문자열 리터럴 포맷. consteval 생성자라 정적 수명 문자열만 받으므로 record 에는 포인터만 담는다.
+export struct LogFormat
+{
+    template <std::size_t N>
+    consteval LogFormat(const char (&rfText)[N]) noexcept : Text(rfText, N - 1) {}
+
+    std::string_view Text;
+};
+
+// ring 한 칸. 호출 스레드는 포맷 문자열 위치와 인자의 바이너리 복사본만 남기고, 포맷은 백그라운드 스레드가 한다.
+// payload (포맷 복사본 + packed 인자, 또는 완성된 메시지) 가 Data 를 넘으면 바로 뒤 칸들을 통째로 이어 쓴다.
+export struct AsyncLogRecord
+{
+    static constexpr std::size_t kSize = 256;
+    static constexpr std::size_t kDataCapacity = 224;
+
+    // record 1개가 차지할 수 있는 최대 칸 수 (첫 칸 포함). 이보다 긴 메시지는 잘라 표시한다.
+    static constexpr std::size_t kMaxSlots = 16;
+
+    static constexpr std::size_t GetSlotCount(std::size_t payloadBytes) noexcept
+    {
+        return payloadBytes <= kDataCapacity ? 1 : 1 + (payloadBytes - kDataCapacity + kSize - 1) / kSize;
+    }
+
+    static constexpr std::size_t GetPayloadCapacity(std::size_t slots) noexcept
+    {
+        return kDataCapacity + (slots - 1) * kSize;
+    }
+
+    // pArgs 의 packed 인자로 fmt 를 포맷해 out 에 붙인다.
+    using FormatFn = void (*)(spdlog::memory_buf_t& out, std::string_view fmt, const std::byte* pArgs);
+
+    spdlog::log_clock::time_point Time{};
+    FormatFn pFormat = nullptr;         // nullptr 이면 payload 가 완성된 메시지
+    const char* pFormatText = nullptr;  // 리터럴 포맷. nullptr 이면 payload 앞쪽 FormatSize 바이트가 포맷 복사본
+    std::uint16_t CategoryId = 0;
+    std::uint16_t FormatSize = 0;
+    std::uint16_t DataSize = 0;         // payload 전체 길이 (이어 쓴 칸 포함)
+    std::uint8_t Level = 0;
+    std::uint8_t ExtraSlots = 0;        // 뒤에 이어 쓴 칸 수
+    std::array<std::byte, kDataCapacity> Data;
+};
+static_assert(sizeof(AsyncLogRecord) == AsyncLogRecord::kSize);
+static_assert(AsyncLogRecord::GetPayloadCapacity(AsyncLogRecord::kMaxSlots) <= (std::numeric_limits<std::uint16_t>::max)());
+
+namespace Detail
+{
+
+// 값 그대로 복사해 두었다가 나중에 포맷해도 되는 인자.
+template <class T>
+concept RawLogArg = std::is_arithmetic_v<T> || std::is_enum_v<T>
+    || std::is_same_v<T, void*> || std::is_same_v<T, const void*>;
+
+// 문자열 인자 — 호출 시점 내용을 record 에 복사한다 (임시 std::string 도 안전).
+template <class T>
+concept StringLogArg = !RawLogArg<T> && std::is_convertible_v<const T&, std::string_view>;
+
+template <class T>
+concept DeferrableLogArg = RawLogArg<T> || StringLogArg<T>;
+
+// 호출 인자 타입 → 보관 타입 판단 기준 (문자열 배열은 const char*).
+template <class T>
+using LogArgOf = std::decay_t<const T&>;
+
+template <class T>
+using StoredLogArg = std::conditional_t<RawLogArg<T>, T, std::string_view>;
+
+template <class T>
+std::string_view ToLogView(const T& rfValue) noexcept
+{
+    if constexpr (std::is_pointer_v<T>)
+    {
+        return rfValue ? std::string_view(rfValue) : std::string_view("(null)");
+    }
+    else
+    {
+        return std::string_view(rfValue);
+    }
+}
+
+template <class T>
+std::size_t PackedLogSize(const T& rfValue) noexcept
+{
+    if constexpr (RawLogArg<T>)
+    {
+        return sizeof(T);
+    }
+    else
+    {
+        return sizeof(std::uint16_t) + ToLogView(rfValue).size();
+    }
+}
+
+template <class T>
+std::byte* PackLogArg(std::byte* pOut, const T& rfValue) noexcept
+{
+    if constexpr (RawLogArg<T>)
+    {
+        std::memcpy(pOut, &rfValue, sizeof(T));
+        return pOut + sizeof(T);
+    }
+    else
+    {
+        const std::string_view view = ToLogView(rfValue);
+        const auto size = static_cast<std::uint16_t>(view.size());
+        std::memcpy(pOut, &size, sizeof(size));
+        std::memcpy(pOut + sizeof(size), view.data(), size);
+        return pOut + sizeof(size) + size;
+    }
+}
+
+template <class T>
+StoredLogArg<T> UnpackLogArg(const std::byte*& rfpIn) noexcept
+{
+    if constexpr (RawLogArg<T>)
+    {
+        T value;
+        std::memcpy(&value, rfpIn, sizeof(T));
+        rfpIn += sizeof(T);
+        return value;
+    }
+    else
+    {
+        std::uint16_t size = 0;
+        std::memcpy(&size, rfpIn, sizeof(size));
+        const std::string_view view(reinterpret_cast<const char*>(rfpIn + sizeof(size)), size);
+        rfpIn += sizeof(size) + size;
+        return view;
+    }
+}
+
+// 잘라 낸 메시지 끝에 붙이는 표시.
+inline constexpr std::string_view kTruncatedLogMarker = " ...[truncated]";
+
+template <class... Ts>
+void FormatPackedLog(spdlog::memory_buf_t& out, std::string_view fmt, const std::byte* pArgs)
+{
+    // 인자 순서대로 풀어야 하므로 brace-init (좌→우 평가 보장).
+    std::tuple<StoredLogArg<Ts>...> values{ UnpackLogArg<Ts>(pArgs)... };
+    std::apply([&](const auto&... rfValues)
+    {
+        spdlog::fmt_lib::vformat_to(std::back_inserter(out), fmt, spdlog::fmt_lib::make_format_args(rfValues...));
+    }, values);
+}
+
+} // namespace Detail
+
+
+/**
+ * AsyncLogBackend
+ * Logger 의 비동기 기록 경로. 호출 스레드는 record 1칸을 채우고 돌아간다 — 포맷 / sink 기록은 백그라운드 스레드 1개.
+ *
+ * - 스레드마다 SPSC ring (256B 칸 배열) 을 처음 로그할 때 등록. 적재 경로에 락이 없다.
+ * - record 에는 시각 / 레벨 / 카테고리 ID / 포맷 문자열 / packed 인자를 담는다.
+ *   LogFormat (리터럴) 로 넘긴 포맷은 포인터만, 이름 경로의 런타임 포맷은 내용을 복사한다.
+ *   숫자 / enum / void* 는 값 그대로, 문자열은 내용을 복사한다. 그 외 타입이 섞이면 호출 스레드에서 포맷해
+ *   완성된 메시지를 담는다 (EagerFormatted).
+ * - 한 칸에 안 들어가는 record 는 뒤 칸들에 이어 쓴다 (최대 kMaxSlots 칸, Spanned).
+ *   그래도 넘으면 호출 스레드에서 포맷해 잘라 담고 끝에 " ...[truncated]" 를 붙인다 (Truncated).
+ * - ring 이 가득 차면 Overflow 정책대로 버리거나 기다린다. 버린 수는 백그라운드 스레드가 경고로 남긴다.
+ * - 스레드 간 기록 순서는 보장하지 않는다 (record 시각은 호출 시점).
+ *
+ * [Thread Safety] Push / GetStats 는 임의 스레드. Start / Stop 은 소유자 (Logger) 만.
+ */
+export class AsyncLogBackend
+{
+public:
+    AsyncLogBackend(const AsyncLogOptions& rfOptions, std::vector<spdlog::sink_ptr> sinks, spdlog::level::level_enum minLevel);
+    ~AsyncLogBackend();
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+    void Start();
+
+    // 남은 record 를 모두 기록하고 sink 를 flush 한 뒤 스레드 종료.
+    void Stop();
+
+    bool ShouldLog(spdlog::level::level_enum lvl) const noexcept { return lvl >= m_MinLevel && lvl != spdlog::level::off; }
+
+    // 카테고리 이름 → ID (없으면 등록). ID 는 백엔드 수명 동안 유지되므로 호출자가 캐시해도 된다.
+    std::uint16_t RegisterCategory(std::string_view categoryName);
+
+    // 런타임 포맷 — 포맷 문자열 내용을 record 에 복사한다.
+    template <class... Args>
+    void Push(std::string_view categoryName, spdlog::level::level_enum lvl, std::string_view fmt, const Args&... args)
+    {
+        if (ShouldLog(lvl))
+        {
+            PushImpl(ResolveCategory(categoryName), lvl, fmt, false, args...);
+        }
+    }
+
+    // RegisterCategory 로 얻은 ID 로 적재 (이름 조회 없음). 리터럴 포맷은 포인터만 담는다.
+    template <class... Args>
+    void PushRecord(std::uint16_t categoryId, spdlog::level::level_enum lvl, LogFormat fmt, const Args&... args)
+    {
+        if (ShouldLog(lvl))
+        {
+            PushImpl(categoryId, lvl, fmt.Text, true, args...);
+        }
+    }
+
+    AsyncLogStats GetStats() const;
+
+private:
+    struct ThreadRing
+    {
+        ThreadRing(std::size_t capacity, std::uint32_t threadId)
+            : pSlots(std::make_unique<AsyncLogRecord[]>(capacity)), Mask(capacity - 1), ThreadId(threadId)
+        {
+        }
+
+        // (생산자) 연속 slots 칸이 비어 있지 않으면 nullptr. 반환값은 첫 칸.
+        AsyncLogRecord* BeginWrite(std::size_t slots) noexcept
+        {
+            const std::size_t head = Head.load(std::memory_order_relaxed);
+            if (head - Tail.load(std::memory_order_acquire) + slots > Mask + 1)
+            {
+                return nullptr;
+            }
+            return &pSlots[head & Mask];
+        }
+
+        // (생산자) record 1개 (slots 칸) 공개. Head 는 항상 record 경계에 있다.
+        void EndWrite(std::size_t slots) noexcept
+        {
+            Head.store(Head.load(std::memory_order_relaxed) + slots, std::memory_order_release);
+            Enqueued.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const std::unique_ptr<AsyncLogRecord[]> pSlots;
+        const std::size_t Mask;
+        const std::uint32_t ThreadId;
+
+        alignas(64) std::atomic<std::size_t> Head{ 0 };
+        std::atomic<std::uint64_t> Enqueued{ 0 };
+        std::atomic<std::uint64_t> Dropped{ 0 };
+        std::atomic<std::uint64_t> EagerFormatted{ 0 };
+        std::atomic<std::uint64_t> Spanned{ 0 };
+        std::atomic<std::uint64_t> Truncated{ 0 };
+
+        alignas(64) std::atomic<std::size_t> Tail{ 0 };
+        std::uint64_t ReportedDropped = 0;  // 백그라운드 스레드 전용
+
+        std::atomic<bool> bRetired{ false };  // 스레드 종료 — 비면 등록 해제
+    };
+
+    // 스레드별 ring / 카테고리 캐시 (thread_local, .cpp).
+    struct ThreadState;
+
+    ThreadState& GetThreadState();
+    ThreadRing* GetThreadRing();
+    std::uint16_t ResolveCategory(std::string_view categoryName);
+
+    // record 1개가 쓸 수 있는 칸 수 (ring 보다 클 수 없다).
+    std::size_t GetMaxRecordSlots() const noexcept { return (std::min)(AsyncLogRecord::kMaxSlots, m_RingCapacity); }
+
+    // 연속 slots 칸을 잡고 시각 / 레벨 / 카테고리를 채운다. 가득 차 있으면 Overflow 정책대로 (버리면 nullptr).
+    AsyncLogRecord* BeginRecord(ThreadRing& rfRing, std::size_t slots, std::uint16_t categoryId, spdlog::level::level_enum lvl);
+    AsyncLogRecord* WaitForSlot(ThreadRing& rfRing, std::size_t slots);
+
+    // 첫 칸 Data 부터 뒤 칸들까지 이어서 payload 복사.
+    static void WritePayload(ThreadRing& rfRing, const std::byte* pPayload, std::size_t size) noexcept;
+
+    template <class... Args>
+    void PushImpl(std::uint16_t categoryId, spdlog::level::level_enum lvl, std::string_view fmt, bool bLiteralFormat, const Args&... args)
+    {
+        ThreadRing* pRing = GetThreadRing();
+
+        if constexpr ((Detail::DeferrableLogArg<Detail::LogArgOf<Args>> && ...))
+        {
+            const std::size_t formatBytes = bLiteralFormat ? 0 : fmt.size();
+            const std::size_t payloadSize = formatBytes + (std::size_t{ 0 } + ... + Detail::PackedLogSize<Detail::LogArgOf<Args>>(args));
+            const std::size_t slots = AsyncLogRecord::GetSlotCount(payloadSize);
+            if (slots <= GetMaxRecordSlots() && fmt.size() <= (std::numeric_limits<std::uint16_t>::max)())
+            {
+                AsyncLogRecord* pRecord = BeginRecord(*pRing, slots, categoryId, lvl);
+                if (!pRecord)
+                {
+                    return;
+                }
+
+                pRecord->pFormat = &Detail::FormatPackedLog<Detail::LogArgOf<Args>...>;
+                pRecord->pFormatText = bLiteralFormat ? fmt.data() : nullptr;
+                pRecord->FormatSize = static_cast<std::uint16_t>(fmt.size());
+                pRecord->DataSize = static_cast<std::uint16_t>(payloadSize);
+
+                // 한 칸이면 Data 에 바로, 넘치면 (드문 경로) 따로 모은 뒤 칸마다 나눠 쓴다.
+                std::unique_ptr<std::byte[]> pSpanned;
+                std::byte* pPayload = pRecord->Data.data();
+                if (slots > 1)
+                {
+                    pSpanned = std::make_unique<std::byte[]>(payloadSize);
+                    pPayload = pSpanned.get();
+                }
+
+                std::byte* pOut = pPayload;
+                if (formatBytes > 0)
+                {
+                    std::memcpy(pOut, fmt.data(), formatBytes);
+                    pOut += formatBytes;
+                }
+                ((pOut = Detail::PackLogArg<Detail::LogArgOf<Args>>(pOut, args)), ...);
+
+                if (slots > 1)
+                {
+                    WritePayload(*pRing, pPayload, payloadSize);
+                    pRing->Spanned.fetch_add(1, std::memory_order_relaxed);
+                }
+                pRing->EndWrite(slots);
+                return;
+            }
+        }
+
+        PushEager(*pRing, categoryId, lvl, fmt, args...);
+    }
+
+    // 호출 스레드에서 포맷해 완성된 메시지를 담는다. 최대 칸 수를 넘으면 잘라 표시.
+    template <class... Args>
+    void PushEager(ThreadRing& rfRing, std::uint16_t categoryId, spdlog::level::level_enum lvl, std::string_view fmt, const Args&... args)
+    {
+        spdlog::memory_buf_t buffer;
+        try
+        {
+            spdlog::fmt_lib::vformat_to(std::back_inserter(buffer), fmt, spdlog::fmt_lib::make_format_args(args...));
+        }
+        catch (const std::exception&)
+        {
+            buffer.clear();
+            buffer.append(fmt.data(), fmt.data() + fmt.size());
+        }
+
+        const std::size_t capacity = AsyncLogRecord::GetPayloadCapacity(GetMaxRecordSlots());
+        const bool bTruncated = buffer.size() > capacity;
+        if (bTruncated)
+        {
+            buffer.resize(capacity - Detail::kTruncatedLogMarker.size());
+            buffer.append(Detail::kTruncatedLogMarker.data(), Detail::kTruncatedLogMarker.data() + Detail::kTruncatedLogMarker.size());
+        }
+
+        const std::size_t slots = AsyncLogRecord::GetSlotCount(buffer.size());
+        AsyncLogRecord* pRecord = BeginRecord(rfRing, slots, categoryId, lvl);
+        if (!pRecord)
+        {
+            return;
+        }
+
+        pRecord->pFormat = nullptr;
+        pRecord->pFormatText = nullptr;
+        pRecord->FormatSize = 0;
+        pRecord->DataSize = static_cast<std::uint16_t>(buffer.size());
+        WritePayload(rfRing, reinterpret_cast<const std::byte*>(buffer.data()), buffer.size());
+
+        rfRing.EagerFormatted.fetch_add(1, std::memory_order_relaxed);
+        if (slots > 1)
+        {
+            rfRing.Spanned.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (bTruncated)
+        {
+            rfRing.Truncated.fetch_add(1, std::memory_order_relaxed);
+        }
+        rfRing.EndWrite(slots);
+    }
+
+    void Run();
+    std::size_t DrainOnce();
+    // index 의 record (이어 쓴 칸 포함) 를 포맷해 기록하고 차지한 칸 수를 반환.
+    std::size_t WriteRecord(const ThreadRing& rfRing, std::size_t index, spdlog::memory_buf_t& rfBuffer);
+    void WriteMessage(std::string_view categoryName, spdlog::level::level_enum lvl, std::string_view text);
+    void WriteToSinks(const spdlog::details::log_msg& rfMessage);
+    void ReportDrops(ThreadRing& rfRing);
+    void FlushSinks();
+
+private:
+    static constexpr std::size_t kMaxCategories = 1024;
+
+    const AsyncLogOptions m_Options;
+    const std::size_t m_RingCapacity;
+    const std::vector<spdlog::sink_ptr> m_Sinks;
+    const spdlog::level::level_enum m_MinLevel;
+    const std::uint64_t m_InstanceId;
+
+    // 등록된 스레드 ring. 백그라운드 스레드는 매 pass 마다 스냅샷을 떠서 돈다.
+    mutable std::mutex m_RingsMutex;
+    std::vector<std::shared_ptr<ThreadRing>> m_Rings;
+    AsyncLogStats m_RetiredStats{};  // 등록 해제된 ring 의 누적 카운터
+
+    // 카테고리 ID → 이름. 이름은 한 번 쓰면 바뀌지 않고, ID 는 m_CategoryCount 로 공개된다.
+    std::mutex m_CategoryMutex;
+    std::unordered_map<std::string, std::uint16_t> m_CategoryIds;
+    std::array<std::string, kMaxCategories> m_CategoryNames;
+    std::atomic<std::size_t> m_CategoryCount{ 0 };
+
+    // 여러 칸에 걸친 record 를 이어 붙이는 버퍼 (백그라운드 스레드 전용).
+    std::vector<std::byte> m_SpannedPayload;
+
+    std::atomic<std::uint64_t> m_Written{ 0 };
+    std::atomic<bool> m_bRunning{ false };
+    std::atomic<bool> m_bStopRequested{ false };
+    std::thread m_Thread;
+};
+
+} // namespace LibCommons
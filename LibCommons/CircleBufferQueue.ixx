@@ -10,11 +10,18 @@ export module commons.buffers.circle_buffer_queue;
 import std;
 import commons.rwlock;
 import commons.buffers.ibuffer;
+import commons.buffers.slab_pool;
 import commons.logger;
 
 namespace LibCommons::Buffers
 {
 
+// 버퍼 포화 시 세션 수만큼 반복되는 경로 — 호출 위치별 rate limit.
+constinit LibCommons::LogCategory<> s_LogCategory{ "CircleBufferQueue" };
+constinit LibCommons::LogRateLimit s_WriteLogLimit{ "CircleBufferQueue.Write" };
+constinit LibCommons::LogRateLimit s_AllocateWriteLogLimit{ "CircleBufferQueue.AllocateWrite" };
+constinit LibCommons::LogRateLimit s_WriteableBuffersLogLimit{ "CircleBufferQueue.GetWriteableBuffers" };
+
 export class CircleBufferQueue final : public IBuffer
 {
 public:
@@ -41,7 +48,7 @@ public:
         const size_t size = data.size();
         if (m_Capacity - m_Size < size)
         {
-            LibCommons::Logger::GetInstance().LogError("CircleBufferQueue", "Write() Insufficient space. Requested Size : {}, Available Size : {}", size, m_Capacity - m_Size);
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_WriteLogLimit, "Write() Insufficient space. Requested Size : {}, Available Size : {}", size, m_Capacity - m_Size);
 
             return false;
         }
@@ -71,7 +78,7 @@ public:
         const size_t size = outBuffer.size();
         if (m_Size < size)
         {
-            LibCommons::Logger::GetInstance().LogError("CircleBufferQueue", "Pop() Insufficient data. Requested Size : {}, Available Size : {}", size, m_Size);
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, "Pop() Insufficient data. Requested Size : {}, Available Size : {}", size, m_Size);
             return false;
         }
 
@@ -100,7 +107,7 @@ public:
         const size_t size = outBuffer.size();
         if (m_Size < size)
         {
-            LibCommons::Logger::GetInstance().LogError("CircleBufferQueue", "Peek() Insufficient data. Requested Size : {}, Available Size : {}", size, m_Size);
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, "Peek() Insufficient data. Requested Size : {}, Available Size : {}", size, m_Size);
 
             return false;
         }
@@ -126,7 +133,7 @@ public:
 
         if (m_Size == 0)
         {
-            LibCommons::Logger::GetInstance().LogError("CircleBufferQueue", "GetReadBuffers() Buffer is empty.");
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, "GetReadBuffers() Buffer is empty.");
             return 0;
         }
 
@@ -151,7 +158,7 @@ public:
 
         if (m_Capacity - m_Size < size)
         {
-            LibCommons::Logger::GetInstance().LogError("CircleBufferQueue", "AllocateWrite() Insufficient space. Requested Size : {}, Available Size : {}", size, m_Capacity - m_Size);
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_AllocateWriteLogLimit, "AllocateWrite() Insufficient space. Requested Size : {}, Available Size : {}", size, m_Capacity - m_Size);
 
             return false;
         }
@@ -220,7 +227,7 @@ public:
         const size_t freeSpace = m_Capacity - m_Size;
         if (freeSpace == 0)
         {
-            LibCommons::Logger::GetInstance().LogError("CircleBufferQueue", "GetWriteableBuffers() Buffer is full.");
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_WriteableBuffersLogLimit, "GetWriteableBuffers() Buffer is full.");
             return 0;
         }
 
@@ -257,7 +264,8 @@ public:
     }
 
 private:
-    std::vector<char> m_Buffer;
+    // 64KB 이하 용량은 SlabPool 의 size class 에서 — 세션 생성/종료마다 힙을 오가지 않는다.
+    SlabVector<char> m_Buffer;
     size_t m_Head = 0;
     size_t m_Tail = 0;
     size_t m_Size = 0;
@@ -12,6 +12,7 @@ export module commons.event_listener;
 
 import commons.singleton;
 import commons.thread_pool;
+import commons.strand;
 
 namespace LibCommons
 {
@@ -36,20 +37,21 @@ public:
             return;
         }
 
-        m_pThreadPool = std::make_unique<ThreadPool>(threadCount);
+        m_pThreadPool = ThreadPool::Create(threadCount);
     }
 
     void Stop()
     {
         if (m_pThreadPool)
         {
+            // strand 가 풀을 함께 잡고 있으므로 여기서 놓아도 해제되지 않는다 — 이후 Post 는 호출 스레드에서 실행된다.
             m_pThreadPool->Stop();
             m_pThreadPool.reset(); 
         }
     }
 
-    // 특정 역할을(작업을) 다른 쓰레드에 전달합니다.
-    void Enqueue(std::function<void()> task)
+    // 특정 역할을(작업을) 다른 쓰레드에 전달합니다. 이동 전용 캡처도 받는다.
+    void Enqueue(Task task)
     {
         if (m_pThreadPool)
         {
@@ -60,20 +62,27 @@ public:
     template<class F, class R /* std::invoke_result_t<F> */>
     auto Enqueue(F&& function) -> std::future<R>
     {
-        auto pTask = std::make_shared<std::packaged_task<R()>>(std::packaged_task<R()>(std::bind(std::forward<F>(function))));
+        // packaged_task 는 이동 전용 — Task 로 바로 넘겨 shared_ptr 할당을 없앤다.
+        std::packaged_task<R()> task(std::forward<F>(function));
+
+        std::future<R> res = task.get_future();
 
-        std::future<R> res = pTask->get_future();
-        
         if(m_pThreadPool)
         {
-            m_pThreadPool->Enqueue([pTask]() { (*pTask)(); });
+            m_pThreadPool->Enqueue(Task(std::move(task)));
         }
 
-        return std::move(res);
+        return res;
+    }
+
+    // 이 리스너의 풀 위에서 도는 strand (세션 / 방 단위 직렬 실행). Init 전이면 nullptr.
+    std::shared_ptr<Strand> CreateStrand()
+    {
+        return m_pThreadPool ? Strand::Create(m_pThreadPool) : nullptr;
     }
 
 private:
-    std::unique_ptr<ThreadPool> m_pThreadPool;
+    std::shared_ptr<ThreadPool> m_pThreadPool;
 };
 
 } // namespace LibCommons
\ No newline at end of file
@@ -52,6 +52,9 @@ public:
 
     // 버퍼의 내용을 모두 비움.
     virtual void Clear() = 0;
+
+    // 이 버퍼가 현재 붙들고 있는 저장 공간 바이트 (통계용). 기본은 고정 용량.
+    virtual size_t GetResidentBytes() const { return CanReadSize() + CanWriteSize(); }
 };
 
 }
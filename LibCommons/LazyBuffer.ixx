@@ -0,0 +1,320 @@
+﻿module;
+
+#include <vector>
+#include <mutex>
+
+export module commons.buffers.lazy_buffer;
+
+import std;
+import commons.buffers.ibuffer;
+
+namespace LibCommons::Buffers
+{
+
+/**
+ * 같은 용량의 링 버퍼를 빌려 주는 공유 풀.
+ *
+ * LazyBuffer 가 데이터가 있는 동안에만 ring 을 빌리고, 비면 돌려준다.
+ * 반환된 ring 은 Clear 후 maxIdle 개까지 보관 (초과분은 해제).
+ *
+ * [Thread Safety] Acquire / Release 는 임의 스레드에서 호출 가능 (mutex).
+ */
+export class RingBufferPool
+{
+public:
+    using Factory = std::function<std::unique_ptr<IBuffer>(std::size_t capacity)>;
+
+    RingBufferPool(std::size_t ringCapacity, Factory factory, std::size_t maxIdle)
+        : m_RingCapacity(ringCapacity), m_Factory(std::move(factory)), m_MaxIdle(maxIdle)
+    {
+    }
+
+    RingBufferPool(const RingBufferPool&) = delete;
+    RingBufferPool& operator=(const RingBufferPool&) = delete;
+
+    std::unique_ptr<IBuffer> Acquire()
+    {
+        std::unique_ptr<IBuffer> pRing;
+        {
+            std::lock_guard lock(m_Mutex);
+            if (!m_Idle.empty())
+            {
+                pRing = std::move(m_Idle.back());
+                m_Idle.pop_back();
+            }
+        }
+
+        if (!pRing)
+        {
+            pRing = m_Factory(m_RingCapacity);
+        }
+
+        if (pRing)
+        {
+            m_BorrowedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        return pRing;
+    }
+
+    void Release(std::unique_ptr<IBuffer> pRing)
+    {
+        if (!pRing)
+        {
+            return;
+        }
+
+        m_BorrowedCount.fetch_sub(1, std::memory_order_relaxed);
+        pRing->Clear();
+
+        std::lock_guard lock(m_Mutex);
+        if (m_Idle.size() < m_MaxIdle)
+        {
+            m_Idle.push_back(std::move(pRing));
+        }
+        // 초과분은 인자 pRing 이 소멸하며 해제된다.
+    }
+
+    std::size_t GetRingCapacity() const noexcept { return m_RingCapacity; }
+
+    // 현재 LazyBuffer 에 붙어 있는 ring 수.
+    std::size_t GetBorrowedCount() const noexcept { return m_BorrowedCount.load(std::memory_order_relaxed); }
+
+    std::size_t GetIdleCount() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Idle.size();
+    }
+
+private:
+    const std::size_t m_RingCapacity;
+    const Factory m_Factory;
+    const std::size_t m_MaxIdle;
+
+    mutable std::mutex m_Mutex;
+    std::vector<std::unique_ptr<IBuffer>> m_Idle;
+
+    std::atomic<std::size_t> m_BorrowedCount { 0 };
+};
+
+
+// LazyBuffer 호출 동기화 방식.
+export enum class ELazyRingAccess
+{
+    Locked,      // 임의 스레드에서 호출 (송신 버퍼) — 연산마다 내부 mutex
+    Serialized,  // 모든 호출이 한 경로로 직렬화 (수신 post → complete → consume) — 락 없음
+};
+
+/**
+ * ring 을 필요할 때만 RingBufferPool 에서 빌려 쓰는 IBuffer.
+ *
+ * - 쓰기 경로 (Write / AllocateWrite / GetWriteableBuffers) 에서 ring 이 없으면 빌린다.
+ * - Pop / Consume 후 읽을 데이터가 0 이면 ring 을 돌려준다. 읽기 span 은 Consume 전까지,
+ *   쓰기 span 은 CommitWrite 전까지 데이터가 남아 있으므로 그 사이에 반환되지 않는다.
+ * - zero-byte Recv 로 대기 중인 유휴 세션은 송수신 ring 을 하나도 들고 있지 않다.
+ *
+ * [Thread Safety]
+ * - Locked: 내부 mutex 로 ring 교체와 각 연산을 직렬화한다. 안쪽 ring 의 span 사용 규칙은 동일.
+ * - Serialized: 락을 잡지 않는다 (SPSC 수신 ring 의 lock-free 경로 유지). ring 은 직렬화된 경로에서만
+ *   교체되고, GetResidentBytes / IsAttached 는 ring 포인터만 atomic 으로 읽으므로 임의 스레드에서 호출 가능.
+ */
+export class LazyBuffer final : public IBuffer
+{
+public:
+    explicit LazyBuffer(std::shared_ptr<RingBufferPool> pPool, ELazyRingAccess access = ELazyRingAccess::Locked)
+        : m_pPool(std::move(pPool)), m_Access(access)
+    {
+    }
+
+    ~LazyBuffer() override
+    {
+        Detach();
+    }
+
+    LazyBuffer(const LazyBuffer&) = delete;
+    LazyBuffer& operator=(const LazyBuffer&) = delete;
+
+    bool Write(std::span<const std::byte> data) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = Attach();
+        if (!pRing)
+        {
+            return false;
+        }
+
+        const bool bResult = pRing->Write(data);
+        DetachIfEmpty(pRing);
+        return bResult;
+    }
+
+    bool Pop(std::span<std::byte> outBuffer) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = GetRing();
+        if (!pRing)
+        {
+            return outBuffer.empty();
+        }
+
+        const bool bResult = pRing->Pop(outBuffer);
+        DetachIfEmpty(pRing);
+        return bResult;
+    }
+
+    bool Peek(std::span<std::byte> outBuffer) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = GetRing();
+        if (!pRing)
+        {
+            return outBuffer.empty();
+        }
+        return pRing->Peek(outBuffer);
+    }
+
+    size_t GetReadBuffers(std::vector<std::span<const std::byte>>& outBuffers) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = GetRing();
+        if (!pRing)
+        {
+            outBuffers.clear();
+            return 0;
+        }
+        return pRing->GetReadBuffers(outBuffers);
+    }
+
+    bool AllocateWrite(size_t size, std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = Attach();
+        if (!pRing)
+        {
+            outBuffers.clear();
+            return false;
+        }
+
+        const bool bResult = pRing->AllocateWrite(size, outBuffers);
+        DetachIfEmpty(pRing);
+        return bResult;
+    }
+
+    size_t GetWriteableBuffers(std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = Attach();
+        if (!pRing)
+        {
+            outBuffers.clear();
+            return 0;
+        }
+        return pRing->GetWriteableBuffers(outBuffers);
+    }
+
+    bool CommitWrite(size_t size) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = GetRing();
+        if (!pRing)
+        {
+            return size == 0;
+        }
+
+        const bool bResult = pRing->CommitWrite(size);
+        DetachIfEmpty(pRing);
+        return bResult;
+    }
+
+    bool Consume(size_t size) override
+    {
+        auto lock = Lock();
+        IBuffer* pRing = GetRing();
+        if (!pRing)
+        {
+            return size == 0;
+        }
+
+        const bool bResult = pRing->Consume(size);
+        DetachIfEmpty(pRing);
+        return bResult;
+    }
+
+    size_t CanReadSize() const override
+    {
+        auto lock = Lock();
+        const IBuffer* pRing = GetRing();
+        return pRing ? pRing->CanReadSize() : 0;
+    }
+
+    // ring 이 없으면 빌릴 ring 의 빈 용량.
+    size_t CanWriteSize() const override
+    {
+        auto lock = Lock();
+        const IBuffer* pRing = GetRing();
+        return pRing ? pRing->CanWriteSize() : m_pPool->GetRingCapacity();
+    }
+
+    // ring 포인터만 보므로 두 방식 모두 임의 스레드에서 호출 가능.
+    size_t GetResidentBytes() const override
+    {
+        return IsAttached() ? m_pPool->GetRingCapacity() : 0;
+    }
+
+    void Clear() override
+    {
+        auto lock = Lock();
+        Detach();
+    }
+
+    bool IsAttached() const
+    {
+        return GetRing() != nullptr;
+    }
+
+private:
+    // Serialized 면 잡지 않은 lock.
+    std::unique_lock<std::mutex> Lock() const
+    {
+        return ELazyRingAccess::Locked == m_Access ? std::unique_lock(m_Mutex) : std::unique_lock<std::mutex>();
+    }
+
+    IBuffer* GetRing() const noexcept
+    {
+        return m_pRing.load(std::memory_order_acquire);
+    }
+
+    IBuffer* Attach()
+    {
+        IBuffer* pRing = GetRing();
+        if (!pRing)
+        {
+            pRing = m_pPool->Acquire().release();
+            m_pRing.store(pRing, std::memory_order_release);
+        }
+        return pRing;
+    }
+
+    void Detach()
+    {
+        m_pPool->Release(std::unique_ptr<IBuffer>(m_pRing.exchange(nullptr, std::memory_order_acq_rel)));
+    }
+
+    void DetachIfEmpty(IBuffer* pRing)
+    {
+        if (pRing->CanReadSize() == 0)
+        {
+            Detach();
+        }
+    }
+
+private:
+    const std::shared_ptr<RingBufferPool> m_pPool;
+    const ELazyRingAccess m_Access;
+
+    mutable std::mutex m_Mutex;
+
+    // 빌린 ring (소유). 교체는 Locked 면 m_Mutex 아래, Serialized 면 직렬화된 경로에서만.
+    std::atomic<IBuffer*> m_pRing { nullptr };
+};
+
+} // namespace LibCommons::Buffers
@@ -0,0 +1,59 @@
+﻿module;
+
+#include <mutex>
+#include <vector>
+
+module commons.log_rate_limit;
+
+import std;
+
+namespace LibCommons
+{
+
+namespace
+{
+
+struct LogSiteRegistry
+{
+    std::mutex Mutex;
+    std::vector<const LogSiteBase*> Sites;
+};
+
+LogSiteRegistry& GetRegistry()
+{
+    static LogSiteRegistry s_Registry;
+    return s_Registry;
+}
+
+} // namespace
+
+void LogSiteBase::Register(const LogSiteBase& rfSite) noexcept
+{
+    auto& rfRegistry = GetRegistry();
+    auto lock = std::lock_guard(rfRegistry.Mutex);
+
+    // 할당 실패는 카운터 노출만 빠진다 — 로그 경로에서 예외를 던지지 않는다.
+    try
+    {
+        rfRegistry.Sites.push_back(&rfSite);
+    }
+    catch (const std::bad_alloc&)
+    {
+    }
+}
+
+std::vector<LogSiteStats> SnapshotLogSites()
+{
+    auto& rfRegistry = GetRegistry();
+    auto lock = std::lock_guard(rfRegistry.Mutex);
+
+    std::vector<LogSiteStats> stats;
+    stats.reserve(rfRegistry.Sites.size());
+    for (const auto* pSite : rfRegistry.Sites)
+    {
+        stats.push_back(pSite->GetStats());
+    }
+    return stats;
+}
+
+} // namespace LibCommons
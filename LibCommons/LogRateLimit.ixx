@@ -0,0 +1,220 @@
+﻿module;
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+export module commons.log_rate_limit;
+
+import std;
+
+export namespace LibCommons
+{
+
+enum class ELogSiteKind : std::uint8_t
+{
+    RateLimit,
+    Sample,
+};
+
+// 관리 채널 / 종료 로그용 호출 위치별 카운터.
+struct LogSiteStats
+{
+    std::string_view Name;
+    ELogSiteKind Kind = ELogSiteKind::RateLimit;
+    std::uint64_t Admitted = 0;
+    std::uint64_t Suppressed = 0;
+};
+
+// Admit 결과. SuppressedSinceLast 는 직전 허용 이후 억제된 수 (요약 줄 용, 샘플링은 항상 0).
+struct LogSiteAdmission
+{
+    bool bAdmitted = false;
+    std::uint64_t SuppressedSinceLast = 0;
+};
+
+// 로그 호출 위치 1개. 첫 Admit 때 전역 목록에 등록되므로 파일 범위 static 으로만 만든다 (등록 해제 없음).
+class LogSiteBase
+{
+public:
+    LogSiteBase(const LogSiteBase&) = delete;
+    LogSiteBase& operator=(const LogSiteBase&) = delete;
+
+    std::string_view GetName() const noexcept { return m_Name; }
+
+    LogSiteStats GetStats() const noexcept
+    {
+        return LogSiteStats{ m_Name, m_Kind, m_Admitted.load(std::memory_order_relaxed), m_Suppressed.load(std::memory_order_relaxed) };
+    }
+
+protected:
+    consteval LogSiteBase(std::string_view name, ELogSiteKind kind) noexcept : m_Name(name), m_Kind(kind) {}
+
+    void CountAdmitted() noexcept
+    {
+        EnsureRegistered();
+        m_Admitted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void CountSuppressed() noexcept
+    {
+        EnsureRegistered();
+        m_Suppressed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    void EnsureRegistered() noexcept
+    {
+        if (!m_bRegistered.load(std::memory_order_relaxed) && !m_bRegistered.exchange(true, std::memory_order_relaxed))
+        {
+            Register(*this);
+        }
+    }
+
+    static void Register(const LogSiteBase& rfSite) noexcept;
+
+    std::string_view m_Name;
+    ELogSiteKind m_Kind;
+
+    std::atomic<bool> m_bRegistered{ false };
+    std::atomic<std::uint64_t> m_Admitted{ 0 };
+    std::atomic<std::uint64_t> m_Suppressed{ 0 };
+};
+
+/**
+ * 호출 위치별 token bucket. Burst 개까지 연속 허용하고 이후 초당 RatePerSecond 개씩 회복한다.
+ * 억제된 수는 다음 허용 로그 앞에 "N similar messages suppressed" 로 남긴다 (Logger 가 기록).
+ *
+ *   constinit LibCommons::LogRateLimit s_RecvFailedLimit{ "IOSession.RecvFailed" };
+ *   logger.LogError(s_LogCategory, s_RecvFailedLimit, "Recv failed. Session Id : {}", GetSessionId());
+ */
+class LogRateLimit final : public LogSiteBase
+{
+public:
+    static constexpr std::uint32_t kMaxBurst = (1u << 20) - 1;
+    static constexpr std::uint32_t kMaxRatePerSecond = 1'000'000;
+
+    consteval explicit LogRateLimit(std::string_view name, std::uint32_t burst = 10, std::uint32_t ratePerSecond = 1) noexcept
+        : LogSiteBase(name, ELogSiteKind::RateLimit),
+          m_Burst(std::clamp(burst, 1u, kMaxBurst)),
+          m_RatePerSecond(std::clamp(ratePerSecond, 1u, kMaxRatePerSecond))
+    {
+    }
+
+    LogSiteAdmission Admit() noexcept
+    {
+        return Admit(std::chrono::steady_clock::now());
+    }
+
+    LogSiteAdmission Admit(std::chrono::steady_clock::time_point now) noexcept
+    {
+        const auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+        if (!TryTakeToken(static_cast<std::uint64_t>(nowMs)))
+        {
+            CountSuppressed();
+            m_PendingSuppressed.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+
+        CountAdmitted();
+        return LogSiteAdmission{ true, m_PendingSuppressed.exchange(0, std::memory_order_relaxed) };
+    }
+
+private:
+    static constexpr unsigned kTokenBits = 20;
+    static constexpr std::uint64_t kTokenMask = (std::uint64_t{ 1 } << kTokenBits) - 1;
+
+    // 상태 한 word 를 CAS — 상위: 마지막 회복 시각 (steady ms + 1, 0 = 미사용), 하위 20 bit: 남은 토큰.
+    bool TryTakeToken(std::uint64_t nowMs) noexcept
+    {
+        const std::uint64_t stampNow = nowMs + 1;
+
+        std::uint64_t current = m_State.load(std::memory_order_relaxed);
+        while (true)
+        {
+            std::uint64_t stamp = current >> kTokenBits;
+            std::uint64_t tokens = current & kTokenMask;
+
+            if (0 == stamp)
+            {
+                stamp = stampNow;
+                tokens = m_Burst;
+            }
+            else if (stampNow > stamp)
+            {
+                const std::uint64_t refill = (stampNow - stamp) * m_RatePerSecond / 1000;
+                if (refill > 0)
+                {
+                    tokens = (std::min)(tokens + refill, std::uint64_t{ m_Burst });
+                    // 가득 차면 현재 시각으로, 아니면 회복한 만큼만 전진 (남은 ms 는 다음 회복에 반영).
+                    stamp = (tokens == m_Burst) ? stampNow : stamp + refill * 1000 / m_RatePerSecond;
+                }
+            }
+
+            if (0 == tokens)
+            {
+                return false;
+            }
+
+            const std::uint64_t next = (stamp << kTokenBits) | (tokens - 1);
+            if (m_State.compare_exchange_weak(current, next, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+    const std::uint32_t m_Burst;
+    const std::uint32_t m_RatePerSecond;
+
+    std::atomic<std::uint64_t> m_State{ 0 };
+    std::atomic<std::uint64_t> m_PendingSuppressed{ 0 };
+};
+
+/**
+ * 1-in-N 샘플링. 패킷 / completion 마다 도는 Debug 추적용 — 첫 호출과 이후 N 번째마다 허용한다.
+ *
+ *   constinit LibCommons::LogSampler s_RecvTraceSampler{ "RIOSession.RecvTrace", 64 };
+ *   logger.LogDebug(s_LogCategory, s_RecvTraceSampler, "RIOReceive called. Session Id : {}", GetSessionId());
+ */
+class LogSampler final : public LogSiteBase
+{
+public:
+    consteval explicit LogSampler(std::string_view name, std::uint32_t every) noexcept
+        : LogSiteBase(name, ELogSiteKind::Sample),
+          m_Every((std::max)(every, 1u))
+    {
+    }
+
+    LogSiteAdmission Admit() noexcept
+    {
+        if (0 != m_Counter.fetch_add(1, std::memory_order_relaxed) % m_Every)
+        {
+            CountSuppressed();
+            return {};
+        }
+
+        CountAdmitted();
+        return LogSiteAdmission{ true, 0 };
+    }
+
+private:
+    const std::uint32_t m_Every;
+
+    std::atomic<std::uint64_t> m_Counter{ 0 };
+};
+
+template <typename T>
+concept LogSite = std::derived_from<T, LogSiteBase> && requires(T& rfSite)
+{
+    { rfSite.Admit() } -> std::same_as<LogSiteAdmission>;
+};
+
+// 한 번이라도 Admit 된 호출 위치의 카운터 (등록 순).
+std::vector<LogSiteStats> SnapshotLogSites();
+
+} // namespace LibCommons
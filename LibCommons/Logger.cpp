@@ -47,15 +47,93 @@ namespace LibCommons
 
 			m_pConsoleLogger = pConsoleLogger;
 		}
+
+		// 파일은 카테고리 logger 레벨, 콘솔은 debug — 둘 중 낮은 쪽 미만은 호출 즉시 반환.
+#if _DEBUG
+		m_Level.store(spdlog::level::debug);
+#else
+		m_Level.store(m_pConsoleLogger ? spdlog::level::debug : spdlog::level::info);
+#endif // #if _DEBUG
 	}
 
 	void Logger::Shutdown()
 	{
+		// 호출 위치별 억제 누계 — 마지막 요약 줄이 남지 않은 site 도 파일에서 확인할 수 있게.
+		for (const auto& stats : SnapshotLogSites())
+		{
+			if (stats.Suppressed > 0)
+			{
+				LogInfo("Logger", "Log site {} : admitted {}, suppressed {}", stats.Name, stats.Admitted, stats.Suppressed);
+			}
+		}
+
+		// 비동기 백엔드 먼저 — 남은 record 를 기록한 뒤 sink 를 닫는다.
+		if (m_pAsyncBackendOwner)
+		{
+			m_pAsyncBackend.store(nullptr, std::memory_order_release);
+			m_pAsyncBackendOwner->Stop();
+		}
+
 		spdlog::apply_all([&](auto pLogger) { pLogger->info("end of files"); });
 
 		spdlog::shutdown();
 	}
 
+	void Logger::EnableAsyncBackend(const AsyncLogOptions& rfOptions)
+	{
+		auto lock = WriteLockBlock(m_Lock);
+
+		if (m_pAsyncBackendOwner || !m_pCreatedSilk)
+			return;
+
+		// 레벨은 동기 경로와 동일 — 파일은 카테고리 logger 레벨, 콘솔은 debug.
+#if _DEBUG
+		const auto fileLevel = spdlog::level::debug;
+#else
+		const auto fileLevel = spdlog::level::info;
+#endif // #if _DEBUG
+		m_pCreatedSilk->set_level(fileLevel);
+
+		std::vector<spdlog::sink_ptr> sinks{ m_pCreatedSilk };
+		if (m_pConsoleLogger)
+		{
+			for (const auto& pSink : m_pConsoleLogger->sinks())
+			{
+				pSink->set_level(m_pConsoleLogger->level());
+				sinks.push_back(pSink);
+			}
+		}
+
+		m_pAsyncBackendOwner = std::make_unique<AsyncLogBackend>(rfOptions, std::move(sinks), m_Level.load());
+		m_pAsyncBackendOwner->Start();
+		m_pAsyncBackend.store(m_pAsyncBackendOwner.get(), std::memory_order_release);
+	}
+
+	spdlog::logger* Logger::ResolveLogger(const LogCategoryBase& rfCategory)
+	{
+		if (auto* pLogger = rfCategory.m_pLogger.load(std::memory_order_acquire))
+			return pLogger;
+
+		const std::string name(rfCategory.GetName());
+		auto pLogger = spdlog::get(name);
+		if (!pLogger)
+		{
+			AddCategory(name);
+
+			pLogger = spdlog::get(name);
+		}
+
+		// registry 가 Shutdown 까지 소유하므로 raw pointer 로 캐시.
+		rfCategory.m_pLogger.store(pLogger.get(), std::memory_order_release);
+		return pLogger.get();
+	}
+
+	AsyncLogStats Logger::GetAsyncLogStats() const
+	{
+		auto* pAsyncBackend = m_pAsyncBackend.load(std::memory_order_acquire);
+		return pAsyncBackend ? pAsyncBackend->GetStats() : AsyncLogStats{};
+	}
+
 	void Logger::AddCategory(const std::string& categoryName)
 	{
 		auto lock = WriteLockBlock(m_Lock);
@@ -1,21 +1,99 @@
 ﻿module;
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 
 #include <spdlog/logger.h>
 #include <spdlog/common.h>
 #include <spdlog/spdlog.h>
 
+// 컴파일 타임 최소 레벨 (SPDLOG_LEVEL_*). 이보다 낮은 레벨의 로그 호출은 본문이 컴파일되지 않는다.
+// 빌드 설정에서 FASTPORT_LOG_MIN_LEVEL 로 덮어쓸 수 있다.
+#if !defined(FASTPORT_LOG_MIN_LEVEL)
+#if _DEBUG
+#define FASTPORT_LOG_MIN_LEVEL SPDLOG_LEVEL_DEBUG
+#else
+#define FASTPORT_LOG_MIN_LEVEL SPDLOG_LEVEL_INFO
+#endif // #if _DEBUG
+#endif // #if !defined(FASTPORT_LOG_MIN_LEVEL)
+
+// hot path (패킷 / completion 마다 도는 경로) 카테고리의 최소 레벨. Release 는 Debug / Info 를 제거한다.
+#if _DEBUG
+#define FASTPORT_HOT_PATH_LOG_MIN_LEVEL FASTPORT_LOG_MIN_LEVEL
+#else
+#define FASTPORT_HOT_PATH_LOG_MIN_LEVEL SPDLOG_LEVEL_WARN
+#endif // #if _DEBUG
+
 
 export module commons.logger;
 
 import commons.rwlock;
+export import commons.async_log_backend;
+export import commons.log_rate_limit;
 import commons.singleton;
 
 export namespace LibCommons
 {
+inline constexpr spdlog::level::level_enum kMinLogLevel = static_cast<spdlog::level::level_enum>(FASTPORT_LOG_MIN_LEVEL);
+inline constexpr spdlog::level::level_enum kHotPathMinLogLevel =
+    static_cast<spdlog::level::level_enum>((std::max)(FASTPORT_HOT_PATH_LOG_MIN_LEVEL, FASTPORT_LOG_MIN_LEVEL));
+
+class Logger;
+
+// LogCategory 의 런타임 캐시 (레벨 무관 공통부).
+class LogCategoryBase
+{
+public:
+    std::string_view GetName() const noexcept { return m_Name; }
+
+protected:
+    constexpr explicit LogCategoryBase(std::string_view name) noexcept : m_Name(name) {}
+
+private:
+    friend class Logger;
+
+    std::string_view m_Name;
+
+    // 첫 로그 때 Logger 가 채운다. 비동기 백엔드 카테고리 ID + 1 (0 = 미해결) / 동기 경로 spdlog logger.
+    mutable std::atomic<std::uint32_t> m_AsyncCategoryId{ 0 };
+    mutable std::atomic<spdlog::logger*> m_pLogger{ nullptr };
+};
+
+/**
+ * 미리 만들어 두는 로그 카테고리 핸들. 파일 범위 static 으로 한 번 만들고 LogXxx 에 이름 대신 넘긴다.
+ *
+ *   constinit LibCommons::HotPathLogCategory s_LogCategory{ "IOSession" };
+ *   logger.LogDebug(s_LogCategory, "... Session Id : {}", GetSessionId());
+ *
+ * - 카테고리 문자열 생성 / 이름 조회가 없다 (첫 호출에 ID · logger 를 캐시).
+ * - 포맷은 문자열 리터럴 (LogFormat) 만 받는다. 비동기 백엔드는 포맷을 복사하지 않고 포인터만 담는다.
+ * - MinLevel 미만 레벨의 호출은 본문이 컴파일되지 않는다 (kMinLogLevel 미만도 마찬가지).
+ * - 인자 평가 자체가 비싸면 ShouldLog<Level>(category) 로 먼저 확인한다.
+ */
+template <spdlog::level::level_enum MinLevel = kMinLogLevel>
+class LogCategory final : public LogCategoryBase
+{
+public:
+    static constexpr spdlog::level::level_enum kMinLevel = (std::max)(MinLevel, kMinLogLevel);
+
+    // 이름은 문자열 리터럴 (프로그램 수명 동안 유효) 만 받는다.
+    consteval explicit LogCategory(std::string_view name) noexcept : LogCategoryBase(name) {}
+
+    LogCategory(const LogCategory&) = delete;
+    LogCategory& operator=(const LogCategory&) = delete;
+
+    template <spdlog::level::level_enum Level>
+    static constexpr bool IsCompiledIn() noexcept { return Level >= kMinLevel; }
+};
+
+using HotPathLogCategory = LogCategory<kHotPathMinLogLevel>;
+
+
 class Logger : public SingleTon<Logger>
 {
 private:
@@ -27,48 +105,199 @@ public:
 
     void Shutdown();
 
+    // Create 이후 1회. 이후 로그는 호출 스레드에서 인자만 복사하고, 포맷 / 파일 기록은 백그라운드 스레드가 한다.
+    void EnableAsyncBackend(const AsyncLogOptions& rfOptions = {});
+
+    // 비동기 백엔드 카운터 (미사용이면 0).
+    AsyncLogStats GetAsyncLogStats() const;
+
+    // 런타임 레벨 (Create 에서 파일 / 콘솔 중 낮은 쪽). 낮은 레벨 호출은 이름 조회 전에 반환한다.
+    bool ShouldLog(spdlog::level::level_enum lvl) const noexcept
+    {
+        return lvl >= m_Level.load(std::memory_order_relaxed);
+    }
+
+    // 컴파일 타임 + 런타임 레벨 확인. 비싼 인자를 계산하기 전에 쓴다.
+    template <spdlog::level::level_enum Level, spdlog::level::level_enum MinLevel>
+    bool ShouldLog(const LogCategory<MinLevel>&) const noexcept
+    {
+        if constexpr (LogCategory<MinLevel>::template IsCompiledIn<Level>())
+        {
+            return ShouldLog(Level);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    template<spdlog::level::level_enum MinLevel, typename ... Args>
+    void LogDebug(const LogCategory<MinLevel>& rfCategory, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::debug>(rfCategory, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, typename ... Args>
+    void LogWarning(const LogCategory<MinLevel>& rfCategory, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::warn>(rfCategory, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, typename ... Args>
+    void LogInfo(const LogCategory<MinLevel>& rfCategory, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::info>(rfCategory, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, typename ... Args>
+    void LogError(const LogCategory<MinLevel>& rfCategory, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::err>(rfCategory, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, typename ... Args>
+    void LogCritical(const LogCategory<MinLevel>& rfCategory, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::critical>(rfCategory, fmt, std::forward<Args>(args)...);
+    }
+
+    // 호출 위치별 rate limit (LogRateLimit) / 샘플링 (LogSampler). 억제된 호출은 포맷 없이 반환한다.
+    template<spdlog::level::level_enum MinLevel, LogSite Site, typename ... Args>
+    void LogDebug(const LogCategory<MinLevel>& rfCategory, Site& rfSite, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::debug>(rfCategory, rfSite, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, LogSite Site, typename ... Args>
+    void LogWarning(const LogCategory<MinLevel>& rfCategory, Site& rfSite, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::warn>(rfCategory, rfSite, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, LogSite Site, typename ... Args>
+    void LogInfo(const LogCategory<MinLevel>& rfCategory, Site& rfSite, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::info>(rfCategory, rfSite, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum MinLevel, LogSite Site, typename ... Args>
+    void LogError(const LogCategory<MinLevel>& rfCategory, Site& rfSite, LogFormat fmt, Args&&... args)
+    {
+        Log<spdlog::level::level_enum::err>(rfCategory, rfSite, fmt, std::forward<Args>(args)...);
+    }
+
     template<typename ... Args>
-    void LogDebug(const std::string categaryName, spdlog::string_view_t fmt, Args&&... args)
+    void LogDebug(std::string_view categoryName, spdlog::string_view_t fmt, Args&&... args)
     {
-        Log(categaryName, spdlog::level::level_enum::debug, fmt, std::forward<Args>(args)...);
+        if constexpr (spdlog::level::level_enum::debug >= kMinLogLevel)
+        {
+            Log(categoryName, spdlog::level::level_enum::debug, fmt, std::forward<Args>(args)...);
+        }
     }
 
     template<typename ... Args>
-    void LogWarning(const std::string categaryName, spdlog::string_view_t fmt, Args&&... args)
+    void LogWarning(std::string_view categoryName, spdlog::string_view_t fmt, Args&&... args)
     {
-        Log(categaryName, spdlog::level::level_enum::warn, fmt, std::forward<Args>(args)...);
+        Log(categoryName, spdlog::level::level_enum::warn, fmt, std::forward<Args>(args)...);
     }
 
     template<typename ... Args>
-    void LogInfo(const std::string categaryName, spdlog::string_view_t fmt, Args &&...args)
+    void LogInfo(std::string_view categoryName, spdlog::string_view_t fmt, Args &&...args)
     {
-        Log(categaryName, spdlog::level::level_enum::info, fmt, std::forward<Args>(args)...);
+        if constexpr (spdlog::level::level_enum::info >= kMinLogLevel)
+        {
+            Log(categoryName, spdlog::level::level_enum::info, fmt, std::forward<Args>(args)...);
+        }
     }
 
     template<typename ... Args>
-    void LogError(const std::string categaryName, spdlog::string_view_t fmt, Args&&... args)
+    void LogError(std::string_view categoryName, spdlog::string_view_t fmt, Args&&... args)
     {
-        Log(categaryName, spdlog::level::level_enum::err, fmt, std::forward<Args>(args)...);
+        Log(categoryName, spdlog::level::level_enum::err, fmt, std::forward<Args>(args)...);
     }
 
     template<typename ... Args>
-    void LogCritical(const std::string categaryName, spdlog::string_view_t fmt, Args&&... args)
+    void LogCritical(std::string_view categoryName, spdlog::string_view_t fmt, Args&&... args)
     {
-        Log(categaryName, spdlog::level::level_enum::critical, fmt, std::forward<Args>(args)...);
+        Log(categoryName, spdlog::level::level_enum::critical, fmt, std::forward<Args>(args)...);
     }
 
 protected:
     template<typename ... Args>
-    void Log(const std::string categaryName, spdlog::level::level_enum lvl, spdlog::string_view_t fmt, Args&&... args)
+    void Log(std::string_view categoryName, spdlog::level::level_enum lvl, spdlog::string_view_t fmt, Args&&... args)
     {
-        auto pLogger = spdlog::get(categaryName);
+        if (!ShouldLog(lvl))
+        {
+            return;
+        }
+
+        if (auto* pAsyncBackend = m_pAsyncBackend.load(std::memory_order_acquire))
+        {
+            pAsyncBackend->Push(categoryName, lvl, std::string_view(fmt.data(), fmt.size()), args...);
+            return;
+        }
+
+        const std::string name(categoryName);
+        auto pLogger = spdlog::get(name);
         if (!pLogger)
         {
-            AddCategory(categaryName);
+            AddCategory(name);
+
+            pLogger = spdlog::get(name);
+        }
+
+        WriteSync(pLogger.get(), lvl, fmt, std::forward<Args>(args)...);
+    }
+
+    template<spdlog::level::level_enum Level, spdlog::level::level_enum MinLevel, typename ... Args>
+    void Log(const LogCategory<MinLevel>& rfCategory, LogFormat fmt, Args&&... args)
+    {
+        if constexpr (LogCategory<MinLevel>::template IsCompiledIn<Level>())
+        {
+            if (!ShouldLog(Level))
+            {
+                return;
+            }
 
-            pLogger = spdlog::get(categaryName);
+            if (auto* pAsyncBackend = m_pAsyncBackend.load(std::memory_order_acquire))
+            {
+                pAsyncBackend->PushRecord(ResolveAsyncCategoryId(rfCategory, *pAsyncBackend), Level, fmt, args...);
+                return;
+            }
+
+            WriteSync(ResolveLogger(rfCategory), Level, spdlog::string_view_t(fmt.Text.data(), fmt.Text.size()), std::forward<Args>(args)...);
         }
+    }
 
+    // 레벨 확인 → 호출 위치 허용 여부 순 (걸러진 레벨은 토큰을 쓰지 않는다).
+    template<spdlog::level::level_enum Level, spdlog::level::level_enum MinLevel, LogSite Site, typename ... Args>
+    void Log(const LogCategory<MinLevel>& rfCategory, Site& rfSite, LogFormat fmt, Args&&... args)
+    {
+        if constexpr (LogCategory<MinLevel>::template IsCompiledIn<Level>())
+        {
+            if (!ShouldLog(Level))
+            {
+                return;
+            }
+
+            const LogSiteAdmission admission = rfSite.Admit();
+            if (!admission.bAdmitted)
+            {
+                return;
+            }
+
+            if (admission.SuppressedSinceLast > 0)
+            {
+                Log<Level>(rfCategory, "{} similar messages suppressed ({})", admission.SuppressedSinceLast, rfSite.GetName());
+            }
+
+            Log<Level>(rfCategory, fmt, std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename ... Args>
+    void WriteSync(spdlog::logger* pLogger, spdlog::level::level_enum lvl, spdlog::string_view_t fmt, Args&&... args)
+    {
         if (pLogger)
         {
             pLogger->log(lvl, spdlog::fmt_lib::runtime(fmt), args...);
@@ -84,6 +313,21 @@ protected:
 private:
     void AddCategory(const std::string& categoryName);
 
+    std::uint16_t ResolveAsyncCategoryId(const LogCategoryBase& rfCategory, AsyncLogBackend& rfBackend)
+    {
+        const std::uint32_t cached = rfCategory.m_AsyncCategoryId.load(std::memory_order_relaxed);
+        if (cached != 0)
+        {
+            return static_cast<std::uint16_t>(cached - 1);
+        }
+
+        const std::uint16_t categoryId = rfBackend.RegisterCategory(rfCategory.GetName());
+        rfCategory.m_AsyncCategoryId.store(categoryId + 1u, std::memory_order_relaxed);
+        return categoryId;
+    }
+
+    spdlog::logger* ResolveLogger(const LogCategoryBase& rfCategory);
+
 private:
     RWLock m_Lock;
 
@@ -99,6 +343,13 @@ private:
     std::unordered_set<std::string> m_Categories;
 
     std::shared_ptr<spdlog::logger> m_pConsoleLogger;
+
+    // Create 전에는 모두 통과 (spdlog 기본 동작과 동일).
+    std::atomic<spdlog::level::level_enum> m_Level{ spdlog::level::trace };
+
+    // 비동기 백엔드. 한 번 켜면 프로세스 종료까지 유지 (Shutdown 은 정지만).
+    std::unique_ptr<AsyncLogBackend> m_pAsyncBackendOwner;
+    std::atomic<AsyncLogBackend*> m_pAsyncBackend{ nullptr };
 };
 
 } // namespace LibCommons
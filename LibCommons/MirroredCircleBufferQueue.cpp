@@ -0,0 +1,194 @@
+﻿module;
+
+#if defined(_WIN32)
+#include <Windows.h>
+#pragma comment(lib, "onecore.lib") // VirtualAlloc2, MapViewOfFile3
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+// TimerQueue.cpp 와 동일: Logger 가변 템플릿 인스턴스화를 위해 spdlog 를 GMF 에서 가시화.
+#include <spdlog/spdlog.h>
+
+module commons.buffers.mirrored_circle_buffer_queue;
+
+import std;
+import commons.logger;
+
+namespace LibCommons::Buffers
+{
+
+namespace
+{
+
+constexpr const char* kLogCategory = "MirroredCircleBufferQueue";
+
+size_t GetMappingGranularity() noexcept
+{
+#if defined(_WIN32)
+    SYSTEM_INFO systemInfo{};
+    ::GetSystemInfo(&systemInfo);
+    return static_cast<size_t>(systemInfo.dwAllocationGranularity);
+#else
+    return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+} // namespace
+
+MirroredCircleBufferQueue::MirroredCircleBufferQueue(size_t capacity)
+{
+    if (capacity > 0 && !MapMirrored(capacity))
+    {
+        LibCommons::Logger::GetInstance().LogError(kLogCategory,
+            "MirroredCircleBufferQueue() mirrored mapping failed. Requested Size : {}", capacity);
+    }
+}
+
+MirroredCircleBufferQueue::~MirroredCircleBufferQueue()
+{
+    UnmapMirrored();
+}
+
+#if defined(_WIN32)
+
+bool MirroredCircleBufferQueue::MapMirrored(size_t requestedCapacity)
+{
+    const size_t granularity = GetMappingGranularity();
+    const size_t capacity = ((requestedCapacity + granularity - 1) / granularity) * granularity;
+
+    // 1) 2 * capacity 크기의 placeholder 예약 후 절반으로 분할.
+    auto* pPlaceholder = static_cast<std::byte*>(::VirtualAlloc2(
+        nullptr, nullptr, capacity * 2,
+        MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS, nullptr, 0));
+    if (nullptr == pPlaceholder)
+    {
+        return false;
+    }
+
+    if (!::VirtualFree(pPlaceholder, capacity, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER))
+    {
+        ::VirtualFree(pPlaceholder, 0, MEM_RELEASE);
+        return false;
+    }
+
+    // 2) pagefile-backed section 생성.
+    const auto sectionSize = static_cast<unsigned long long>(capacity);
+    HANDLE hSection = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(sectionSize >> 32), static_cast<DWORD>(sectionSize & 0xFFFFFFFFull), nullptr);
+    if (nullptr == hSection)
+    {
+        ::VirtualFree(pPlaceholder, 0, MEM_RELEASE);
+        ::VirtualFree(pPlaceholder + capacity, 0, MEM_RELEASE);
+        return false;
+    }
+
+    // 3) 두 placeholder 를 같은 section 의 뷰로 교체.
+    void* pFirstView = ::MapViewOfFile3(hSection, nullptr, pPlaceholder, 0, capacity,
+        MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    if (nullptr == pFirstView)
+    {
+        ::CloseHandle(hSection);
+        ::VirtualFree(pPlaceholder, 0, MEM_RELEASE);
+        ::VirtualFree(pPlaceholder + capacity, 0, MEM_RELEASE);
+        return false;
+    }
+
+    void* pSecondView = ::MapViewOfFile3(hSection, nullptr, pPlaceholder + capacity, 0, capacity,
+        MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    if (nullptr == pSecondView)
+    {
+        ::UnmapViewOfFile(pFirstView);
+        ::CloseHandle(hSection);
+        ::VirtualFree(pPlaceholder + capacity, 0, MEM_RELEASE);
+        return false;
+    }
+
+    m_pBase = pPlaceholder;
+    m_hSection = hSection;
+    m_Capacity = capacity;
+    return true;
+}
+
+void MirroredCircleBufferQueue::UnmapMirrored() noexcept
+{
+    if (nullptr == m_pBase)
+    {
+        return;
+    }
+
+    ::UnmapViewOfFile(m_pBase);
+    ::UnmapViewOfFile(m_pBase + m_Capacity);
+    ::CloseHandle(static_cast<HANDLE>(m_hSection));
+
+    m_pBase = nullptr;
+    m_hSection = nullptr;
+    m_Capacity = 0;
+}
+
+#else
+
+bool MirroredCircleBufferQueue::MapMirrored(size_t requestedCapacity)
+{
+    const size_t granularity = GetMappingGranularity();
+    const size_t capacity = ((requestedCapacity + granularity - 1) / granularity) * granularity;
+
+    // 1) 익명 메모리 파일 생성.
+    const int fd = ::memfd_create("fastport_ring", MFD_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(capacity)) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    // 2) 2 * capacity 주소 공간 예약.
+    void* pReserved = ::mmap(nullptr, capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == pReserved)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    auto* pBase = static_cast<std::byte*>(pReserved);
+
+    // 3) 예약 영역 앞/뒤 절반에 같은 파일을 고정 매핑.
+    void* pFirst = ::mmap(pBase, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void* pSecond = MAP_FAILED != pFirst
+        ? ::mmap(pBase + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)
+        : MAP_FAILED;
+
+    // 매핑이 fd 참조를 유지하므로 즉시 닫아도 된다.
+    ::close(fd);
+
+    if (MAP_FAILED == pFirst || MAP_FAILED == pSecond)
+    {
+        ::munmap(pBase, capacity * 2);
+        return false;
+    }
+
+    m_pBase = pBase;
+    m_Capacity = capacity;
+    return true;
+}
+
+void MirroredCircleBufferQueue::UnmapMirrored() noexcept
+{
+    if (nullptr == m_pBase)
+    {
+        return;
+    }
+
+    ::munmap(m_pBase, m_Capacity * 2);
+
+    m_pBase = nullptr;
+    m_Capacity = 0;
+}
+
+#endif
+
+} // namespace LibCommons::Buffers
@@ -0,0 +1,250 @@
+﻿module;
+
+#include <vector>
+#include <cstring>
+
+export module commons.buffers.mirrored_circle_buffer_queue;
+
+import std;
+import commons.rwlock;
+import commons.buffers.ibuffer;
+
+namespace LibCommons::Buffers
+{
+
+/**
+ * 가상 메모리 미러링("magic ring") 원형 버퍼 큐.
+ *
+ * 동일한 물리 페이지를 [Base, Base+Capacity) 와 [Base+Capacity, Base+2*Capacity) 에
+ * 연속으로 두 번 매핑한다. 따라서 임의 오프셋에서 Capacity 이하 길이의 접근은 항상
+ * 하나의 연속 메모리이며, GetReadBuffers / AllocateWrite / GetWriteableBuffers 는
+ * 항상 정확히 1개의 span 을 반환한다 (Wrap-around 분할 없음).
+ *
+ * - Windows : VirtualAlloc2 placeholder + CreateFileMapping + MapViewOfFile3
+ * - Linux   : memfd_create + 이중 mmap(MAP_FIXED)
+ *
+ * Capacity 는 OS 매핑 단위(Windows 할당 단위 64KB, Linux 페이지 크기)로 올림된다.
+ * 매핑에 실패하면 IsValid() 가 false 이고 모든 쓰기가 실패한다.
+ * 스레드 안전성은 CircleBufferQueue 와 동일 (RWLock).
+ */
+export class MirroredCircleBufferQueue final : public IBuffer
+{
+public:
+    // capacity 는 매핑 단위로 올림된다. 실제 크기는 GetCapacity() 로 확인.
+    explicit MirroredCircleBufferQueue(size_t capacity);
+
+    ~MirroredCircleBufferQueue() override;
+
+    MirroredCircleBufferQueue(const MirroredCircleBufferQueue&) = delete;
+    MirroredCircleBufferQueue& operator=(const MirroredCircleBufferQueue&) = delete;
+
+    // 이중 매핑 성공 여부.
+    bool IsValid() const noexcept { return m_pBase != nullptr; }
+
+    // 올림 적용 후 실제 용량.
+    size_t GetCapacity() const noexcept { return m_Capacity; }
+
+    // 버퍼에 데이터를 씁니다.
+    bool Write(std::span<const std::byte> data) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        const size_t size = data.size();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        if (m_Capacity - m_Size < size)
+        {
+            return false;
+        }
+
+        std::memcpy(m_pBase + m_Head, data.data(), size);
+        AdvanceHead(size);
+        return true;
+    }
+
+    // 버퍼에서 데이터를 읽고 제거합니다.
+    bool Pop(std::span<std::byte> outBuffer) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        const size_t size = outBuffer.size();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        if (m_Size < size)
+        {
+            return false;
+        }
+
+        std::memcpy(outBuffer.data(), m_pBase + m_Tail, size);
+        AdvanceTail(size);
+        return true;
+    }
+
+    // 버퍼에서 데이터를 읽기만 하고 제거하지 않습니다.
+    bool Peek(std::span<std::byte> outBuffer) override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+
+        const size_t size = outBuffer.size();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        if (m_Size < size)
+        {
+            return false;
+        }
+
+        std::memcpy(outBuffer.data(), m_pBase + m_Tail, size);
+        return true;
+    }
+
+    // 읽을 수 있는 데이터를 항상 1개의 연속 span 으로 반환합니다.
+    size_t GetReadBuffers(std::vector<std::span<const std::byte>>& outBuffers) override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+
+        outBuffers.clear();
+        if (m_Size == 0)
+        {
+            return 0;
+        }
+
+        outBuffers.emplace_back(m_pBase + m_Tail, m_Size);
+        return m_Size;
+    }
+
+    // 쓰기 공간을 1개의 연속 span 으로 예약하고 Head 를 이동합니다.
+    bool AllocateWrite(size_t size, std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        outBuffers.clear();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        if (m_Capacity - m_Size < size)
+        {
+            return false;
+        }
+
+        outBuffers.emplace_back(m_pBase + m_Head, size);
+        AdvanceHead(size);
+        return true;
+    }
+
+    // 읽기 포인터(Tail)를 이동시켜 데이터를 제거합니다.
+    bool Consume(size_t size) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        if (m_Size < size)
+        {
+            return false;
+        }
+
+        AdvanceTail(size);
+        return true;
+    }
+
+    size_t CanReadSize() const override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+        return m_Size;
+    }
+
+    size_t CanWriteSize() const override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+        return m_Capacity - m_Size;
+    }
+
+    void Clear() override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+        m_Head = 0;
+        m_Tail = 0;
+        m_Size = 0;
+    }
+
+    // 현재 쓰기 가능한 공간 전체를 1개의 연속 span 으로 반환합니다. Head 는 이동하지 않음.
+    size_t GetWriteableBuffers(std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+
+        outBuffers.clear();
+        const size_t freeSpace = m_Capacity - m_Size;
+        if (freeSpace == 0)
+        {
+            return 0;
+        }
+
+        outBuffers.emplace_back(m_pBase + m_Head, freeSpace);
+        return freeSpace;
+    }
+
+    bool CommitWrite(size_t size) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        if (m_Capacity - m_Size < size)
+        {
+            return false;
+        }
+
+        AdvanceHead(size);
+        return true;
+    }
+
+private:
+    void AdvanceHead(size_t size) noexcept
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        m_Head = (m_Head + size) % m_Capacity;
+        m_Size += size;
+    }
+
+    void AdvanceTail(size_t size) noexcept
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        m_Tail = (m_Tail + size) % m_Capacity;
+        m_Size -= size;
+    }
+
+    // 이중 매핑 생성/해제 (플랫폼별 구현은 MirroredCircleBufferQueue.cpp).
+    bool MapMirrored(size_t requestedCapacity);
+    void UnmapMirrored() noexcept;
+
+private:
+    // 미러링 영역 시작 주소. 길이 2 * m_Capacity.
+    std::byte* m_pBase = nullptr;
+
+#if defined(_WIN32)
+    // 파일 매핑(section) 핸들. 소멸 시 뷰 해제 후 닫는다.
+    void* m_hSection = nullptr;
+#endif
+
+    size_t m_Head = 0;
+    size_t m_Tail = 0;
+    size_t m_Size = 0;
+    size_t m_Capacity = 0;
+
+    mutable RWLock m_RWLock;
+};
+
+} // namespace LibCommons::Buffers
@@ -0,0 +1,282 @@
+﻿module;
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+
+export module commons.buffers.spsc_circle_buffer_queue;
+
+import std;
+import commons.buffers.ibuffer;
+import commons.buffers.slab_pool;
+
+namespace LibCommons::Buffers
+{
+
+/**
+ * 단일 생산자 / 단일 소비자(SPSC) 전용 lock-free 원형 버퍼 큐.
+ *
+ * Head(생산자 전용)/Tail(소비자 전용) 을 단조 증가 카운터로 관리하고
+ * acquire/release 순서로 상대편에 공개한다. 읽기/쓰기 경로에 락과 로그가 없다.
+ *
+ * [Thread Safety]
+ * - 생산자 스레드 : Write, AllocateWrite, GetWriteableBuffers, CommitWrite
+ * - 소비자 스레드 : Pop, Peek, GetReadBuffers, Consume
+ * - CanReadSize/CanWriteSize 는 어느 쪽에서도 호출 가능 (근사값).
+ * - Clear 는 생산자/소비자 모두 정지한 상태에서만 호출해야 한다.
+ * 생산자 또는 소비자가 둘 이상이면 CircleBufferQueue 를 사용해야 한다.
+ */
+export class SPSCCircleBufferQueue final : public IBuffer
+{
+public:
+    explicit SPSCCircleBufferQueue(size_t capacity)
+        : m_Capacity(capacity)
+    {
+        if (capacity > 0)
+        {
+            m_Buffer.resize(capacity);
+        }
+    }
+
+    ~SPSCCircleBufferQueue() override = default;
+
+    SPSCCircleBufferQueue(const SPSCCircleBufferQueue&) = delete;
+    SPSCCircleBufferQueue& operator=(const SPSCCircleBufferQueue&) = delete;
+
+    // (생산자) 버퍼에 데이터를 씁니다.
+    bool Write(std::span<const std::byte> data) override
+    {
+        const size_t size = data.size();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        if (m_Capacity - (head - tail) < size)
+        {
+            return false;
+        }
+
+        CopyIn(head, data.data(), size);
+
+        m_Head.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    // (소비자) 버퍼에서 데이터를 읽고 제거합니다.
+    bool Pop(std::span<std::byte> outBuffer) override
+    {
+        const size_t size = outBuffer.size();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        if (head - tail < size)
+        {
+            return false;
+        }
+
+        CopyOut(tail, outBuffer.data(), size);
+
+        m_Tail.store(tail + size, std::memory_order_release);
+        return true;
+    }
+
+    // (소비자) 버퍼에서 데이터를 읽기만 하고 제거하지 않습니다.
+    bool Peek(std::span<std::byte> outBuffer) override
+    {
+        const size_t size = outBuffer.size();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        if (head - tail < size)
+        {
+            return false;
+        }
+
+        CopyOut(tail, outBuffer.data(), size);
+        return true;
+    }
+
+    // (소비자) 읽을 수 있는 연속 블록들을 반환합니다. Consume 전까지 유효.
+    size_t GetReadBuffers(std::vector<std::span<const std::byte>>& outBuffers) override
+    {
+        outBuffers.clear();
+
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        const size_t readable = head - tail;
+        if (readable == 0)
+        {
+            return 0;
+        }
+
+        const size_t readIndex = tail % m_Capacity;
+        const size_t firstPart = std::min(readable, m_Capacity - readIndex);
+        const std::byte* bufferData = m_Buffer.data();
+
+        outBuffers.emplace_back(bufferData + readIndex, firstPart);
+
+        if (readable > firstPart)
+        {
+            outBuffers.emplace_back(bufferData, readable - firstPart);
+        }
+
+        return readable;
+    }
+
+    // (생산자) 쓰기 공간을 예약하고 즉시 Head 를 이동합니다.
+    // 주의: Head 가 먼저 공개되므로, 반환된 버퍼를 채우기 전에 소비자가 읽을 수 있다.
+    //       소비자가 완료 통지 이후에만 읽는 구조(Send 큐)에서만 사용해야 한다.
+    bool AllocateWrite(size_t size, std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        outBuffers.clear();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        if (m_Capacity - (head - tail) < size)
+        {
+            return false;
+        }
+
+        AppendWriteSpans(head, size, outBuffers);
+
+        m_Head.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    // (소비자) 읽기 포인터(Tail)를 이동시켜 데이터를 제거합니다.
+    bool Consume(size_t size) override
+    {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        if (head - tail < size)
+        {
+            return false;
+        }
+
+        m_Tail.store(tail + size, std::memory_order_release);
+        return true;
+    }
+
+    size_t CanReadSize() const override
+    {
+        // Tail 을 먼저 읽어야 head - tail 이 음수가 되지 않는다 (Head 는 단조 증가).
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+        return std::min(head - tail, m_Capacity);
+    }
+
+    size_t CanWriteSize() const override
+    {
+        return m_Capacity - CanReadSize();
+    }
+
+    // 생산자/소비자 모두 정지한 상태에서만 호출.
+    void Clear() override
+    {
+        m_Head.store(0, std::memory_order_relaxed);
+        m_Tail.store(0, std::memory_order_release);
+    }
+
+    // (생산자) 현재 쓰기 가능한 모든 연속 블록을 반환합니다. Head 는 이동하지 않음.
+    size_t GetWriteableBuffers(std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        outBuffers.clear();
+
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        const size_t freeSpace = m_Capacity - (head - tail);
+        if (freeSpace == 0)
+        {
+            return 0;
+        }
+
+        AppendWriteSpans(head, freeSpace, outBuffers);
+        return freeSpace;
+    }
+
+    // (생산자) GetWriteableBuffers 이후 실제로 쓴 크기만큼 Head 를 공개합니다.
+    bool CommitWrite(size_t size) override
+    {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        if (m_Capacity - (head - tail) < size)
+        {
+            return false;
+        }
+
+        m_Head.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+private:
+    void CopyIn(size_t head, const std::byte* pSrc, size_t size)
+    {
+        const size_t writeIndex = head % m_Capacity;
+        const size_t firstPart = std::min(size, m_Capacity - writeIndex);
+
+        std::memcpy(m_Buffer.data() + writeIndex, pSrc, firstPart);
+
+        if (size > firstPart)
+        {
+            std::memcpy(m_Buffer.data(), pSrc + firstPart, size - firstPart);
+        }
+    }
+
+    void CopyOut(size_t tail, std::byte* pDest, size_t size) const
+    {
+        const size_t readIndex = tail % m_Capacity;
+        const size_t firstPart = std::min(size, m_Capacity - readIndex);
+
+        std::memcpy(pDest, m_Buffer.data() + readIndex, firstPart);
+
+        if (size > firstPart)
+        {
+            std::memcpy(pDest + firstPart, m_Buffer.data(), size - firstPart);
+        }
+    }
+
+    void AppendWriteSpans(size_t head, size_t size, std::vector<std::span<std::byte>>& outBuffers)
+    {
+        const size_t writeIndex = head % m_Capacity;
+        const size_t firstPart = std::min(size, m_Capacity - writeIndex);
+        std::byte* bufferData = m_Buffer.data();
+
+        outBuffers.emplace_back(bufferData + writeIndex, firstPart);
+
+        if (size > firstPart)
+        {
+            outBuffers.emplace_back(bufferData, size - firstPart);
+        }
+    }
+
+private:
+    // 캐시 라인 분리: 생산자(Head)와 소비자(Tail)가 서로의 라인을 무효화하지 않도록 한다.
+    static constexpr size_t kCacheLineSize = 64;
+
+    // 64KB 이하 용량은 SlabPool 의 size class 에서.
+    SlabVector<std::byte> m_Buffer;
+    size_t m_Capacity = 0;
+
+    // 누적 쓰기 바이트 (생산자만 store).
+    alignas(kCacheLineSize) std::atomic<size_t> m_Head { 0 };
+    // 누적 읽기 바이트 (소비자만 store).
+    alignas(kCacheLineSize) std::atomic<size_t> m_Tail { 0 };
+};
+
+} // namespace LibCommons::Buffers
@@ -0,0 +1,346 @@
+﻿module;
+
+#include <vector>
+#include <deque>
+#include <cstring>
+
+export module commons.buffers.segmented_buffer;
+
+import std;
+import commons.rwlock;
+import commons.buffers.ibuffer;
+import commons.buffers.slab_pool;
+
+namespace LibCommons::Buffers
+{
+
+/**
+ * 고정 크기 chunk 를 이어 붙여 늘어나는 버퍼.
+ *
+ * - chunk 는 SlabPool 에서 빌린다 (chunkSize 가 SlabPool::kMaxSlabSize 이하면 스레드 캐시 경로).
+ * - 쓸 공간이 모자라면 chunk 를 뒤에 추가하고, maxCapacity (chunk 개수 상한) 에서 실패한다.
+ * - 읽어서 빈 chunk 는 바로 반환하고, 데이터가 0 이 되면 chunk 를 모두 반환한다.
+ *   상주 메모리는 최악 버스트가 아니라 현재 적재량에 비례한다.
+ * - chunkSize 이하 AllocateWrite 는 항상 1개의 span — 남은 tail 이 모자라면 새 chunk 에서 시작한다
+ *   (tail 잔여 공간은 버림). 그보다 큰 요청은 여러 chunk 에 걸친 span 들로 나뉜다.
+ * - GetReadBuffers 는 chunk 마다 1개의 span (gather 송신).
+ *
+ * [Thread Safety] CircleBufferQueue 와 동일 (RWLock). 반환된 span 은 chunk 메모리를 직접 가리키며,
+ *   Consume 으로 해당 데이터가 소비되기 전까지 유효하다.
+ */
+export class SegmentedBuffer final : public IBuffer
+{
+public:
+    // maxCapacity 는 chunkSize 단위로 올림된다.
+    SegmentedBuffer(size_t chunkSize, size_t maxCapacity)
+        : m_ChunkSize(chunkSize),
+          m_MaxChunkCount((std::max)((maxCapacity + chunkSize - 1) / chunkSize, size_t{ 1 }))
+    {
+    }
+
+    ~SegmentedBuffer() override
+    {
+        ReleaseAll();
+    }
+
+    SegmentedBuffer(const SegmentedBuffer&) = delete;
+    SegmentedBuffer& operator=(const SegmentedBuffer&) = delete;
+
+    size_t GetChunkSize() const noexcept { return m_ChunkSize; }
+    size_t GetMaxCapacity() const noexcept { return m_ChunkSize * m_MaxChunkCount; }
+
+    size_t GetChunkCount() const
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+        return m_Chunks.size();
+    }
+
+    bool Write(std::span<const std::byte> data) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        size_t remaining = data.size();
+        if (FreeSpace() < remaining)
+        {
+            return false;
+        }
+
+        const std::byte* pSource = data.data();
+        while (remaining > 0)
+        {
+            if (TailFree() == 0)
+            {
+                AppendChunk();
+            }
+
+            auto& rfTail = m_Chunks.back();
+            const size_t size = (std::min)(remaining, m_ChunkSize - rfTail.End);
+            std::memcpy(rfTail.pData + rfTail.End, pSource, size);
+            rfTail.End += size;
+            pSource += size;
+            remaining -= size;
+        }
+
+        m_Size += data.size();
+        return true;
+    }
+
+    bool Pop(std::span<std::byte> outBuffer) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        if (m_Size < outBuffer.size())
+        {
+            return false;
+        }
+
+        CopyOut(outBuffer);
+        return ConsumeUnlocked(outBuffer.size());
+    }
+
+    bool Peek(std::span<std::byte> outBuffer) override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+
+        if (m_Size < outBuffer.size())
+        {
+            return false;
+        }
+
+        CopyOut(outBuffer);
+        return true;
+    }
+
+    size_t GetReadBuffers(std::vector<std::span<const std::byte>>& outBuffers) override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+
+        outBuffers.clear();
+        size_t readOffset = m_ReadOffset;
+        for (const auto& rfChunk : m_Chunks)
+        {
+            if (rfChunk.End > readOffset)
+            {
+                outBuffers.emplace_back(rfChunk.pData + readOffset, rfChunk.End - readOffset);
+            }
+            readOffset = 0;
+        }
+        return m_Size;
+    }
+
+    bool AllocateWrite(size_t size, std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        outBuffers.clear();
+        if (size == 0)
+        {
+            return true;
+        }
+
+        // chunk 하나에 들어가는 크기는 단일 span 으로 — tail 이 모자라면 새 chunk 에서 시작.
+        if (size <= m_ChunkSize && TailFree() < size)
+        {
+            if (m_Chunks.size() >= m_MaxChunkCount)
+            {
+                return false;
+            }
+            AppendChunk();
+        }
+
+        if (FreeSpace() < size)
+        {
+            return false;
+        }
+
+        size_t remaining = size;
+        while (remaining > 0)
+        {
+            if (TailFree() == 0)
+            {
+                AppendChunk();
+            }
+
+            auto& rfTail = m_Chunks.back();
+            const size_t part = (std::min)(remaining, m_ChunkSize - rfTail.End);
+            outBuffers.emplace_back(rfTail.pData + rfTail.End, part);
+            rfTail.End += part;
+            remaining -= part;
+        }
+
+        m_Size += size;
+        return true;
+    }
+
+    // tail chunk 의 남은 공간 1개를 반환. 남은 공간이 chunk 의 1/4 미만이면 새 chunk 로 넘어간다.
+    size_t GetWriteableBuffers(std::vector<std::span<std::byte>>& outBuffers) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        outBuffers.clear();
+        if (TailFree() < m_ChunkSize / 4 && m_Chunks.size() < m_MaxChunkCount)
+        {
+            AppendChunk();
+        }
+
+        const size_t freeSpace = TailFree();
+        if (freeSpace == 0)
+        {
+            return 0;
+        }
+
+        auto& rfTail = m_Chunks.back();
+        outBuffers.emplace_back(rfTail.pData + rfTail.End, freeSpace);
+        return freeSpace;
+    }
+
+    bool CommitWrite(size_t size) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+
+        if (TailFree() < size)
+        {
+            return false;
+        }
+
+        if (size > 0)
+        {
+            m_Chunks.back().End += size;
+            m_Size += size;
+        }
+        else if (m_Size == 0)
+        {
+            // 빈 수신 — GetWriteableBuffers 에서 붙인 chunk 를 돌려준다.
+            ReleaseAll();
+        }
+        return true;
+    }
+
+    bool Consume(size_t size) override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+        return ConsumeUnlocked(size);
+    }
+
+    size_t CanReadSize() const override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+        return m_Size;
+    }
+
+    // 상한까지 추가로 쓸 수 있는 크기 (tail 건너뛰기로 실제로는 이보다 작을 수 있음).
+    size_t CanWriteSize() const override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+        return FreeSpace();
+    }
+
+    size_t GetResidentBytes() const override
+    {
+        auto lock = LibCommons::ReadLockBlock(m_RWLock);
+        return m_Chunks.size() * m_ChunkSize;
+    }
+
+    void Clear() override
+    {
+        auto lock = LibCommons::WriteLockBlock(m_RWLock);
+        ReleaseAll();
+    }
+
+private:
+    struct Chunk
+    {
+        std::byte* pData = nullptr;
+        size_t End = 0;  // 유효 데이터 끝 (tail chunk 는 쓰기 위치)
+    };
+
+    size_t TailFree() const noexcept
+    {
+        return m_Chunks.empty() ? 0 : m_ChunkSize - m_Chunks.back().End;
+    }
+
+    size_t FreeSpace() const noexcept
+    {
+        return TailFree() + (m_MaxChunkCount - m_Chunks.size()) * m_ChunkSize;
+    }
+
+    void AppendChunk()
+    {
+        m_Chunks.push_back(Chunk{ static_cast<std::byte*>(SlabPool::Allocate(m_ChunkSize)), 0 });
+    }
+
+    void ReleaseFront() noexcept
+    {
+        SlabPool::Deallocate(m_Chunks.front().pData);
+        m_Chunks.pop_front();
+        m_ReadOffset = 0;
+    }
+
+    void ReleaseAll() noexcept
+    {
+        for (auto& rfChunk : m_Chunks)
+        {
+            SlabPool::Deallocate(rfChunk.pData);
+        }
+        m_Chunks.clear();
+        m_ReadOffset = 0;
+        m_Size = 0;
+    }
+
+    void CopyOut(std::span<std::byte> outBuffer) const
+    {
+        std::byte* pDest = outBuffer.data();
+        size_t remaining = outBuffer.size();
+        size_t readOffset = m_ReadOffset;
+        for (auto it = m_Chunks.begin(); remaining > 0; ++it)
+        {
+            const size_t size = (std::min)(remaining, it->End - readOffset);
+            std::memcpy(pDest, it->pData + readOffset, size);
+            pDest += size;
+            remaining -= size;
+            readOffset = 0;
+        }
+    }
+
+    bool ConsumeUnlocked(size_t size)
+    {
+        if (m_Size < size)
+        {
+            return false;
+        }
+
+        m_Size -= size;
+        if (m_Size == 0)
+        {
+            ReleaseAll();
+            return true;
+        }
+
+        while (size > 0)
+        {
+            auto& rfFront = m_Chunks.front();
+            const size_t part = (std::min)(size, rfFront.End - m_ReadOffset);
+            m_ReadOffset += part;
+            size -= part;
+
+            // 다 읽은 chunk 는 뒤에 chunk 가 있을 때만 반환 (tail 은 계속 쓰는 중).
+            if (m_ReadOffset == rfFront.End && m_Chunks.size() > 1)
+            {
+                ReleaseFront();
+            }
+        }
+        return true;
+    }
+
+private:
+    const size_t m_ChunkSize;
+    const size_t m_MaxChunkCount;
+
+    std::deque<Chunk> m_Chunks;
+    size_t m_ReadOffset = 0;  // front chunk 안의 읽기 위치
+    size_t m_Size = 0;
+
+    mutable LibCommons::RWLock m_RWLock;
+};
+
+} // namespace LibCommons::Buffers
@@ -0,0 +1,525 @@
+﻿module;
+
+#include <cstdint>
+
+module commons.buffers.slab_pool;
+
+import std;
+
+namespace LibCommons::Buffers
+{
+
+namespace
+{
+
+struct ThreadCache;
+
+// 블록 앞 16 바이트 헤더. 사용 중에는 소유 캐시, free list 에 있을 때는 다음 블록을 가리킨다.
+struct BlockHeader
+{
+    union
+    {
+        ThreadCache* pOwner;
+        BlockHeader* pNext;
+    };
+    std::uint32_t ClassIndex;
+    std::uint32_t Reserved;
+};
+static_assert(sizeof(BlockHeader) == SlabPool::kAlignment);
+
+// slab 앞 헤더. 블록이 모두 depot 에 있는 동안만 depot 의 해제 후보 목록에 연결된다.
+struct alignas(SlabPool::kAlignment) SlabHeader
+{
+    SlabHeader* pPrev = nullptr;
+    SlabHeader* pNext = nullptr;
+    std::size_t InDepot = 0;  // depot 에 있는 이 slab 의 블록 수
+};
+
+// size class 밖 (operator new 직행) 블록 표식.
+constexpr std::uint32_t kDirectClass = static_cast<std::uint32_t>(SlabPool::kSizeClassCount);
+
+// 매거진이 class 당 보관하는 상한 — 약 1MB, 작은 class 는 256 개.
+constexpr std::size_t kMagazineBytes = 1024 * 1024;
+constexpr std::size_t kMaxMagazineCount = 256;
+constexpr std::size_t kMinMagazineCount = 8;
+
+constexpr std::size_t MagazineCapacity(std::size_t classIndex)
+{
+    return (std::clamp)(kMagazineBytes / SlabPool::kSizeClasses[classIndex], kMinMagazineCount, kMaxMagazineCount);
+}
+
+// depot 과 주고받는 묶음 크기. 새 slab 도 이만큼씩 자른다.
+constexpr std::size_t BatchCount(std::size_t classIndex)
+{
+    return MagazineCapacity(classIndex) / 2;
+}
+
+constexpr std::size_t Stride(std::size_t classIndex)
+{
+    return sizeof(BlockHeader) + SlabPool::kSizeClasses[classIndex];
+}
+
+constexpr std::size_t SlabBytes(std::size_t classIndex)
+{
+    return sizeof(SlabHeader) + Stride(classIndex) * BatchCount(classIndex);
+}
+
+// depot 이 class 당 보관하는 블록 수의 high-water — 약 4MB. 넘으면 비어 있는 slab 을 해제한다.
+constexpr std::size_t kDepotHighWaterBytes = 4 * 1024 * 1024;
+
+constexpr std::size_t DepotHighWater(std::size_t classIndex)
+{
+    return (std::max)(kDepotHighWaterBytes / SlabPool::kSizeClasses[classIndex], 4 * BatchCount(classIndex));
+}
+
+// 블록 헤더의 Reserved 는 slab 안 순번.
+SlabHeader* SlabOf(BlockHeader* pBlock) noexcept
+{
+    auto* pBytes = reinterpret_cast<std::byte*>(pBlock) - pBlock->Reserved * Stride(pBlock->ClassIndex);
+    return reinterpret_cast<SlabHeader*>(pBytes - sizeof(SlabHeader));
+}
+
+// depot 안에서만 쓰는 이전 블록 링크 — free 블록의 본문 첫 8 바이트.
+BlockHeader*& PrevOf(BlockHeader* pBlock) noexcept
+{
+    return *reinterpret_cast<BlockHeader**>(pBlock + 1);
+}
+
+std::uint32_t ClassIndexOf(std::size_t size) noexcept
+{
+    for (std::uint32_t i = 0; i < SlabPool::kSizeClassCount; ++i)
+    {
+        if (size <= SlabPool::kSizeClasses[i])
+        {
+            return i;
+        }
+    }
+    return kDirectClass;
+}
+
+struct FreeList
+{
+    BlockHeader* pHead = nullptr;
+    std::size_t Count = 0;
+
+    void Push(BlockHeader* pBlock) noexcept
+    {
+        pBlock->pNext = pHead;
+        pHead = pBlock;
+        ++Count;
+    }
+
+    BlockHeader* Pop() noexcept
+    {
+        BlockHeader* pBlock = pHead;
+        pHead = pBlock->pNext;
+        --Count;
+        return pBlock;
+    }
+
+    // 앞에서 count 개를 떼어 낸다.
+    FreeList Split(std::size_t count) noexcept
+    {
+        FreeList taken;
+        while (taken.Count < count && pHead)
+        {
+            taken.Push(Pop());
+        }
+        return taken;
+    }
+};
+
+// 스레드 캐시. 스레드가 끝나면 orphan 목록으로 가고 다음 스레드가 이어받는다 (해제하지 않음 —
+// 살아 있는 블록의 pOwner 가 계속 가리키므로).
+struct ThreadCache
+{
+    // 소유 스레드 전용.
+    std::array<FreeList, SlabPool::kSizeClassCount> Magazines{};
+
+    // 소유 스레드만 갱신, GetStats 가 relaxed 로 읽는다.
+    std::atomic<std::uint64_t> Hits { 0 };
+    std::atomic<std::uint64_t> Misses { 0 };
+
+    // 다른 스레드가 반환한 블록 (class 혼재). push 는 CAS, 회수는 exchange 로 통째로 — ABA 없음.
+    alignas(64) std::atomic<BlockHeader*> RemoteHead { nullptr };
+    std::atomic<std::uint64_t> RemoteFrees { 0 };
+};
+
+// class 별 공용 free 블록. 블록은 이중 연결 (특정 slab 의 블록만 떼어 낼 수 있게),
+// 블록이 모두 돌아온 slab 은 해제 후보 목록에 둔다. 모든 접근은 Mutex 아래.
+struct Depot
+{
+    std::mutex Mutex;
+    BlockHeader* pHead = nullptr;
+    std::size_t Count = 0;
+    SlabHeader* pFreeSlabs = nullptr;
+
+    void LinkSlab(SlabHeader* pSlab) noexcept
+    {
+        pSlab->pPrev = nullptr;
+        pSlab->pNext = pFreeSlabs;
+        if (pFreeSlabs)
+        {
+            pFreeSlabs->pPrev = pSlab;
+        }
+        pFreeSlabs = pSlab;
+    }
+
+    void UnlinkSlab(SlabHeader* pSlab) noexcept
+    {
+        if (pSlab->pPrev)
+        {
+            pSlab->pPrev->pNext = pSlab->pNext;
+        }
+        else
+        {
+            pFreeSlabs = pSlab->pNext;
+        }
+        if (pSlab->pNext)
+        {
+            pSlab->pNext->pPrev = pSlab->pPrev;
+        }
+    }
+
+    void UnlinkBlock(BlockHeader* pBlock) noexcept
+    {
+        BlockHeader* pPrev = PrevOf(pBlock);
+        BlockHeader* pNext = pBlock->pNext;
+        if (pPrev)
+        {
+            pPrev->pNext = pNext;
+        }
+        else
+        {
+            pHead = pNext;
+        }
+        if (pNext)
+        {
+            PrevOf(pNext) = pPrev;
+        }
+        --Count;
+    }
+
+    void Push(BlockHeader* pBlock, std::size_t classIndex) noexcept
+    {
+        pBlock->pNext = pHead;
+        PrevOf(pBlock) = nullptr;
+        if (pHead)
+        {
+            PrevOf(pHead) = pBlock;
+        }
+        pHead = pBlock;
+        ++Count;
+
+        SlabHeader* pSlab = SlabOf(pBlock);
+        if (++pSlab->InDepot == BatchCount(classIndex))
+        {
+            LinkSlab(pSlab);
+        }
+    }
+
+    BlockHeader* Pop(std::size_t classIndex) noexcept
+    {
+        BlockHeader* pBlock = pHead;
+        UnlinkBlock(pBlock);
+
+        SlabHeader* pSlab = SlabOf(pBlock);
+        if (pSlab->InDepot-- == BatchCount(classIndex))
+        {
+            UnlinkSlab(pSlab);
+        }
+        return pBlock;
+    }
+
+    // high-water 를 넘는 동안 해제 후보 slab 을 떼어 내 pReleased 로 잇는다 (해제는 락 밖에서).
+    SlabHeader* TakeReleasableSlabs(std::size_t classIndex) noexcept
+    {
+        SlabHeader* pReleased = nullptr;
+        while (Count > DepotHighWater(classIndex) && pFreeSlabs)
+        {
+            SlabHeader* pSlab = pFreeSlabs;
+            UnlinkSlab(pSlab);
+
+            auto* pBlocks = reinterpret_cast<std::byte*>(pSlab + 1);
+            for (std::size_t i = 0; i < BatchCount(classIndex); ++i)
+            {
+                UnlinkBlock(reinterpret_cast<BlockHeader*>(pBlocks + i * Stride(classIndex)));
+            }
+
+            pSlab->pNext = pReleased;
+            pReleased = pSlab;
+        }
+        return pReleased;
+    }
+};
+
+struct Registry
+{
+    std::mutex Mutex;
+    std::vector<ThreadCache*> Caches;
+    std::vector<ThreadCache*> Orphans;
+
+    std::array<Depot, SlabPool::kSizeClassCount> Depots;
+
+    std::atomic<std::uint64_t> DirectAllocs { 0 };
+    std::atomic<std::uint64_t> ReleasedSlabs { 0 };
+    std::atomic<std::size_t> ReservedBytes { 0 };
+    std::atomic<std::size_t> ResidentBytes { 0 };
+};
+
+// 스레드 종료 / 정적 소멸 순서와 무관하게 쓰도록 해제하지 않는다.
+Registry& GetRegistry()
+{
+    static Registry* pRegistry = new Registry();
+    return *pRegistry;
+}
+
+void Bump(std::atomic<std::uint64_t>& rfCounter) noexcept
+{
+    rfCounter.store(rfCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void ReleaseCache(ThreadCache* pCache) noexcept;
+
+struct CacheHolder
+{
+    ThreadCache* pCache = nullptr;
+
+    ~CacheHolder()
+    {
+        if (pCache)
+        {
+            ReleaseCache(pCache);
+        }
+    }
+};
+
+thread_local CacheHolder t_CacheHolder;
+
+// CacheHolder 소멸 이후 (다른 thread_local 소멸자에서) 의 호출 구분. trivially destructible.
+thread_local bool t_bCacheReleased = false;
+
+ThreadCache* CurrentCache()
+{
+    if (t_bCacheReleased)
+    {
+        return nullptr;
+    }
+
+    if (!t_CacheHolder.pCache)
+    {
+        auto& rfRegistry = GetRegistry();
+        std::lock_guard lock(rfRegistry.Mutex);
+        if (!rfRegistry.Orphans.empty())
+        {
+            t_CacheHolder.pCache = rfRegistry.Orphans.back();
+            rfRegistry.Orphans.pop_back();
+        }
+        else
+        {
+            t_CacheHolder.pCache = new ThreadCache();
+            rfRegistry.Caches.push_back(t_CacheHolder.pCache);
+        }
+    }
+    return t_CacheHolder.pCache;
+}
+
+void PushToDepot(std::size_t classIndex, FreeList& rfBlocks) noexcept
+{
+    auto& rfRegistry = GetRegistry();
+    auto& rfDepot = rfRegistry.Depots[classIndex];
+
+    SlabHeader* pReleased = nullptr;
+    {
+        std::lock_guard lock(rfDepot.Mutex);
+        while (rfBlocks.pHead)
+        {
+            rfDepot.Push(rfBlocks.Pop(), classIndex);
+        }
+        pReleased = rfDepot.TakeReleasableSlabs(classIndex);
+    }
+
+    while (pReleased)
+    {
+        SlabHeader* pSlab = std::exchange(pReleased, pReleased->pNext);
+        ::operator delete(pSlab);
+        rfRegistry.ResidentBytes.fetch_sub(SlabBytes(classIndex), std::memory_order_relaxed);
+        rfRegistry.ReleasedSlabs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// 매거진 상한 초과분을 depot 으로.
+void PushLocal(ThreadCache& rfCache, BlockHeader* pBlock) noexcept
+{
+    const std::size_t classIndex = pBlock->ClassIndex;
+    auto& rfMagazine = rfCache.Magazines[classIndex];
+    rfMagazine.Push(pBlock);
+
+    if (rfMagazine.Count > MagazineCapacity(classIndex))
+    {
+        FreeList overflow = rfMagazine.Split(BatchCount(classIndex));
+        PushToDepot(classIndex, overflow);
+    }
+}
+
+void ReleaseCache(ThreadCache* pCache) noexcept
+{
+    t_bCacheReleased = true;
+
+    // 매거진은 다른 스레드가 쓰도록 depot 으로. remote free list 는 이어받는 스레드가 회수.
+    for (std::size_t classIndex = 0; classIndex < SlabPool::kSizeClassCount; ++classIndex)
+    {
+        PushToDepot(classIndex, pCache->Magazines[classIndex]);
+    }
+
+    auto& rfRegistry = GetRegistry();
+    std::lock_guard lock(rfRegistry.Mutex);
+    rfRegistry.Orphans.push_back(pCache);
+}
+
+void DrainRemoteFrees(ThreadCache& rfCache) noexcept
+{
+    BlockHeader* pBlock = rfCache.RemoteHead.exchange(nullptr, std::memory_order_acquire);
+    while (pBlock)
+    {
+        BlockHeader* pNext = pBlock->pNext;
+        PushLocal(rfCache, pBlock);
+        pBlock = pNext;
+    }
+}
+
+// 매거진이 비었을 때: remote free → depot → 새 slab 순으로 채운다. 새 slab 이면 true (miss).
+bool Refill(ThreadCache& rfCache, std::size_t classIndex)
+{
+    auto& rfMagazine = rfCache.Magazines[classIndex];
+
+    DrainRemoteFrees(rfCache);
+    if (rfMagazine.Count > 0)
+    {
+        return false;
+    }
+
+    {
+        auto& rfDepot = GetRegistry().Depots[classIndex];
+        std::lock_guard lock(rfDepot.Mutex);
+        for (std::size_t i = 0; i < BatchCount(classIndex) && rfDepot.pHead; ++i)
+        {
+            rfMagazine.Push(rfDepot.Pop(classIndex));
+        }
+    }
+    if (rfMagazine.Count > 0)
+    {
+        return false;
+    }
+
+    const std::size_t count = BatchCount(classIndex);
+    const std::size_t stride = Stride(classIndex);
+    auto* pSlab = ::new (::operator new(SlabBytes(classIndex))) SlabHeader();
+    GetRegistry().ReservedBytes.fetch_add(SlabBytes(classIndex), std::memory_order_relaxed);
+    GetRegistry().ResidentBytes.fetch_add(SlabBytes(classIndex), std::memory_order_relaxed);
+
+    auto* pBlocks = reinterpret_cast<std::byte*>(pSlab + 1);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* pBlock = reinterpret_cast<BlockHeader*>(pBlocks + i * stride);
+        pBlock->ClassIndex = static_cast<std::uint32_t>(classIndex);
+        pBlock->Reserved = static_cast<std::uint32_t>(i);
+        rfMagazine.Push(pBlock);
+    }
+    return true;
+}
+
+void* AllocateDirect(std::size_t size)
+{
+    auto* pBlock = static_cast<BlockHeader*>(::operator new(sizeof(BlockHeader) + size));
+    pBlock->pOwner = nullptr;
+    pBlock->ClassIndex = kDirectClass;
+    pBlock->Reserved = 0;
+    GetRegistry().DirectAllocs.fetch_add(1, std::memory_order_relaxed);
+    return pBlock + 1;
+}
+
+} // namespace
+
+
+void* SlabPool::Allocate(std::size_t size)
+{
+    const std::uint32_t classIndex = ClassIndexOf(size);
+    if (classIndex == kDirectClass)
+    {
+        return AllocateDirect(size);
+    }
+
+    ThreadCache* pCache = CurrentCache();
+    if (!pCache)
+    {
+        return AllocateDirect(size);
+    }
+
+    auto& rfMagazine = pCache->Magazines[classIndex];
+    if (rfMagazine.Count == 0 && Refill(*pCache, classIndex))
+    {
+        Bump(pCache->Misses);
+    }
+    else
+    {
+        Bump(pCache->Hits);
+    }
+
+    BlockHeader* pBlock = rfMagazine.Pop();
+    pBlock->pOwner = pCache;
+    return pBlock + 1;
+}
+
+void SlabPool::Deallocate(void* p) noexcept
+{
+    if (!p)
+    {
+        return;
+    }
+
+    BlockHeader* pBlock = static_cast<BlockHeader*>(p) - 1;
+    if (pBlock->ClassIndex == kDirectClass)
+    {
+        ::operator delete(pBlock);
+        return;
+    }
+
+    ThreadCache* pOwner = pBlock->pOwner;
+    if (pOwner == CurrentCache())
+    {
+        PushLocal(*pOwner, pBlock);
+        return;
+    }
+
+    // 소유 스레드 캐시로 반환 (Treiber push).
+    BlockHeader* pHead = pOwner->RemoteHead.load(std::memory_order_relaxed);
+    do
+    {
+        pBlock->pNext = pHead;
+    } while (!pOwner->RemoteHead.compare_exchange_weak(pHead, pBlock, std::memory_order_release, std::memory_order_relaxed));
+
+    pOwner->RemoteFrees.fetch_add(1, std::memory_order_relaxed);
+}
+
+SlabPoolStats SlabPool::GetStats()
+{
+    auto& rfRegistry = GetRegistry();
+
+    SlabPoolStats stats;
+    stats.DirectAllocs = rfRegistry.DirectAllocs.load(std::memory_order_relaxed);
+    stats.ReleasedSlabs = rfRegistry.ReleasedSlabs.load(std::memory_order_relaxed);
+    stats.ReservedBytes = rfRegistry.ReservedBytes.load(std::memory_order_relaxed);
+    stats.ResidentBytes = rfRegistry.ResidentBytes.load(std::memory_order_relaxed);
+
+    std::lock_guard lock(rfRegistry.Mutex);
+    for (const ThreadCache* pCache : rfRegistry.Caches)
+    {
+        stats.Hits += pCache->Hits.load(std::memory_order_relaxed);
+        stats.Misses += pCache->Misses.load(std::memory_order_relaxed);
+        stats.RemoteFrees += pCache->RemoteFrees.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+} // namespace LibCommons::Buffers
@@ -0,0 +1,93 @@
+﻿module;
+
+#include <cstdint>
+
+export module commons.buffers.slab_pool;
+
+import std;
+
+namespace LibCommons::Buffers
+{
+
+export struct SlabPoolStats
+{
+    std::uint64_t Hits          = 0;  // 매거진 / remote free / depot 에서 공급
+    std::uint64_t Misses        = 0;  // 새 slab 을 잘라 공급
+    std::uint64_t RemoteFrees   = 0;  // 할당한 스레드가 아닌 곳에서 반환
+    std::uint64_t DirectAllocs  = 0;  // size class 초과 (또는 스레드 종료 중) — operator new 직행
+    std::uint64_t ReleasedSlabs = 0;  // depot high-water 초과로 OS 에 돌려준 slab 수
+    std::size_t   ReservedBytes = 0;  // 지금까지 확보한 slab 총 바이트 (누적)
+    std::size_t   ResidentBytes = 0;  // 지금 보유 중인 slab 바이트 (돌려준 slab 제외)
+};
+
+/**
+ * 버퍼용 size-class slab 할당기 (프로세스 전역, 정적 API).
+ *
+ * - 크기는 kSizeClasses 중 가장 작은 class 로 올림. 초과분은 operator new 로 직행.
+ * - 스레드마다 class 별 매거진(free list)을 두어 할당/해제 hot path 에 락이 없다.
+ * - 다른 스레드가 해제한 블록은 할당한 스레드 캐시의 lock-free remote free list 로 돌아가고,
+ *   소유 스레드가 매거진이 비었을 때 한 번에 회수한다 (IOCP 워커 간 버퍼 이동 대응).
+ * - 매거진이 넘치면 절반을 class 별 depot (mutex) 으로 넘기고, 비면 depot → 새 slab 순으로 채운다.
+ * - depot 이 class 별 high-water (약 4MB) 를 넘으면 블록이 모두 depot 에 돌아온 slab 을 통째로 해제한다.
+ *   그 아래의 slab 과 매거진에 남은 블록의 slab 은 재사용을 위해 유지한다.
+ *
+ * [Thread Safety] Allocate / Deallocate / GetStats 모두 임의 스레드에서 호출 가능.
+ */
+export class SlabPool
+{
+public:
+    static constexpr std::size_t kSizeClassCount = 6;
+    static constexpr std::array<std::size_t, kSizeClassCount> kSizeClasses = { 64, 256, 1024, 4096, 16 * 1024, 64 * 1024 };
+    static constexpr std::size_t kMaxSlabSize = kSizeClasses.back();
+
+    // 반환 주소는 16 바이트 정렬.
+    static constexpr std::size_t kAlignment = 16;
+
+    SlabPool() = delete;
+
+    // size 이상 크기의 블록. 실패 시 std::bad_alloc.
+    [[nodiscard]] static void* Allocate(std::size_t size);
+
+    // Allocate 로 얻은 블록 반환 (nullptr 허용). 어느 스레드에서든 호출 가능.
+    static void Deallocate(void* p) noexcept;
+
+    static SlabPoolStats GetStats();
+};
+
+
+// 표준 컨테이너용 allocator. 상태가 없어 모든 인스턴스가 같다.
+export template<typename T>
+class SlabAllocator
+{
+    static_assert(alignof(T) <= SlabPool::kAlignment, "SlabAllocator supports up to 16-byte alignment");
+
+public:
+    using value_type = T;
+
+    SlabAllocator() noexcept = default;
+
+    template<typename U>
+    SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if (n > (std::numeric_limits<std::size_t>::max)() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(SlabPool::Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        SlabPool::Deallocate(p);
+    }
+
+    template<typename U>
+    bool operator==(const SlabAllocator<U>&) const noexcept { return true; }
+};
+
+export template<typename T>
+using SlabVector = std::vector<T, SlabAllocator<T>>;
+
+} // namespace LibCommons::Buffers
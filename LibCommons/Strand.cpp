@@ -0,0 +1,173 @@
+﻿module;
+
+#include <cstdint>
+
+module commons.strand;
+
+import std;
+import commons.buffers.slab_pool;
+
+namespace LibCommons
+{
+
+namespace
+{
+
+// 이 스레드가 지금 drain 중인 strand.
+thread_local const Strand* t_pCurrentStrand = nullptr;
+
+} // namespace
+
+Strand::Strand(std::shared_ptr<ThreadPool> pPool)
+    : m_pPool(std::move(pPool)),
+      m_pHead(&m_Stub),
+      m_pTail(&m_Stub)
+{
+}
+
+Strand::~Strand()
+{
+    // 풀이 먼저 멈춰 실행되지 못한 작업 정리 (이 시점엔 생산자가 없다).
+    while (Node* pNode = TryPopNode())
+    {
+        FreeNode(pNode);
+    }
+}
+
+void Strand::Post(Task task)
+{
+    if (!task)
+    {
+        return;
+    }
+
+    // 연결보다 먼저 올린다 — drain 이 볼 수 있는 노드 수가 카운터를 넘지 않아야
+    // batch 경계의 fetch_sub 가 음수로 내려가 두 번째 drain 이 스케줄되는 일이 없다.
+    const std::size_t previous = m_PendingCount.fetch_add(1, std::memory_order_acq_rel);
+
+    PushNode(AllocateNode(std::move(task)));
+
+    if (0 == previous)
+    {
+        // 풀이 멈춰 거절되면 호출 스레드에서 비운다 — 대기 작업이 strand 에 묶여 남지 않게.
+        if (!m_pPool->Enqueue([pSelf = shared_from_this()]() { pSelf->Drain(); }))
+        {
+            Drain();
+        }
+    }
+}
+
+bool Strand::IsRunningInThisThread() const noexcept
+{
+    return t_pCurrentStrand == this;
+}
+
+Strand::Node* Strand::AllocateNode(Task&& task)
+{
+    // ThreadPool 작업 노드와 같은 SlabPool 최소 class (64B) 에 들어가야 한다.
+    static_assert(sizeof(Node) <= Buffers::SlabPool::kSizeClasses[0]);
+    static_assert(alignof(Node) <= Buffers::SlabPool::kAlignment);
+
+    void* pMemory = Buffers::SlabPool::Allocate(sizeof(Node));
+    return ::new (pMemory) Node{ std::move(task) };
+}
+
+void Strand::FreeNode(Node* pNode) noexcept
+{
+    pNode->~Node();
+    Buffers::SlabPool::Deallocate(pNode);
+}
+
+void Strand::PushNode(Node* pNode) noexcept
+{
+    pNode->pNext.store(nullptr, std::memory_order_relaxed);
+    Node* pPrevious = m_pHead.exchange(pNode, std::memory_order_acq_rel);
+    pPrevious->pNext.store(pNode, std::memory_order_release);
+}
+
+Strand::Node* Strand::TryPopNode() noexcept
+{
+    Node* pTail = m_pTail;
+    Node* pNext = pTail->pNext.load(std::memory_order_acquire);
+
+    if (pTail == &m_Stub)
+    {
+        if (!pNext)
+        {
+            return nullptr;
+        }
+        m_pTail = pNext;
+        pTail = pNext;
+        pNext = pNext->pNext.load(std::memory_order_acquire);
+    }
+
+    if (pNext)
+    {
+        m_pTail = pNext;
+        return pTail;
+    }
+
+    // pTail 이 마지막이 아니면 다음 생산자가 exchange 후 아직 연결 전.
+    if (pTail != m_pHead.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    // 마지막 노드를 꺼내려면 뒤에 stub 을 붙여 큐가 비지 않게 한다.
+    PushNode(&m_Stub);
+
+    pNext = pTail->pNext.load(std::memory_order_acquire);
+    if (pNext)
+    {
+        m_pTail = pNext;
+        return pTail;
+    }
+    return nullptr;
+}
+
+void Strand::Drain()
+{
+    const Strand* pPrevious = std::exchange(t_pCurrentStrand, this);
+
+    while (true)
+    {
+        std::size_t executed = 0;
+        while (executed < kMaxBatch)
+        {
+            Node* pNode = TryPopNode();
+            if (!pNode)
+            {
+                // 실행한 만큼이 전부면 비었다. 아니면 카운터를 올린 생산자가 아직 연결 전이므로 곧 보인다.
+                if (m_PendingCount.load(std::memory_order_acquire) == executed)
+                {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+
+            pNode->Fn();
+            FreeNode(pNode);
+            ++executed;
+        }
+
+        m_Executed.fetch_add(executed, std::memory_order_release);
+
+        if (m_PendingCount.fetch_sub(executed, std::memory_order_acq_rel) == executed)
+        {
+            break;
+        }
+
+        // batch 를 넘겼거나 실행 중에 새로 Post 됐으면 injection queue 로 다시 들어간다
+        // (자기 deque 에 넣으면 바로 다시 꺼내므로 이 워커에 쌓인 다른 strand 가 밀린다).
+        // 풀이 멈춰 거절되면 여기서 마저 비운다.
+        if (m_pPool->EnqueueGlobal([pSelf = shared_from_this()]() { pSelf->Drain(); }))
+        {
+            break;
+        }
+    }
+
+    t_pCurrentStrand = pPrevious;
+}
+
+} // namespace LibCommons
@@ -0,0 +1,94 @@
+﻿module;
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+export module commons.strand;
+
+import std;
+import commons.thread_pool;
+
+namespace LibCommons
+{
+
+/**
+ * 직렬 실행기 (strand). 같은 strand 에 Post 한 작업은 ThreadPool 위에서 한 번에 하나씩, 들어온 순서대로 실행된다.
+ * 서로 다른 strand 는 병렬로 실행되므로 세션 / 방 단위 상태를 락 없이 다룰 수 있다.
+ *
+ * - 작업 대기열은 lock-free intrusive MPSC 큐 (Vyukov). Post 는 카운터 증가 1회 + exchange 1회.
+ *   카운터를 먼저 올리므로 drain 이 보는 노드 수는 항상 카운터 이하다.
+ * - 대기 작업 수가 0 → 1 이 되는 Post 만 풀에 drain 작업을 넣는다 (strand 당 풀 작업은 최대 1개).
+ * - drain 은 최대 kMaxBatch 개를 연달아 실행하고, 남으면 풀 뒤로 다시 들어가 다른 strand 에 차례를 넘긴다.
+ * - 순서는 Post 한 스레드별로 보장된다 (여러 스레드가 동시에 Post 하면 그 사이 순서는 도착 순).
+ *
+ * drain 작업이 strand 를 shared_ptr 로 잡으므로 반드시 Create 로 생성한다.
+ * strand 는 풀을 shared_ptr 로 잡아 풀 소유자가 먼저 놓아도 풀이 해제되지 않는다 (ThreadPool::Create 로 만든 풀을 넘긴다).
+ * 풀이 Stop 된 뒤에는 풀 대신 Post 한 스레드에서 남은 작업을 순서대로 실행한다.
+ *
+ * [Thread Safety] Post / IsRunningInThisThread / GetExecutedCount 는 임의 스레드에서 호출 가능.
+ */
+export class Strand : public std::enable_shared_from_this<Strand>
+{
+public:
+    // drain 1회에 연달아 실행하는 최대 작업 수.
+    static constexpr std::size_t kMaxBatch = 64;
+
+    static std::shared_ptr<Strand> Create(std::shared_ptr<ThreadPool> pPool)
+    {
+        return std::shared_ptr<Strand>(new Strand(std::move(pPool)));
+    }
+
+    ~Strand();
+
+    Strand(const Strand&) = delete;
+    Strand& operator=(const Strand&) = delete;
+
+    void Post(Task task);
+
+    // 지금 이 스레드가 이 strand 의 작업을 실행 중인지.
+    bool IsRunningInThisThread() const noexcept;
+
+    std::uint64_t GetExecutedCount() const noexcept
+    {
+        return m_Executed.load(std::memory_order_acquire);
+    }
+
+private:
+    explicit Strand(std::shared_ptr<ThreadPool> pPool);
+
+    struct Node
+    {
+        Task Fn;
+        std::atomic<Node*> pNext{ nullptr };
+    };
+
+    static Node* AllocateNode(Task&& task);
+    static void FreeNode(Node* pNode) noexcept;
+
+    // 생산자 쪽 연결. 소비자 (drain) 와 동시에 호출 가능.
+    void PushNode(Node* pNode) noexcept;
+
+    // 소비자 전용. 연결 중인 생산자에 막혀 있으면 nullptr.
+    Node* TryPopNode() noexcept;
+
+    void Drain();
+
+private:
+    std::shared_ptr<ThreadPool> m_pPool;
+
+    // 생산자가 교체하는 마지막 노드.
+    alignas(64) std::atomic<Node*> m_pHead;
+
+    // drain 만 접근하는 첫 노드. 비었을 때는 m_Stub 을 가리킨다.
+    alignas(64) Node* m_pTail;
+    Node m_Stub;
+
+    // Post 됐지만 아직 실행되지 않은 작업 수. 0 → 1 전이가 스케줄, drain 이 0 으로 내리면 유휴.
+    std::atomic<std::size_t> m_PendingCount{ 0 };
+
+    std::atomic<std::uint64_t> m_Executed{ 0 };
+};
+
+} // namespace LibCommons
@@ -0,0 +1,68 @@
+﻿module;
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+#include <cstdint>
+
+export module commons.thread_affinity;
+
+import std;
+
+namespace LibCommons
+{
+
+/**
+ * ThreadAffinity
+ * 호출 스레드를 논리 프로세서 1개에 고정 (thread-per-core 워커용).
+ *
+ * - processorIndex 는 0 부터의 논리 프로세서 번호. 프로세서 수를 넘으면 나머지 연산으로 접는다.
+ * - Windows 는 64 개 단위 프로세서 그룹을 고려해 SetThreadGroupAffinity 사용.
+ */
+export class ThreadAffinity
+{
+public:
+    static std::uint32_t GetProcessorCount() noexcept
+    {
+#if defined(_WIN32)
+        const DWORD count = ::GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+#else
+        const long count = ::sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        return count > 0 ? static_cast<std::uint32_t>(count) : 1u;
+    }
+
+    static bool PinCurrentThread(std::uint32_t processorIndex) noexcept
+    {
+        processorIndex %= GetProcessorCount();
+
+#if defined(_WIN32)
+        // 그룹별 활성 프로세서 수를 차례로 빼 가며 (group, 그룹 내 번호) 로 변환.
+        const WORD groupCount = ::GetActiveProcessorGroupCount();
+        for (WORD group = 0; group < groupCount; ++group)
+        {
+            const DWORD countInGroup = ::GetActiveProcessorCount(group);
+            if (processorIndex < countInGroup)
+            {
+                GROUP_AFFINITY affinity = {};
+                affinity.Group = group;
+                affinity.Mask = static_cast<KAFFINITY>(1) << processorIndex;
+                return FALSE != ::SetThreadGroupAffinity(::GetCurrentThread(), &affinity, nullptr);
+            }
+            processorIndex -= countInGroup;
+        }
+        return false;
+#else
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(processorIndex, &cpuSet);
+        return 0 == ::pthread_setaffinity_np(::pthread_self(), sizeof(cpuSet), &cpuSet);
+#endif
+    }
+};
+
+} // namespace LibCommons
@@ -0,0 +1,428 @@
+﻿module;
+
+#include <cstdint>
+
+module commons.thread_pool;
+
+import std;
+import commons.buffers.slab_pool;
+
+namespace LibCommons
+{
+
+namespace
+{
+
+constexpr std::size_t kDequeCapacity = 256;
+
+// 잠들기 전 작업을 다시 찾아보는 횟수 (한 번마다 yield).
+constexpr int kSpinRounds = 64;
+
+// 로컬 deque 만 돌다 injection queue 를 굶기지 않도록 이 횟수마다 injection 을 먼저 본다.
+constexpr std::uint32_t kInjectCheckInterval = 61;
+
+// injection queue 에서 한 번에 꺼내는 최대 작업 수.
+constexpr std::size_t kInjectBatch = 32;
+
+} // namespace
+
+struct ThreadPool::TaskNode
+{
+    Task Fn;
+    TaskNode* pNext = nullptr;
+};
+
+struct alignas(64) ThreadPool::Worker
+{
+    Worker(ThreadPool& rfPool, std::size_t index)
+        : pPool(&rfPool),
+          Index(index),
+          RandomState(0x9E3779B97F4A7C15ull * (index + 1))
+    {
+    }
+
+    ThreadPool* pPool;
+    std::size_t Index;
+    detail::WorkStealingDeque<TaskNode*> Deque{ kDequeCapacity };
+
+    // 워커 스레드만 접근.
+    std::uint64_t RandomState;
+    std::uint32_t Tick = 0;
+
+    std::atomic<std::uint64_t> Executed{ 0 };
+    std::atomic<std::uint64_t> Stolen{ 0 };
+};
+
+
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+    const std::size_t workerCount = (std::max)(numThreads, std::size_t{ 1 });
+
+    // 훔칠 대상 목록은 스레드 시작 전에 모두 만든다 (이후 변경 없음).
+    m_Workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        m_Workers.push_back(std::make_unique<Worker>(*this, i));
+    }
+
+    m_Threads.reserve(workerCount);
+    for (auto& pWorker : m_Workers)
+    {
+        m_Threads.emplace_back([this, pWorker = pWorker.get()]()
+            {
+                WorkerLoop(*pWorker);
+            });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+    m_Threads.clear();
+
+    // 정지 이후에 들어와 실행되지 않은 작업 정리.
+    for (auto& pWorker : m_Workers)
+    {
+        while (TaskNode* pNode = pWorker->Deque.Pop())
+        {
+            FreeNode(pNode);
+        }
+    }
+
+    while (m_pInjectHead)
+    {
+        FreeNode(std::exchange(m_pInjectHead, m_pInjectHead->pNext));
+    }
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::Create(std::size_t numThreads)
+{
+    return std::shared_ptr<ThreadPool>(new ThreadPool(numThreads), [](ThreadPool* pPool)
+        {
+            if (pPool->IsWorkerThread())
+            {
+                // 소멸자가 이 워커를 join 하고 나서 해제하므로 워커는 지금 실행 중인 작업을 안전하게 마친다.
+                std::thread([pPool]() { delete pPool; }).detach();
+                return;
+            }
+            delete pPool;
+        });
+}
+
+bool ThreadPool::Enqueue(Task task)
+{
+    if (!task || !BeginEnqueue())
+    {
+        return false;
+    }
+
+    TaskNode* pNode = AllocateNode(std::move(task));
+
+    Worker* pWorker = CurrentWorker();
+    if (pWorker && pWorker->pPool == this)
+    {
+        pWorker->Deque.Push(pNode);
+    }
+    else
+    {
+        Inject(pNode);
+    }
+
+    WakeOne();
+    EndEnqueue();
+    return true;
+}
+
+bool ThreadPool::EnqueueGlobal(Task task)
+{
+    if (!task || !BeginEnqueue())
+    {
+        return false;
+    }
+
+    Inject(AllocateNode(std::move(task)));
+    WakeOne();
+    EndEnqueue();
+    return true;
+}
+
+bool ThreadPool::BeginEnqueue() noexcept
+{
+    // 정지 확인보다 먼저 적재 중임을 알린다 — 확인 직후 Stop 이 끼어들어도 워커는 이 적재가 끝날 때까지
+    // 종료하지 않으므로, true 를 돌려준 작업이 실행되지 않고 버려지는 일이 없다.
+    m_EnqueuingCount.fetch_add(1, std::memory_order_seq_cst);
+    if (m_bStopped.load(std::memory_order_seq_cst))
+    {
+        EndEnqueue();
+        return false;
+    }
+    return true;
+}
+
+void ThreadPool::EndEnqueue() noexcept
+{
+    m_EnqueuingCount.fetch_sub(1, std::memory_order_release);
+}
+
+void ThreadPool::Stop()
+{
+    if (m_bStopped.exchange(true))
+    {
+        return;
+    }
+
+    m_WakeEpoch.fetch_add(1, std::memory_order_release);
+    m_WakeEpoch.notify_all();
+}
+
+ThreadPoolStats ThreadPool::GetStats() const
+{
+    ThreadPoolStats stats;
+    for (const auto& pWorker : m_Workers)
+    {
+        stats.Executed += pWorker->Executed.load(std::memory_order_relaxed);
+        stats.Stolen += pWorker->Stolen.load(std::memory_order_relaxed);
+    }
+    stats.Injected = m_Injected.load(std::memory_order_relaxed);
+    stats.Parks = m_Parks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool ThreadPool::IsWorkerThread() const noexcept
+{
+    const Worker* pWorker = CurrentWorker();
+    return pWorker && pWorker->pPool == this;
+}
+
+ThreadPool::Worker*& ThreadPool::CurrentWorker()
+{
+    thread_local Worker* t_pWorker = nullptr;
+    return t_pWorker;
+}
+
+ThreadPool::TaskNode* ThreadPool::AllocateNode(Task&& task)
+{
+    // SlabPool 의 가장 작은 class (64B) 에 들어가야 작업당 할당이 스레드 매거진 pop 1회로 끝난다.
+    static_assert(sizeof(TaskNode) <= Buffers::SlabPool::kSizeClasses[0]);
+    static_assert(alignof(TaskNode) <= Buffers::SlabPool::kAlignment);
+
+    void* pMemory = Buffers::SlabPool::Allocate(sizeof(TaskNode));
+    return ::new (pMemory) TaskNode{ std::move(task), nullptr };
+}
+
+void ThreadPool::FreeNode(TaskNode* pNode) noexcept
+{
+    pNode->~TaskNode();
+    Buffers::SlabPool::Deallocate(pNode);
+}
+
+void ThreadPool::Inject(TaskNode* pNode)
+{
+    {
+        auto lock = std::lock_guard(m_InjectMutex);
+        if (m_pInjectTail)
+        {
+            m_pInjectTail->pNext = pNode;
+        }
+        else
+        {
+            m_pInjectHead = pNode;
+        }
+        m_pInjectTail = pNode;
+        m_InjectedCount.fetch_add(1, std::memory_order_release);
+    }
+    m_Injected.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::WorkerLoop(Worker& rfWorker)
+{
+    CurrentWorker() = &rfWorker;
+
+    while (true)
+    {
+        TaskNode* pNode = FindTask(rfWorker);
+        for (int round = 0; !pNode && round < kSpinRounds; ++round)
+        {
+            std::this_thread::yield();
+            pNode = FindTask(rfWorker);
+        }
+
+        if (pNode)
+        {
+            Run(rfWorker, pNode);
+            continue;
+        }
+
+        // 남은 작업이 없을 때만 정지 — Stop 이전에 들어온 작업은 모두 실행된다.
+        // Stop 전에 정지 확인을 통과하고 아직 적재 중인 Enqueue 가 있으면 그 작업이 보일 때까지 기다린다.
+        if (m_bStopped.load(std::memory_order_seq_cst))
+        {
+            if (0 == m_EnqueuingCount.load(std::memory_order_seq_cst) && !HasPendingWork())
+            {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        Park();
+    }
+
+    CurrentWorker() = nullptr;
+}
+
+ThreadPool::TaskNode* ThreadPool::FindTask(Worker& rfWorker)
+{
+    if (0 == ++rfWorker.Tick % kInjectCheckInterval)
+    {
+        if (TaskNode* pNode = TakeInjected(rfWorker))
+        {
+            return pNode;
+        }
+    }
+
+    if (TaskNode* pNode = rfWorker.Deque.Pop())
+    {
+        return pNode;
+    }
+
+    if (TaskNode* pNode = TakeInjected(rfWorker))
+    {
+        return pNode;
+    }
+
+    return Steal(rfWorker);
+}
+
+ThreadPool::TaskNode* ThreadPool::TakeInjected(Worker& rfWorker)
+{
+    if (0 == m_InjectedCount.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    std::array<TaskNode*, kInjectBatch> batch;
+    std::size_t taken = 0;
+    {
+        auto lock = std::lock_guard(m_InjectMutex);
+
+        // 워커 수로 나눠 가져가 한 워커가 독식하지 않게 — 나머지는 자기 deque 에 넣어 다른 워커가 훔쳐 갈 수 있다.
+        const std::size_t pending = m_InjectedCount.load(std::memory_order_relaxed);
+        const std::size_t batchSize = std::clamp<std::size_t>(pending / m_Workers.size(), 1, kInjectBatch);
+
+        while (taken < batchSize && m_pInjectHead)
+        {
+            batch[taken++] = std::exchange(m_pInjectHead, m_pInjectHead->pNext);
+        }
+        if (!m_pInjectHead)
+        {
+            m_pInjectTail = nullptr;
+        }
+        m_InjectedCount.fetch_sub(taken, std::memory_order_relaxed);
+    }
+
+    if (0 == taken)
+    {
+        return nullptr;
+    }
+
+    // 소유 스레드는 bottom 부터 꺼내므로 역순으로 넣어 들어온 순서대로 실행되게 한다.
+    for (std::size_t i = taken - 1; i > 0; --i)
+    {
+        batch[i]->pNext = nullptr;
+        rfWorker.Deque.Push(batch[i]);
+    }
+    if (taken > 1)
+    {
+        WakeOne();
+    }
+
+    batch[0]->pNext = nullptr;
+    return batch[0];
+}
+
+ThreadPool::TaskNode* ThreadPool::Steal(Worker& rfWorker)
+{
+    const std::size_t workerCount = m_Workers.size();
+    if (workerCount < 2)
+    {
+        return nullptr;
+    }
+
+    // xorshift 로 시작 위치를 흩어 도둑이 한 워커에 몰리지 않게.
+    std::uint64_t& rfState = rfWorker.RandomState;
+    rfState ^= rfState << 13;
+    rfState ^= rfState >> 7;
+    rfState ^= rfState << 17;
+
+    const std::size_t start = static_cast<std::size_t>(rfState % workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        const std::size_t victim = (start + i) % workerCount;
+        if (victim == rfWorker.Index)
+        {
+            continue;
+        }
+
+        if (TaskNode* pNode = m_Workers[victim]->Deque.Steal())
+        {
+            rfWorker.Stolen.fetch_add(1, std::memory_order_relaxed);
+            return pNode;
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::Run(Worker& rfWorker, TaskNode* pNode)
+{
+    pNode->Fn();
+    FreeNode(pNode);
+    rfWorker.Executed.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool ThreadPool::HasPendingWork() const noexcept
+{
+    if (m_InjectedCount.load(std::memory_order_relaxed) > 0)
+    {
+        return true;
+    }
+
+    for (const auto& pWorker : m_Workers)
+    {
+        if (pWorker->Deque.GetSizeApprox() > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::Park()
+{
+    const std::uint32_t epoch = m_WakeEpoch.load(std::memory_order_acquire);
+    m_SleeperCount.fetch_add(1, std::memory_order_relaxed);
+
+    // WakeOne 의 fence 와 짝 — 작업 적재 → sleeper 확인 / sleeper 등록 → 작업 확인 중 한 쪽은 반드시 상대를 본다.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (!HasPendingWork() && !m_bStopped.load(std::memory_order_relaxed))
+    {
+        m_Parks.fetch_add(1, std::memory_order_relaxed);
+        m_WakeEpoch.wait(epoch, std::memory_order_acquire);
+    }
+
+    m_SleeperCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::WakeOne()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_SleeperCount.load(std::memory_order_relaxed) > 0)
+    {
+        m_WakeEpoch.fetch_add(1, std::memory_order_release);
+        m_WakeEpoch.notify_one();
+    }
+}
+
+} // namespace LibCommons
@@ -1,12 +1,18 @@
 ﻿module;
 
-#include <vector>
-#include <queue>
-#include <thread>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <condition_variable>
-#include <atomic>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 export module commons.thread_pool;
 
@@ -15,96 +21,360 @@ import std;
 namespace LibCommons
 {
 
-export class ThreadPool
+/**
+ * 이동 전용 작업. 캡처가 kInlineSize 이하면 객체 안에 두고 (할당 없음), 넘으면 힙에 둔다.
+ * std::function 과 달리 복사할 수 없는 캡처 (unique_ptr, packaged_task, promise) 를 그대로 받는다.
+ */
+export class Task
 {
 public:
-    ThreadPool(size_t numThreads) : m_bStopped(false)
+    static constexpr std::size_t kInlineSize = 40;
+    static constexpr std::size_t kInlineAlign = 16;
+
+    Task() noexcept = default;
+
+    template <typename F>
+        requires (!std::same_as<std::remove_cvref_t<F>, Task> && std::invocable<std::decay_t<F>&>)
+    Task(F&& function)
     {
-        for (size_t i = 0; i < numThreads; ++i)
+        using Fn = std::decay_t<F>;
+        if constexpr (FitsInline<Fn>())
+        {
+            ::new (static_cast<void*>(m_Storage)) Fn(std::forward<F>(function));
+            m_pOps = &kInlineOps<Fn>;
+        }
+        else
         {
-            m_Workers.emplace_back([this](std::stop_token stopToken)
-                {
-                    WorkerThread(stopToken);
-                });
+            ::new (static_cast<void*>(m_Storage)) Fn*(new Fn(std::forward<F>(function)));
+            m_pOps = &kHeapOps<Fn>;
         }
     }
 
-    ~ThreadPool()
+    Task(Task&& other) noexcept
     {
-        Stop();
+        MoveFrom(other);
     }
 
-    void Enqueue(std::function<void()> task)
+    Task& operator=(Task&& other) noexcept
     {
+        if (this != &other)
         {
-            std::unique_lock<std::mutex> lock(m_TaskQueueMutex);
-            m_TaskQueue.emplace(std::move(task));
+            Reset();
+            MoveFrom(other);
         }
-        m_Condition.notify_one();
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task()
+    {
+        Reset();
+    }
+
+    explicit operator bool() const noexcept { return m_pOps != nullptr; }
+
+    void operator()()
+    {
+        m_pOps->pInvoke(m_Storage);
+    }
+
+    // 캡처를 객체 안에 두었는지 (힙 할당 없음).
+    bool IsInline() const noexcept { return m_pOps && m_pOps->bInline; }
+
+    template <typename Fn>
+    static constexpr bool FitsInline() noexcept
+    {
+        return sizeof(Fn) <= kInlineSize && alignof(Fn) <= kInlineAlign && std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+private:
+    struct Ops
+    {
+        void (*pInvoke)(void* pStorage);
+        void (*pRelocate)(void* pDestination, void* pSource) noexcept;  // 이동 생성 후 원본 소멸
+        void (*pDestroy)(void* pStorage) noexcept;
+        bool bInline;
+    };
+
+    template <typename Fn>
+    static constexpr Ops kInlineOps{
+        [](void* pStorage) { std::invoke(*static_cast<Fn*>(pStorage)); },
+        [](void* pDestination, void* pSource) noexcept
+        {
+            ::new (pDestination) Fn(std::move(*static_cast<Fn*>(pSource)));
+            static_cast<Fn*>(pSource)->~Fn();
+        },
+        [](void* pStorage) noexcept { static_cast<Fn*>(pStorage)->~Fn(); },
+        true,
+    };
+
+    template <typename Fn>
+    static constexpr Ops kHeapOps{
+        [](void* pStorage) { std::invoke(**static_cast<Fn**>(pStorage)); },
+        [](void* pDestination, void* pSource) noexcept { ::new (pDestination) Fn*(*static_cast<Fn**>(pSource)); },
+        [](void* pStorage) noexcept { delete *static_cast<Fn**>(pStorage); },
+        false,
+    };
+
+    void MoveFrom(Task& rfOther) noexcept
+    {
+        if (rfOther.m_pOps)
+        {
+            rfOther.m_pOps->pRelocate(m_Storage, rfOther.m_Storage);
+            m_pOps = std::exchange(rfOther.m_pOps, nullptr);
+        }
+    }
+
+    void Reset() noexcept
+    {
+        if (m_pOps)
+        {
+            std::exchange(m_pOps, nullptr)->pDestroy(m_Storage);
+        }
+    }
+
+    alignas(kInlineAlign) std::byte m_Storage[kInlineSize];
+    const Ops* m_pOps = nullptr;
+};
+
+
+namespace detail
+{
+
+/**
+ * Chase-Lev work-stealing deque (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+ * 소유 스레드만 Push / Pop (bottom 쪽, LIFO), 다른 스레드는 Steal (top 쪽, FIFO).
+ * 배열이 차면 2배로 키우고, 이전 배열은 도둑이 아직 읽고 있을 수 있어 deque 소멸 때까지 보관한다.
+ */
+export template <typename T>
+    requires std::is_pointer_v<T>
+class WorkStealingDeque
+{
+public:
+    explicit WorkStealingDeque(std::size_t capacity)
+    {
+        auto pArray = std::make_unique<Array>(std::bit_ceil((std::max)(capacity, std::size_t{ 2 })));
+        m_pArray.store(pArray.get(), std::memory_order_relaxed);
+        m_Arrays.push_back(std::move(pArray));
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 소유 스레드 전용.
+    void Push(T item)
+    {
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_Top.load(std::memory_order_acquire);
+
+        Array* pArray = m_pArray.load(std::memory_order_relaxed);
+        if (bottom - top > pArray->Mask)
+        {
+            pArray = Grow(*pArray, bottom, top);
+        }
+
+        // release — 도둑이 bottom 을 acquire 로 읽으면 item 이 가리키는 내용까지 보인다.
+        pArray->Store(bottom, item);
+        m_Bottom.store(bottom + 1, std::memory_order_release);
     }
 
-    void Stop()
+    // 소유 스레드 전용. 비었으면 nullptr.
+    T Pop()
     {
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        Array* pArray = m_pArray.load(std::memory_order_relaxed);
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::int64_t top = m_Top.load(std::memory_order_relaxed);
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T item = pArray->Load(bottom);
+        if (top == bottom)
         {
-            std::unique_lock<std::mutex> lock(m_TaskQueueMutex);
-            if (m_bStopped)
+            // 마지막 1개 — 도둑과 top 을 두고 경쟁.
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
             {
-                return;
+                item = nullptr;
             }
-            m_bStopped = true;
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
         }
-        m_Condition.notify_all();
+        return item;
     }
 
-    bool IsStopped() const
+    // 임의 스레드. 비었거나 다른 스레드와의 경쟁에서 지면 nullptr.
+    T Steal()
     {
-        return m_bStopped.load();
+        std::int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        const Array* pArray = m_pArray.load(std::memory_order_acquire);
+        T item = pArray->Load(top);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // 근사치 (다른 스레드가 동시에 바꾸는 중일 수 있음).
+    std::size_t GetSizeApprox() const noexcept
+    {
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_Top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
     }
 
 private:
-    void WorkerThread(std::stop_token stoken)
+    struct Array
     {
-        for (;;)
+        explicit Array(std::size_t capacity)
+            : Mask(static_cast<std::int64_t>(capacity) - 1),
+              pSlots(std::make_unique<std::atomic<T>[]>(capacity))
         {
-            std::function<void()> task;
+        }
 
-            {
-                std::unique_lock<std::mutex> lock(m_TaskQueueMutex);
-                m_Condition.wait(lock, [this, &stoken]
-                    {
-                        return m_bStopped || !m_TaskQueue.empty() || stoken.stop_requested();
-                    });
-
-                if ((m_bStopped || stoken.stop_requested()) && m_TaskQueue.empty())
-                {
-                    return;
-                }
-
-                if (m_TaskQueue.empty())
-                {
-                    continue;
-                }
-
-                task = std::move(m_TaskQueue.front());
-                m_TaskQueue.pop();
-            }
+        T Load(std::int64_t index) const noexcept { return pSlots[index & Mask].load(std::memory_order_relaxed); }
+        void Store(std::int64_t index, T item) noexcept { pSlots[index & Mask].store(item, std::memory_order_relaxed); }
 
-            if (task)
-            {
-                task();
-            }
+        const std::int64_t Mask;
+        std::unique_ptr<std::atomic<T>[]> pSlots;
+    };
+
+    Array* Grow(const Array& rfOld, std::int64_t bottom, std::int64_t top)
+    {
+        auto pArray = std::make_unique<Array>(static_cast<std::size_t>(rfOld.Mask + 1) * 2);
+        for (std::int64_t index = top; index < bottom; ++index)
+        {
+            pArray->Store(index, rfOld.Load(index));
         }
+
+        Array* pRaw = pArray.get();
+        m_Arrays.push_back(std::move(pArray));
+        m_pArray.store(pRaw, std::memory_order_release);
+        return pRaw;
     }
 
+    alignas(64) std::atomic<std::int64_t> m_Top{ 0 };
+    alignas(64) std::atomic<std::int64_t> m_Bottom{ 0 };
+    std::atomic<Array*> m_pArray{ nullptr };
+
+    std::vector<std::unique_ptr<Array>> m_Arrays;  // 소유 스레드만 수정
+};
+
+} // namespace detail
+
+
+export struct ThreadPoolStats
+{
+    std::uint64_t Executed = 0;
+    std::uint64_t Stolen = 0;    // 다른 워커 deque 에서 가져와 실행
+    std::uint64_t Injected = 0;  // injection queue 로 들어온 작업 (워커 밖 Enqueue / EnqueueGlobal)
+    std::uint64_t Parks = 0;     // 일감이 없어 잠든 횟수
+};
+
+/**
+ * Work-stealing 스레드 풀.
+ *
+ * - 워커마다 Chase-Lev deque. 워커 안에서 Enqueue 하면 자기 deque 에 넣고 (락 없음), 남는 워커가 훔쳐 간다.
+ * - 워커가 아닌 스레드 (IOCP 워커 등) 의 Enqueue 는 injection queue (mutex 로 보호하는 intrusive list) 로 들어가고,
+ *   워커가 여러 개씩 한 번에 꺼내 자기 deque 로 옮긴다.
+ * - 작업 노드는 SlabPool 에서 할당한다. 작은 캡처는 Task 안에 들어가므로 작업당 힙 할당이 없다.
+ * - 일감이 없으면 잠시 다시 찾아본 뒤 (spin) std::atomic::wait 로 잠든다.
+ * - 작업 실행 순서는 보장하지 않는다. 순서가 필요하면 한 작업 안에서 이어서 처리한다.
+ *
+ * [Thread Safety] Enqueue / Stop / GetStats 는 임의 스레드에서 호출 가능.
+ */
+export class ThreadPool
+{
+public:
+    explicit ThreadPool(std::size_t numThreads);
+    ~ThreadPool();
+
+    // 여러 소유자 (strand 등) 가 나눠 갖는 풀. 마지막 참조가 이 풀의 워커 안에서 놓이면
+    // 워커가 자기 자신을 join 할 수 없으므로 소멸을 별도 스레드에 넘긴다.
+    static std::shared_ptr<ThreadPool> Create(std::size_t numThreads);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Stop 이후에 들어온 작업은 실행하지 않고 버린다 (false 반환).
+    bool Enqueue(Task task);
+
+    // 워커 안에서 호출해도 자기 deque 가 아닌 injection queue 로 넣는다.
+    // 오래 도는 작업이 나눠서 다시 들어갈 때 이 워커에 쌓인 다른 작업 뒤로 양보하는 용도.
+    bool EnqueueGlobal(Task task);
+
+    // 새 작업을 더 받지 않는다. 이미 들어온 작업은 워커가 모두 실행한 뒤 종료한다 (join 은 소멸자).
+    void Stop();
+
+    bool IsStopped() const
+    {
+        return m_bStopped.load();
+    }
+
+    std::size_t GetWorkerCount() const noexcept { return m_Workers.size(); }
+
+    // 지금 스레드가 이 풀의 워커인지.
+    bool IsWorkerThread() const noexcept;
+
+    ThreadPoolStats GetStats() const;
+
+private:
+    struct TaskNode;
+    struct Worker;
+
+    static Worker*& CurrentWorker();
+
+    TaskNode* AllocateNode(Task&& task);
+    void FreeNode(TaskNode* pNode) noexcept;
+    void Inject(TaskNode* pNode);
+
+    // Enqueue 의 정지 확인 ~ 적재 구간 표시. 정지됐으면 false.
+    bool BeginEnqueue() noexcept;
+    void EndEnqueue() noexcept;
+
+    void WorkerLoop(Worker& rfWorker);
+    TaskNode* FindTask(Worker& rfWorker);
+    TaskNode* TakeInjected(Worker& rfWorker);
+    TaskNode* Steal(Worker& rfWorker);
+    void Run(Worker& rfWorker, TaskNode* pNode);
+
+    bool HasPendingWork() const noexcept;
+    void Park();
+    void WakeOne();
+
 private:
-    std::vector<std::jthread> m_Workers;
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+    std::vector<std::jthread> m_Threads;
+
+    // injection queue (FIFO). 개수는 락 없이 "비었는지" 확인하는 용도.
+    std::mutex m_InjectMutex;
+    TaskNode* m_pInjectHead = nullptr;
+    TaskNode* m_pInjectTail = nullptr;
+    std::atomic<std::size_t> m_InjectedCount{ 0 };
+
+    std::atomic<std::uint32_t> m_SleeperCount{ 0 };
+    std::atomic<std::uint32_t> m_WakeEpoch{ 0 };
 
-    std::queue<std::function<void()>> m_TaskQueue;
-    std::mutex m_TaskQueueMutex;
+    std::atomic<bool> m_bStopped{ false };
 
-    std::condition_variable m_Condition;
+    // 정지 확인을 통과해 아직 적재 중인 Enqueue 수. 0 이 아니면 워커는 정지 후에도 종료하지 않는다.
+    std::atomic<std::uint32_t> m_EnqueuingCount{ 0 };
 
-    std::atomic<bool> m_bStopped;
+    std::atomic<std::uint64_t> m_Injected{ 0 };
+    std::atomic<std::uint64_t> m_Parks{ 0 };
 };
 
 } // namespace LibCommons
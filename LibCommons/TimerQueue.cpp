@@ -1,7 +1,6 @@
-﻿module;
+module;
 
-#include <Windows.h>
-#include <threadpoolapiset.h>
+#include <cstdint>
 // CRITICAL: LibCommons::Logger 의 가변 템플릿 LogXxx 는 spdlog 타입(string_view_t, fmt_lib 등)을
 // 직접 참조한다. `import commons.logger;` 만 사용하면 모듈 경계에서 spdlog 심볼이 완전히 노출되지
 // 않아 템플릿 인스턴스화 시 MSVC C1001 ICE 를 유발한다. GMF 에서 spdlog 헤더를 include 해
@@ -17,16 +16,25 @@ import commons.logger;
 // Plan SC: FR-01 (ScheduleOnce), FR-02 (SchedulePeriodic), FR-03 (Cancel),
 //          FR-04 (람다 오버로드), FR-05 (Command 오버로드), FR-06 (Name 로깅),
 //          FR-07 (RAII 정리), FR-08 (Shutdown), FR-09 (Logger 연동), FR-10 (GetInstance).
+//
+// 엔진: 계층형 타이밍 휠.
+//   - level0 256칸 (1 tick 단위) + level1~4 64칸씩 → 2^32 tick 범위. 범위를 넘는 지연은 최대치로 clamp.
+//   - 각 칸은 sentinel 원형 이중 연결 리스트 — 삽입/취소는 O(1) unlink.
+//   - level0 이 한 바퀴 돌 때마다 상위 level 의 칸 하나를 풀어 재삽입 (cascade).
+//   - 엔트리는 청크 단위 슬랩 + free list 로 재사용. TimerId = (generation << 32) | (index + 1) 이라
+//     재사용된 슬롯에 대한 오래된 id 는 generation 불일치로 거부된다.
+//   - 휠 스레드는 다음 만료 tick 까지 잠들고, 더 이른 타이머가 들어오면 깨운다.
 
 namespace LibCommons::detail
 {
 
 enum class EntryState : std::uint8_t
 {
-    Scheduled = 0,
-    Running   = 1,
-    Completed = 2,
-    Cancelled = 3,
+    Free      = 0,
+    Scheduled = 1,   // 휠에 걸려 있음 (periodic 은 발사 중에도 다음 주기로 Scheduled).
+    Expired   = 2,   // one-shot 만료 → 콜백 실행 대기.
+    Running   = 3,   // one-shot 콜백 실행 중.
+    Cancelled = 4,
 };
 
 enum class QueueState : std::uint8_t
@@ -42,52 +50,86 @@ struct TimerJob
     std::string           name;
 };
 
-struct Entry
-    : std::enable_shared_from_this<Entry>
+struct ListNode
 {
-    TimerId                 id          = kInvalidTimerId;
-    PTP_TIMER               handle      = nullptr;
+    ListNode* pPrev = this;
+    ListNode* pNext = this;
+
+    bool IsEmpty() const noexcept { return pNext == this; }
+};
+
+// 휠 칸 / free list 에 걸리는 intrusive 엔트리. 주소는 청크가 살아 있는 동안 고정.
+struct Entry : ListNode
+{
+    std::uint64_t           expires       = 0;    // 만료 tick
+    std::uint64_t           intervalTicks = 0;    // periodic 주기 (tick)
     TimerJob                job;
-    std::atomic<EntryState> state       = EntryState::Scheduled;
-    bool                    isPeriodic  = false;
-    Duration                interval    = Duration::zero();
-    std::atomic_bool        closeAfterCallback = false;
-    std::weak_ptr<TimerQueue::Impl> owner;
+    std::atomic<EntryState> state         = EntryState::Free;
+    std::uint32_t           generation    = 1;
+    std::uint32_t           index         = 0;
+    std::uint32_t           inFlight      = 0;    // 만료되어 실행 대기/중인 콜백 수 (mutex 보호)
+    bool                    isPeriodic    = false;
+
+    TimerId Id() const noexcept
+    {
+        return (static_cast<TimerId>(generation) << 32) | (static_cast<TimerId>(index) + 1);
+    }
 };
 
-thread_local Entry* g_pCurrentCallbackEntry = nullptr;
+inline void LinkTail(ListNode& rfHead, ListNode& rfNode) noexcept
+{
+    rfNode.pPrev        = rfHead.pPrev;
+    rfNode.pNext        = &rfHead;
+    rfHead.pPrev->pNext = &rfNode;
+    rfHead.pPrev        = &rfNode;
+}
+
+inline void Unlink(ListNode& rfNode) noexcept
+{
+    rfNode.pPrev->pNext = rfNode.pNext;
+    rfNode.pNext->pPrev = rfNode.pPrev;
+    rfNode.pPrev        = &rfNode;
+    rfNode.pNext        = &rfNode;
+}
+
+// rfFrom 의 모든 노드를 rfTo 로 옮긴다 (rfTo 는 비어 있어야 함).
+inline void Splice(ListNode& rfFrom, ListNode& rfTo) noexcept
+{
+    if (rfFrom.IsEmpty())
+    {
+        return;
+    }
+
+    rfTo.pNext         = rfFrom.pNext;
+    rfTo.pPrev         = rfFrom.pPrev;
+    rfTo.pNext->pPrev  = &rfTo;
+    rfTo.pPrev->pNext  = &rfTo;
+    rfFrom.pPrev       = &rfFrom;
+    rfFrom.pNext       = &rfFrom;
+}
 
 struct CallbackEntryScope
 {
-    Entry* m_pPrevious = nullptr;
+    inline static thread_local const void*  m_pCurrentOwner = nullptr;
+    inline static thread_local const Entry* m_pCurrentEntry = nullptr;
 
-    explicit CallbackEntryScope(Entry* pEntry) noexcept
-        : m_pPrevious(g_pCurrentCallbackEntry)
+    const void*  m_pPreviousOwner = nullptr;
+    const Entry* m_pPreviousEntry = nullptr;
+
+    CallbackEntryScope(const void* pOwner, const Entry* pEntry) noexcept
+        : m_pPreviousOwner(m_pCurrentOwner), m_pPreviousEntry(m_pCurrentEntry)
     {
-        g_pCurrentCallbackEntry = pEntry;
+        m_pCurrentOwner = pOwner;
+        m_pCurrentEntry = pEntry;
     }
 
     ~CallbackEntryScope()
     {
-        g_pCurrentCallbackEntry = m_pPrevious;
+        m_pCurrentOwner = m_pPreviousOwner;
+        m_pCurrentEntry = m_pPreviousEntry;
     }
 };
 
-// Design Ref: §2.2 — Windows 상대 지연(100ns 단위 음수 FILETIME).
-inline FILETIME MakeRelativeDueTime(Duration delay) noexcept
-{
-    const auto hundredNs = -static_cast<LONGLONG>(
-        std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count() / 100);
-
-    ULARGE_INTEGER ul{};
-    ul.QuadPart = static_cast<ULONGLONG>(hundredNs);
-
-    FILETIME ft{};
-    ft.dwLowDateTime  = ul.LowPart;
-    ft.dwHighDateTime = ul.HighPart;
-    return ft;
-}
-
 } // namespace LibCommons::detail
 
 
@@ -103,32 +145,66 @@ constexpr const char* kLogCategory = "TimerQueue";
 inline void LogTQInfo(const std::string& msg)    { LibCommons::Logger::GetInstance().LogInfo(kLogCategory, msg); }
 inline void LogTQWarning(const std::string& msg) { LibCommons::Logger::GetInstance().LogWarning(kLogCategory, msg); }
 inline void LogTQError(const std::string& msg)   { LibCommons::Logger::GetInstance().LogError(kLogCategory, msg); }
-inline void LogTQDebug(const std::string& msg)   { LibCommons::Logger::GetInstance().LogDebug(kLogCategory, msg); }
+
+constexpr std::uint32_t kLevel0Bits  = 8;
+constexpr std::uint32_t kLevelNBits  = 6;
+constexpr std::uint32_t kLevelCount  = 5;
+constexpr std::uint64_t kLevel0Size  = 1ull << kLevel0Bits;
+constexpr std::uint64_t kLevelNSize  = 1ull << kLevelNBits;
+constexpr std::uint64_t kLevel0Mask  = kLevel0Size - 1;
+constexpr std::uint64_t kLevelNMask  = kLevelNSize - 1;
+constexpr std::uint64_t kMaxDelayTicks = (1ull << (kLevel0Bits + (kLevelCount - 1) * kLevelNBits)) - 1;
+
+constexpr std::uint32_t kChunkBits = 12;
+constexpr std::uint32_t kChunkSize = 1u << kChunkBits;
+
+constexpr std::uint64_t kNoWakeTick = (std::numeric_limits<std::uint64_t>::max)();
+
+// level N (N >= 1) 이 담당하는 tick 비트의 시작 위치.
+constexpr std::uint32_t LevelShift(std::uint32_t level) noexcept
+{
+    return kLevel0Bits + (level - 1) * kLevelNBits;
+}
 } // anonymous namespace
 
 
-// Design Ref: §3 — 단일 mutex + unordered_map. 샤딩은 후속 최적화 스코프로 분리.
+// Design Ref: §3 — 단일 mutex 가 휠 + 엔트리 풀을 보호. 콜백은 mutex 밖에서 실행.
 struct TimerQueue::Impl
     : std::enable_shared_from_this<TimerQueue::Impl>
 {
-    std::mutex                                                   m_MapMutex;
-    std::unordered_map<TimerId, std::shared_ptr<detail::Entry>>  m_Entries;
-    std::atomic<TimerId>                                         m_NextId { 1 };
-    std::atomic<detail::QueueState>                              m_QueueState { detail::QueueState::Running };
+    explicit Impl(TimerQueueConfig config);
 
-    TimerId AllocateId() noexcept
-    {
-        TimerId id = m_NextId.fetch_add(1, std::memory_order_relaxed);
-        if (id == kInvalidTimerId)
-        {
-            id = m_NextId.fetch_add(1, std::memory_order_relaxed);
-        }
-        return id;
-    }
+    std::mutex                      m_Mutex;
+    std::condition_variable         m_WheelCv;      // 휠 스레드 wake
+    std::condition_variable         m_CallbackCv;   // Cancel/Shutdown 의 콜백 종료 대기
+    std::atomic<detail::QueueState> m_QueueState { detail::QueueState::Running };
 
-    TimerId ScheduleImpl(Duration delay, detail::TimerJob job, bool isPeriodic, Duration interval);
+    const Duration                        m_TickResolution;
+    const TimerExecutor                   m_Executor;
+    const std::chrono::steady_clock::time_point m_Epoch = std::chrono::steady_clock::now();
 
-    void RunEntry(detail::Entry& entry);
+    // 휠 (mutex 보호).
+    std::array<detail::ListNode, kLevel0Size>                                  m_Level0;
+    std::array<std::array<detail::ListNode, kLevelNSize>, kLevelCount - 1>     m_LevelN;
+    std::uint64_t m_CurrentTick  = 0;            // 다음에 처리할 tick
+    std::uint64_t m_NextWakeTick = kNoWakeTick;  // 휠 스레드가 잠든 경우 깨어날 tick (깨어 있으면 0)
+    std::size_t   m_ActiveCount  = 0;            // 휠에 걸린 엔트리 수
+
+    // 엔트리 풀 (mutex 보호).
+    std::vector<std::unique_ptr<detail::Entry[]>> m_Chunks;
+    detail::Entry*                                m_pFreeList = nullptr;
+
+    std::size_t m_InFlightCount = 0;     // 전체 inFlight 합
+    std::size_t m_CallbackWaiters = 0;   // m_CallbackCv 대기자 수 — 없으면 notify 생략
+
+    std::thread     m_Thread;
+    std::thread::id m_ThreadId;
+    bool            m_bStop = false;
+
+    void Start();
+    void Run();
+
+    TimerId ScheduleImpl(Duration delay, detail::TimerJob job, bool isPeriodic, Duration interval);
 
     // # 취소 시점 wait 정책 분기
     bool CancelImpl(TimerId id, bool waitForCallbacks, bool currentCallbackEntry);
@@ -138,209 +214,495 @@ struct TimerQueue::Impl
 
     // Design Ref: §3.2 QueueState — Running → ShuttingDown → Dead.
     void ShutdownImpl(bool waitForCallbacks);
+
+private:
+    std::uint64_t NowTick() const noexcept;
+    std::uint64_t DelayToExpires(Duration delay) const noexcept;
+    std::uint64_t DurationToTicks(Duration duration) const noexcept;
+
+    detail::Entry* AllocateEntry();
+    detail::Entry* FindEntry(TimerId id) noexcept;
+    detail::TimerJob FreeEntry(detail::Entry& rfEntry) noexcept;
+
+    void Insert(detail::Entry& rfEntry) noexcept;
+    bool Cascade(std::uint32_t level) noexcept;
+    void Advance(std::uint64_t nowTick, std::vector<detail::Entry*>& rfExpired);
+    std::uint64_t NextExpiresTick() const noexcept;
+
+    void Dispatch(std::vector<detail::Entry*>& rfExpired);
+    void RunEntry(detail::Entry& rfEntry);
+    void FinishEntry(detail::Entry& rfEntry);
 };
 
 
-namespace
+TimerQueue::Impl::Impl(TimerQueueConfig config)
+    : m_TickResolution((std::max)(config.tickResolution, Duration{ 1 }))
+    , m_Executor(std::move(config.executor))
+{
+}
+
+
+void TimerQueue::Impl::Start()
 {
+    // 스레드가 Impl 을 소유 — 콜백 안에서 TimerQueue 가 소멸되어도 (detach) 루프 종료까지 Impl 유지.
+    m_Thread = std::thread([pSelf = shared_from_this()]() { pSelf->Run(); });
+    m_ThreadId = m_Thread.get_id();
+}
+
+
+std::uint64_t TimerQueue::Impl::NowTick() const noexcept
+{
+    const auto elapsed = std::chrono::steady_clock::now() - m_Epoch;
+    return static_cast<std::uint64_t>(elapsed / m_TickResolution);
+}
+
 
-// Design Ref: §2.2 Callback flow — TP trampoline.
-void CALLBACK TpTimerCallback(PTP_CALLBACK_INSTANCE /*pInstance*/, PVOID pContext, PTP_TIMER /*pTimer*/)
+std::uint64_t TimerQueue::Impl::DelayToExpires(Duration delay) const noexcept
 {
-    auto* pEntry = static_cast<detail::Entry*>(pContext);
-    if (pEntry == nullptr) 
+    // 만료 tick 은 올림 — tick 시작 시각이 (지금 + delay) 이후여야 먼저 발사되지 않는다.
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_Epoch + (std::max)(delay, Duration::zero()));
+    const auto resolution = std::chrono::duration_cast<std::chrono::nanoseconds>(m_TickResolution);
+    return static_cast<std::uint64_t>((elapsed.count() + resolution.count() - 1) / resolution.count());
+}
+
+
+std::uint64_t TimerQueue::Impl::DurationToTicks(Duration duration) const noexcept
+{
+    const auto count = (std::max<std::int64_t>)(duration.count(), 1);
+    const auto resolution = m_TickResolution.count();
+    return static_cast<std::uint64_t>((count + resolution - 1) / resolution);
+}
+
+
+detail::Entry* TimerQueue::Impl::AllocateEntry()
+{
+    if (m_pFreeList == nullptr)
     {
-        return;
+        const auto base = static_cast<std::uint32_t>(m_Chunks.size()) << kChunkBits;
+        auto pChunk = std::make_unique<detail::Entry[]>(kChunkSize);
+
+        // 낮은 index 부터 꺼내도록 역순으로 free list 에 건다.
+        for (std::uint32_t i = kChunkSize; i-- > 0;)
+        {
+            pChunk[i].index = base + i;
+            pChunk[i].pNext = m_pFreeList;
+            m_pFreeList = &pChunk[i];
+        }
+        m_Chunks.push_back(std::move(pChunk));
+    }
+
+    detail::Entry* pEntry = m_pFreeList;
+    m_pFreeList = static_cast<detail::Entry*>(pEntry->pNext);
+    pEntry->pPrev = pEntry;
+    pEntry->pNext = pEntry;
+    return pEntry;
+}
+
+
+detail::Entry* TimerQueue::Impl::FindEntry(TimerId id) noexcept
+{
+    const auto slot = static_cast<std::uint32_t>(id & 0xFFFFFFFFull);
+    if (slot == 0)
+    {
+        return nullptr;
     }
 
-    auto pOwner = pEntry->owner.lock();
-    if (!pOwner)
+    const std::uint32_t index = slot - 1;
+    const std::size_t chunk = index >> kChunkBits;
+    if (chunk >= m_Chunks.size())
     {
-        return;
+        return nullptr;
     }
 
-    pOwner->RunEntry(*pEntry);
+    detail::Entry& rfEntry = m_Chunks[chunk][index & (kChunkSize - 1)];
+    if (rfEntry.generation != static_cast<std::uint32_t>(id >> 32) ||
+        rfEntry.state.load(std::memory_order_relaxed) == detail::EntryState::Free)
+    {
+        return nullptr;
+    }
+    return &rfEntry;
 }
 
-} // anonymous namespace
-
 
-TimerId TimerQueue::Impl::ScheduleImpl(Duration delay, detail::TimerJob job, bool isPeriodic, Duration interval)
+// 엔트리를 free list 로 반환. job 은 호출자가 mutex 밖에서 파괴하도록 돌려준다
+// (캡처된 객체의 소멸자가 TimerQueue 를 다시 호출해도 데드락 없음).
+detail::TimerJob TimerQueue::Impl::FreeEntry(detail::Entry& rfEntry) noexcept
 {
-    // Design Ref: §6.1 Error #1 — Shutdown 후 Schedule 거부.
-    if (m_QueueState.load(std::memory_order_acquire) != detail::QueueState::Running)
+    detail::TimerJob job = std::move(rfEntry.job);
+    rfEntry.job = {};
+    rfEntry.state.store(detail::EntryState::Free, std::memory_order_relaxed);
+
+    // 0 은 건너뛴다 — id 상위 32bit 가 0 인 TimerId 를 만들지 않음.
+    if (++rfEntry.generation == 0)
     {
-        LogTQWarning(std::format("Schedule after Shutdown rejected. Name : {}", job.name));
-        return kInvalidTimerId;
+        rfEntry.generation = 1;
     }
 
-    const TimerId id = AllocateId();
+    rfEntry.pPrev = nullptr;
+    rfEntry.pNext = m_pFreeList;
+    m_pFreeList = &rfEntry;
+    return job;
+}
 
-    auto pEntry = std::make_shared<detail::Entry>();
-    pEntry->id         = id;
-    pEntry->handle     = nullptr;
-    pEntry->job        = std::move(job);
-    pEntry->state.store(detail::EntryState::Scheduled, std::memory_order_relaxed);
-    pEntry->isPeriodic = isPeriodic;
-    pEntry->interval   = interval;
-    pEntry->owner      = this->shared_from_this();
 
-    detail::Entry* pRaw = pEntry.get();
+void TimerQueue::Impl::Insert(detail::Entry& rfEntry) noexcept
+{
+    // 이미 지난 만료는 다음 처리 tick 으로, 범위를 넘는 지연은 최대치로.
+    rfEntry.expires = std::clamp(rfEntry.expires, m_CurrentTick, m_CurrentTick + kMaxDelayTicks);
 
-    // Design Ref: §6.1 Error #2 — CreateThreadpoolTimer 실패 시 롤백.
-    PTP_TIMER hTimer = ::CreateThreadpoolTimer(TpTimerCallback, pRaw, nullptr);
-    if (hTimer == nullptr)
+    const std::uint64_t expires = rfEntry.expires;
+    const std::uint64_t delta = expires - m_CurrentTick;
+
+    detail::ListNode* pSlot = nullptr;
+    if (delta < kLevel0Size)
     {
-        LogTQError(std::format("CreateThreadpoolTimer failed. Name : {}, GLE : {}",
-            pRaw->job.name, ::GetLastError()));
-        return kInvalidTimerId;
+        pSlot = &m_Level0[expires & kLevel0Mask];
+    }
+    else
+    {
+        std::uint32_t level = 1;
+        while (level + 1 < kLevelCount && delta >= (1ull << LevelShift(level + 1)))
+        {
+            ++level;
+        }
+        pSlot = &m_LevelN[level - 1][(expires >> LevelShift(level)) & kLevelNMask];
     }
 
-    pEntry->handle = hTimer;
+    detail::LinkTail(*pSlot, rfEntry);
+}
+
+
+// 상위 level 칸 하나를 풀어 현재 tick 기준으로 재삽입. 반환값: 이 level 의 index 가 0 으로 돌았는지.
+bool TimerQueue::Impl::Cascade(std::uint32_t level) noexcept
+{
+    const std::uint64_t index = (m_CurrentTick >> LevelShift(level)) & kLevelNMask;
+
+    detail::ListNode pending;
+    detail::Splice(m_LevelN[level - 1][index], pending);
 
+    while (!pending.IsEmpty())
     {
-        std::lock_guard<std::mutex> lock(m_MapMutex);
-        m_Entries.emplace(id, pEntry);
+        auto* pEntry = static_cast<detail::Entry*>(pending.pNext);
+        detail::Unlink(*pEntry);
+        Insert(*pEntry);
     }
 
-    FILETIME    due    = detail::MakeRelativeDueTime(delay);
-    const DWORD period = isPeriodic
-        ? static_cast<DWORD>(std::max<std::int64_t>(0, interval.count()))
-        : 0u;
+    return index == 0;
+}
+
+
+void TimerQueue::Impl::Advance(std::uint64_t nowTick, std::vector<detail::Entry*>& rfExpired)
+{
+    while (m_CurrentTick <= nowTick)
+    {
+        // 걸린 타이머가 없으면 tick 을 하나씩 밟을 필요가 없다.
+        if (m_ActiveCount == 0)
+        {
+            m_CurrentTick = nowTick + 1;
+            return;
+        }
 
-    ::SetThreadpoolTimer(hTimer, &due, period, 0);
+        const std::uint64_t index = m_CurrentTick & kLevel0Mask;
+        if (index == 0)
+        {
+            for (std::uint32_t level = 1; level < kLevelCount && Cascade(level); ++level)
+            {
+            }
+        }
 
-    LogTQDebug(std::format("Scheduled. Id : {}, Name : {}, DelayMs : {}, Periodic : {}, IntervalMs : {}",
-        id, pRaw->job.name, delay.count(), isPeriodic, interval.count()));
+        detail::ListNode expired;
+        detail::Splice(m_Level0[index], expired);
+        ++m_CurrentTick;
 
-    return id;
+        while (!expired.IsEmpty())
+        {
+            auto* pEntry = static_cast<detail::Entry*>(expired.pNext);
+            detail::Unlink(*pEntry);
+
+            ++pEntry->inFlight;
+            ++m_InFlightCount;
+
+            if (pEntry->isPeriodic)
+            {
+                // 기준 시각에 주기를 더해 drift 없이 재등록. 늦었으면 다음 tick 으로 (몰아서 발사하지 않음).
+                pEntry->expires += pEntry->intervalTicks;
+                Insert(*pEntry);
+            }
+            else
+            {
+                --m_ActiveCount;
+                pEntry->state.store(detail::EntryState::Expired, std::memory_order_relaxed);
+            }
+
+            rfExpired.push_back(pEntry);
+        }
+    }
 }
 
 
-void TimerQueue::Impl::RunEntry(detail::Entry& entry)
+std::uint64_t TimerQueue::Impl::NextExpiresTick() const noexcept
 {
-    auto keepAlive = entry.shared_from_this();
-    detail::CallbackEntryScope callbackScope(&entry);
+    if (m_ActiveCount == 0)
+    {
+        return kNoWakeTick;
+    }
 
-    // Design Ref: §3.2 — Scheduled → Running CAS. Q3-a 겹침 허용으로 실패해도 진행.
-    detail::EntryState expected = detail::EntryState::Scheduled;
-    entry.state.compare_exchange_strong(
-        expected, detail::EntryState::Running,
-        std::memory_order_acq_rel, std::memory_order_acquire);
+    // level0 의 남은 칸 중 첫 비어 있지 않은 칸. 없으면 다음 cascade 시점에 깨어나 상위 level 을 푼다.
+    // index 0 이면 이 tick 의 cascade 가 아직이므로 바로 깨어난다.
+    const std::uint64_t index = m_CurrentTick & kLevel0Mask;
+    if (index == 0)
+    {
+        return m_CurrentTick;
+    }
 
-    // Design Ref: §3.2 — Cancelled 상태이면 실행 스킵.
-    if (expected == detail::EntryState::Cancelled)
+    for (std::uint64_t offset = 0; index + offset < kLevel0Size; ++offset)
     {
-        return;
+        if (!m_Level0[index + offset].IsEmpty())
+        {
+            return m_CurrentTick + offset;
+        }
     }
+    return m_CurrentTick + (kLevel0Size - index);
+}
 
-    // Design Ref: §6.3 — Callback exception policy. 전역 catch-all 로 서버 보호.
-    try
+
+void TimerQueue::Impl::Run()
+{
+    std::vector<detail::Entry*> expired;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (!m_bStop)
     {
-        entry.job.invoke();
+        Advance(NowTick(), expired);
+
+        if (!expired.empty())
+        {
+            m_NextWakeTick = 0;
+            lock.unlock();
+            Dispatch(expired);
+            expired.clear();
+            lock.lock();
+            continue;
+        }
+
+        m_NextWakeTick = NextExpiresTick();
+        if (m_NextWakeTick == kNoWakeTick)
+        {
+            m_WheelCv.wait(lock);
+        }
+        else
+        {
+            m_WheelCv.wait_until(lock, m_Epoch + m_TickResolution * static_cast<std::int64_t>(m_NextWakeTick));
+        }
+        m_NextWakeTick = 0;
     }
-    catch (const std::exception& e)
+}
+
+
+void TimerQueue::Impl::Dispatch(std::vector<detail::Entry*>& rfExpired)
+{
+    if (!m_Executor)
     {
-        LogTQError(std::format("Callback threw. Name : {}, What : {}", entry.job.name, e.what()));
+        for (detail::Entry* pEntry : rfExpired)
+        {
+            RunEntry(*pEntry);
+        }
+        return;
     }
-    catch (...)
+
+    for (detail::Entry* pEntry : rfExpired)
     {
-        LogTQError(std::format("Callback threw unknown. Name : {}", entry.job.name));
+        try
+        {
+            m_Executor([pSelf = shared_from_this(), pEntry]() { pSelf->RunEntry(*pEntry); });
+        }
+        catch (const std::exception& e)
+        {
+            LogTQError(std::format("Executor threw. Name : {}, What : {}", pEntry->job.name, e.what()));
+            FinishEntry(*pEntry);
+        }
     }
+}
+
 
-    if (!entry.isPeriodic)
+void TimerQueue::Impl::RunEntry(detail::Entry& rfEntry)
+{
+    // Design Ref: §3.2 — 실행 직전 상태 확인. 만료 후 실행 전에 Cancel 되었으면 스킵.
+    bool bRun = false;
+    if (rfEntry.isPeriodic)
     {
-        // one-shot 엔트리: Completed 로 표기. 실제 맵 제거는 Cancel/Shutdown/소멸자에서 일괄 처리.
-        entry.state.store(detail::EntryState::Completed, std::memory_order_release);
+        bRun = rfEntry.state.load(std::memory_order_acquire) == detail::EntryState::Scheduled;
     }
     else
     {
-        // periodic: Running → Scheduled 로 되돌려 다음 tick 대기.
-        // Cancel 이 끼어들어 Cancelled 가 된 경우 CAS 실패 → 그대로 둠 (Cancel 이 뒤처리).
-        detail::EntryState runningState = detail::EntryState::Running;
-        entry.state.compare_exchange_strong(
-            runningState, detail::EntryState::Scheduled,
+        detail::EntryState expected = detail::EntryState::Expired;
+        bRun = rfEntry.state.compare_exchange_strong(
+            expected, detail::EntryState::Running,
             std::memory_order_acq_rel, std::memory_order_acquire);
     }
 
-    if (entry.closeAfterCallback.exchange(false, std::memory_order_acq_rel))
+    if (bRun)
     {
-        PTP_TIMER h = entry.handle;
-        entry.handle = nullptr;
+        detail::CallbackEntryScope callbackScope(this, &rfEntry);
 
-        if (h != nullptr)
+        // Design Ref: §6.3 — Callback exception policy. 전역 catch-all 로 서버 보호.
+        try
+        {
+            rfEntry.job.invoke();
+        }
+        catch (const std::exception& e)
         {
-            ::CloseThreadpoolTimer(h);
+            LogTQError(std::format("Callback threw. Name : {}, What : {}", rfEntry.job.name, e.what()));
+        }
+        catch (...)
+        {
+            LogTQError(std::format("Callback threw unknown. Name : {}", rfEntry.job.name));
         }
     }
+
+    FinishEntry(rfEntry);
 }
 
 
-// Design Ref: §2.2 Cancel flow — Fast/Wait path + 현재 callback 엔트리 지연 close.
-bool TimerQueue::Impl::CancelImpl(TimerId id, bool waitForCallbacks, bool currentCallbackEntry)
+void TimerQueue::Impl::FinishEntry(detail::Entry& rfEntry)
 {
-    if (id == kInvalidTimerId)
+    detail::TimerJob released;   // lock 해제 후 파괴
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    --m_InFlightCount;
+    if (--rfEntry.inFlight == 0 &&
+        rfEntry.state.load(std::memory_order_relaxed) != detail::EntryState::Scheduled)
     {
-        return false;
+        released = FreeEntry(rfEntry);
     }
 
-    // 맵에서 마지막 공개 참조를 제거 (찾지 못하면 false).
-    std::shared_ptr<detail::Entry> pEntry;
+    if (m_CallbackWaiters != 0)
     {
-        std::lock_guard<std::mutex> lock(m_MapMutex);
-        auto it = m_Entries.find(id);
-        if (it == m_Entries.end())
-        {
-            return false;
-        }
-        pEntry = std::move(it->second);
-        m_Entries.erase(it);
+        m_CallbackCv.notify_all();
     }
+}
 
-    if (!pEntry)
+
+TimerId TimerQueue::Impl::ScheduleImpl(Duration delay, detail::TimerJob job, bool isPeriodic, Duration interval)
+{
+    // Design Ref: §6.1 Error #1 — Shutdown 후 Schedule 거부.
+    if (m_QueueState.load(std::memory_order_acquire) != detail::QueueState::Running)
     {
-        return false;
+        LogTQWarning(std::format("Schedule after Shutdown rejected. Name : {}", job.name));
+        return kInvalidTimerId;
     }
 
-    // 상태 표기: Cancelled. 현재 실행 중인 콜백은 상태 체크로 조기 반환하지 않지만,
-    // periodic 콜백의 재-Scheduled CAS 가 실패하여 추가 발사가 차단된다.
-    pEntry->state.store(detail::EntryState::Cancelled, std::memory_order_release);
-
-    PTP_TIMER h = pEntry->handle;
+    const std::uint64_t expires = DelayToExpires(delay);
+    const std::uint64_t intervalTicks = isPeriodic ? DurationToTicks(interval) : 0;
 
-    if (h != nullptr)
+    TimerId id = kInvalidTimerId;
+    bool bWake = false;
     {
-        ::SetThreadpoolTimer(h, nullptr, 0, 0);
+        std::lock_guard<std::mutex> lock(m_Mutex);
 
-        if (currentCallbackEntry)
+        // 휠이 비어 있는 동안 멈춰 있던 tick 을 현재로 당긴다 — 깨어난 뒤 빈 tick 을 하나씩 밟지 않도록.
+        if (m_ActiveCount == 0)
         {
-            pEntry->closeAfterCallback.store(true, std::memory_order_release);
+            m_CurrentTick = (std::max)(m_CurrentTick, NowTick());
         }
-        else
-        {
-            ::WaitForThreadpoolTimerCallbacks(h, waitForCallbacks ? TRUE : FALSE);
-            ::CloseThreadpoolTimer(h);
-            pEntry->handle = nullptr;
-        }
-    }
 
-    LogTQDebug(std::format("Cancelled. Id : {}, Name : {}, Wait : {}, CurrentCallback : {}",
-        id, pEntry->job.name, waitForCallbacks, currentCallbackEntry));
+        detail::Entry* pEntry = AllocateEntry();
+        pEntry->expires       = expires;
+        pEntry->intervalTicks = intervalTicks;
+        pEntry->isPeriodic    = isPeriodic;
+        pEntry->job           = std::move(job);
+        pEntry->state.store(detail::EntryState::Scheduled, std::memory_order_relaxed);
+
+        Insert(*pEntry);
+        ++m_ActiveCount;
 
-    return true;
+        // 휠 스레드가 더 늦은 시각까지 잠들어 있을 때만 깨운다.
+        bWake = pEntry->expires < m_NextWakeTick;
+        id = pEntry->Id();
+    }
+
+    if (bWake)
+    {
+        m_WheelCv.notify_one();
+    }
+    return id;
 }
 
 
-bool TimerQueue::Impl::IsCurrentCallbackEntry(TimerId id) const noexcept
+// Design Ref: §2.2 Cancel flow — Fast/Wait path. 현재 callback 엔트리는 대기하지 않는다.
+bool TimerQueue::Impl::CancelImpl(TimerId id, bool waitForCallbacks, bool currentCallbackEntry)
 {
-    const detail::Entry* pCurrent = detail::g_pCurrentCallbackEntry;
-    if (pCurrent == nullptr || pCurrent->id != id)
+    if (id == kInvalidTimerId)
+    {
+        return false;
+    }
+
+    detail::TimerJob released;   // lock 해제 후 파괴
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    detail::Entry* pEntry = FindEntry(id);
+    if (pEntry == nullptr)
     {
         return false;
     }
 
-    auto pOwner = pCurrent->owner.lock();
-    return pOwner && pOwner.get() == this;
+    bool bCancelled = false;
+    switch (pEntry->state.load(std::memory_order_acquire))
+    {
+    case detail::EntryState::Scheduled:
+        detail::Unlink(*pEntry);
+        --m_ActiveCount;
+        pEntry->state.store(detail::EntryState::Cancelled, std::memory_order_release);
+        bCancelled = true;
+        break;
+
+    case detail::EntryState::Expired:
+    {
+        // 실행 직전 RunEntry 의 Expired → Running CAS 와 경합.
+        detail::EntryState expected = detail::EntryState::Expired;
+        bCancelled = pEntry->state.compare_exchange_strong(
+            expected, detail::EntryState::Cancelled,
+            std::memory_order_acq_rel, std::memory_order_acquire);
+        break;
+    }
+
+    default:
+        // Running (one-shot 실행 중) / Cancelled — 더 막을 발사가 없다.
+        break;
+    }
+
+    if (pEntry->inFlight == 0)
+    {
+        released = FreeEntry(*pEntry);
+        return bCancelled;
+    }
+
+    // 휠 스레드(inline 실행)에서는 다른 콜백이 동시에 돌 수 없으므로 대기하지 않는다.
+    if (waitForCallbacks && !currentCallbackEntry && std::this_thread::get_id() != m_ThreadId)
+    {
+        const std::uint32_t generation = pEntry->generation;
+
+        ++m_CallbackWaiters;
+        m_CallbackCv.wait(lock, [pEntry, generation]()
+            {
+                return pEntry->inFlight == 0 || pEntry->generation != generation;
+            });
+        --m_CallbackWaiters;
+    }
+
+    return bCancelled;
+}
+
+
+bool TimerQueue::Impl::IsCurrentCallbackEntry(TimerId id) const noexcept
+{
+    const detail::Entry* pCurrent = detail::CallbackEntryScope::m_pCurrentEntry;
+    return pCurrent != nullptr &&
+        detail::CallbackEntryScope::m_pCurrentOwner == this &&
+        pCurrent->Id() == id;
 }
 
 
@@ -359,25 +721,77 @@ void TimerQueue::Impl::ShutdownImpl(bool waitForCallbacks)
 
     LogTQInfo(std::format("Shutdown started. WaitForCallbacks : {}", waitForCallbacks));
 
-    // 활성 ID 목록 스냅샷 후 개별 Cancel.
-    std::vector<TimerId> ids;
     {
-        std::lock_guard<std::mutex> lock(m_MapMutex);
-        ids.reserve(m_Entries.size());
-        for (auto const& entryPair : m_Entries)
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_bStop = true;
+    }
+    m_WheelCv.notify_all();
+
+    const bool bOnWheelThread = std::this_thread::get_id() == m_ThreadId;
+    if (m_Thread.joinable())
+    {
+        // 콜백 안에서 소멸되는 경우 자기 자신을 join 할 수 없다 — 스레드가 Impl 을 쥐고 스스로 끝난다.
+        if (bOnWheelThread)
         {
-            ids.push_back(entryPair.first);
+            m_Thread.detach();
+        }
+        else
+        {
+            m_Thread.join();
         }
     }
 
-    for (TimerId id : ids)
+    std::vector<detail::TimerJob> released;   // lock 해제 후 파괴
+    std::size_t cancelledCount = 0;
     {
-        const bool currentCallbackEntry = IsCurrentCallbackEntry(id);
-        CancelImpl(id, waitForCallbacks, currentCallbackEntry);
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        for (auto& pChunk : m_Chunks)
+        {
+            for (std::uint32_t i = 0; i < kChunkSize; ++i)
+            {
+                detail::Entry& rfEntry = pChunk[i];
+
+                detail::EntryState state = rfEntry.state.load(std::memory_order_acquire);
+                if (state == detail::EntryState::Free)
+                {
+                    continue;
+                }
+
+                if (state == detail::EntryState::Scheduled)
+                {
+                    detail::Unlink(rfEntry);
+                    --m_ActiveCount;
+                    rfEntry.state.store(detail::EntryState::Cancelled, std::memory_order_release);
+                    ++cancelledCount;
+                }
+                else if (state == detail::EntryState::Expired &&
+                         rfEntry.state.compare_exchange_strong(
+                             state, detail::EntryState::Cancelled,
+                             std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    ++cancelledCount;
+                }
+
+                if (rfEntry.inFlight == 0)
+                {
+                    released.push_back(FreeEntry(rfEntry));
+                }
+            }
+        }
+
+        // 자기 콜백 안에서의 Shutdown 은 대기하지 않는다 (자기 자신을 기다리게 됨).
+        const bool bInCallback = detail::CallbackEntryScope::m_pCurrentOwner == this;
+        if (waitForCallbacks && !bInCallback && !bOnWheelThread)
+        {
+            ++m_CallbackWaiters;
+            m_CallbackCv.wait(lock, [this]() { return m_InFlightCount == 0; });
+            --m_CallbackWaiters;
+        }
     }
 
     m_QueueState.store(detail::QueueState::Dead, std::memory_order_release);
-    LogTQInfo(std::format("Shutdown completed. Cancelled : {}", ids.size()));
+    LogTQInfo(std::format("Shutdown completed. Cancelled : {}", cancelledCount));
 }
 
 
@@ -386,10 +800,19 @@ void TimerQueue::Impl::ShutdownImpl(bool waitForCallbacks)
 // ========================================================================
 
 TimerQueue::TimerQueue()
-    : m_pImpl(std::make_shared<Impl>())
+    : TimerQueue(TimerQueueConfig{})
 {
+}
+
+
+TimerQueue::TimerQueue(TimerQueueConfig config)
+    : m_pImpl(std::make_shared<Impl>(std::move(config)))
+{
+    m_pImpl->Start();
+
     // Logger 카테고리 등록(최초 1회, 이후는 spdlog 직접 경로).
-    LogTQInfo("TimerQueue constructed");
+    LogTQInfo(std::format("TimerQueue constructed. TickMs : {}, Executor : {}",
+        m_pImpl->m_TickResolution.count(), m_pImpl->m_Executor ? "custom" : "inline"));
 }
 
 
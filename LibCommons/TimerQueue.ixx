@@ -1,15 +1,14 @@
 module;
 
-#include <Windows.h>
-#include <threadpoolapiset.h>
+#include <cstdint>
 
 export module commons.timer_queue;
 
 import std;
 import commons.singleton;
 
-// Design Ref: §4.1 — Public API module. Windows 타입은 GMF 안에서만 사용, export 심볼에는 노출하지 않는다.
-// Design Ref: §2 Option B (Clean) — PImpl, 상태머신, ScopedTimer, 샤딩은 구현 파일에 은닉.
+// Design Ref: §4.1 — Public API module. 플랫폼 타입은 export 심볼에 노출하지 않는다.
+// Design Ref: §2 Option B (Clean) — PImpl, 상태머신, ScopedTimer, 타이밍 휠은 구현 파일에 은닉.
 
 namespace LibCommons
 {
@@ -19,8 +18,18 @@ export using Duration = std::chrono::milliseconds;
 
 export constexpr TimerId kInvalidTimerId = 0;
 
+// 만료된 콜백을 실행할 executor. 비어 있으면 휠 스레드에서 직접 실행 (짧은 콜백 전제).
+// 긴 콜백은 스레드 풀 등으로 넘기는 executor 를 주입한다 — 같은 periodic 타이머의 콜백이 겹칠 수 있다.
+export using TimerExecutor = std::function<void(std::function<void()>)>;
+
+export struct TimerQueueConfig
+{
+    Duration      tickResolution { 1 };  // 휠 1칸 시간. 만료는 이 단위로 올림 (먼저 발사되지 않음).
+    TimerExecutor executor;
+};
+
 // Design Ref: §4.1 — Command 인터페이스. 메타데이터/정책(재시도 등) 필요 시 상속.
-// Thread-safety: Execute()는 TP 풀 스레드에서 동시 호출될 수 있음 (Q3-a 겹침 허용). 호출자 책임.
+// Thread-safety: Execute()는 executor 스레드에서 동시 호출될 수 있음 (Q3-a 겹침 허용). 호출자 책임.
 export struct ITimerCommand
 {
     virtual ~ITimerCommand() = default;
@@ -63,7 +72,9 @@ private:
 // Plan SC: FR-01, FR-02, FR-03, FR-04, FR-05, FR-06, FR-07, FR-08, FR-09, FR-10.
 // Singleton: 기존 LibCommons::SingleTon<> 패턴 상속. GetInstance() 는 상속받아 자동 제공.
 // Thread-safety: 모든 public 메서드는 다중 스레드에서 동시 호출 안전.
-//                단, 등록된 task 는 TP 풀 스레드에서 동시 실행될 수 있으므로 호출자 thread-safety 책임.
+//                단, 등록된 task 는 executor 스레드에서 실행되므로 호출자 thread-safety 책임.
+// 엔진: 계층형 타이밍 휠 (256 + 64x4 칸) + 전용 휠 스레드. Schedule/Cancel 은 O(1) —
+//       엔트리는 슬랩에서 꺼내 쓰는 intrusive 노드라 타이머당 OS 객체 / 맵 노드를 만들지 않는다.
 export class TimerQueue : public SingleTon<TimerQueue>
 {
 public:
@@ -76,6 +87,7 @@ public:
     // 독립 인스턴스(예: 단위 테스트에서의 격리, 특정 서브시스템 전용 TimerQueue) 생성도 허용한다.
     // Logger 처럼 private 으로 두는 것도 가능하지만 testability 와 유연성을 우선.
     TimerQueue();
+    explicit TimerQueue(TimerQueueConfig config);
     ~TimerQueue();
 
     // Singleton 상속이 friend 필요 — 기본 ctor 를 호출하기 위해.
@@ -102,7 +114,8 @@ public:
 
     TimerId SchedulePeriodic(Duration interval, std::unique_ptr<ITimerCommand> cmd);
 
-    // Design Ref: §2.2 Cancel flow — Fast/Wait path. true=실제 취소 or 이미 완료, false=id 없음/중복.
+    // Design Ref: §2.2 Cancel flow — Fast/Wait path. true=발사 전 취소 또는 periodic 중지, false=id 없음/중복/이미 발사된 one-shot.
+    // 진행 중 콜백이 있으면 끝날 때까지 대기 (콜백 안에서 자기 자신을 취소할 때는 대기하지 않음).
     bool Cancel(TimerId id);
 
     // Design Ref: §3.2 QueueState — Running → ShuttingDown → Dead 전이.
@@ -0,0 +1,120 @@
+﻿#include "CppUnitTest.h"
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/null_sink.h>
+
+import commons.async_log_backend;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        // 한 번에 몰아 넣는 호출 수. 두 경로 모두 대기열 (ring / spdlog 큐) 보다 작게 잡아 호출 스레드 비용만 잰다.
+        constexpr int kBatchSize = 4096;
+        constexpr int kBatches = 50;
+        constexpr std::size_t kQueueCapacity = 8192;
+
+        struct PerCallResult
+        {
+            double MedianNs = 0;
+            double BestNs = 0;
+        };
+
+        // batch 단위로 호출 스레드 시간만 재고, batch 사이에는 백그라운드가 비울 때까지 기다린다 (측정 제외).
+        template<typename TLogOnce, typename TWaitDrained>
+        PerCallResult MeasurePerCall(TLogOnce&& logOnce, TWaitDrained&& waitDrained)
+        {
+            std::vector<double> perCallNs;
+            perCallNs.reserve(kBatches);
+
+            for (int batch = 0; batch < kBatches; ++batch)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < kBatchSize; ++i)
+                {
+                    logOnce(i);
+                }
+                const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+                perCallNs.push_back(elapsed.count() / kBatchSize);
+
+                waitDrained();
+            }
+
+            std::sort(perCallNs.begin(), perCallNs.end());
+            return { perCallNs[perCallNs.size() / 2], perCallNs.front() };
+        }
+    }
+
+    TEST_CLASS(AsyncLogBackendBenchmarkTests)
+    {
+    public:
+        // 숫자 + 문자열 + 실수 인자 1줄 — 호출 스레드 비용 (AsyncLogBackend 리터럴 경로 vs spdlog async_logger vs 동기 logger).
+        TEST_METHOD(Benchmark_CallerCostPerLog_NullSink)
+        {
+            const std::string sessionName = "session-42";
+
+            PerCallResult backendResult;
+            {
+                LibCommons::AsyncLogOptions options;
+                options.RingCapacity = kQueueCapacity;
+                options.Overflow = LibCommons::EAsyncLogOverflow::Block;
+
+                LibCommons::AsyncLogBackend backend(options, { std::make_shared<spdlog::sinks::null_sink_mt>() }, spdlog::level::info);
+                const std::uint16_t categoryId = backend.RegisterCategory("Benchmark");
+                backend.Start();
+
+                backendResult = MeasurePerCall(
+                    [&](int i) { backend.PushRecord(categoryId, spdlog::level::info, "Session Id : {}, Name : {}, Ratio : {}", i, sessionName, 0.5); },
+                    [&]()
+                    {
+                        while (backend.GetStats().Written < backend.GetStats().Enqueued)
+                        {
+                            std::this_thread::yield();
+                        }
+                    });
+                backend.Stop();
+            }
+
+            PerCallResult spdlogAsyncResult;
+            {
+                auto pPool = std::make_shared<spdlog::details::thread_pool>(kQueueCapacity, 1);
+                auto pLogger = std::make_shared<spdlog::async_logger>("Benchmark", std::make_shared<spdlog::sinks::null_sink_mt>(), pPool,
+                    spdlog::async_overflow_policy::block);
+
+                spdlogAsyncResult = MeasurePerCall(
+                    [&](int i) { pLogger->info("Session Id : {}, Name : {}, Ratio : {}", i, sessionName, 0.5); },
+                    [&]()
+                    {
+                        while (pPool->queue_size() > 0)
+                        {
+                            std::this_thread::yield();
+                        }
+                    });
+            }
+
+            PerCallResult syncResult;
+            {
+                spdlog::logger logger("Benchmark", std::make_shared<spdlog::sinks::null_sink_mt>());
+
+                syncResult = MeasurePerCall(
+                    [&](int i) { logger.info("Session Id : {}, Name : {}, Ratio : {}", i, sessionName, 0.5); },
+                    []() {});
+            }
+
+            std::string msg = std::format("Log caller cost per call ({} x {}, null sink) — AsyncLogBackend median: {:.0f} ns (best {:.0f}), spdlog async_logger median: {:.0f} ns (best {:.0f}), spdlog sync median: {:.0f} ns (best {:.0f})",
+                kBatches, kBatchSize, backendResult.MedianNs, backendResult.BestNs, spdlogAsyncResult.MedianNs, spdlogAsyncResult.BestNs, syncResult.MedianNs, syncResult.BestNs);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+    };
+}
@@ -0,0 +1,247 @@
+﻿#include "CppUnitTest.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <spdlog/sinks/base_sink.h>
+
+import commons.async_log_backend;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        // "카테고리|메시지" 로 모아 두는 sink.
+        class CollectingSink final : public spdlog::sinks::base_sink<std::mutex>
+        {
+        public:
+            std::vector<std::string> GetLines()
+            {
+                auto lock = std::lock_guard(mutex_);
+                return m_Lines;
+            }
+
+        protected:
+            void sink_it_(const spdlog::details::log_msg& rfMessage) override
+            {
+                m_Lines.push_back(std::string(rfMessage.logger_name.data(), rfMessage.logger_name.size())
+                    + "|" + std::string(rfMessage.payload.data(), rfMessage.payload.size()));
+            }
+
+            void flush_() override {}
+
+        private:
+            std::vector<std::string> m_Lines;
+        };
+
+        LibCommons::AsyncLogOptions MakeOptions(std::size_t ringCapacity)
+        {
+            LibCommons::AsyncLogOptions options;
+            options.RingCapacity = ringCapacity;
+            return options;
+        }
+
+        bool Contains(const std::vector<std::string>& rfLines, const std::string& rfLine)
+        {
+            return std::find(rfLines.begin(), rfLines.end(), rfLine) != rfLines.end();
+        }
+    }
+
+    TEST_CLASS(AsyncLogBackendTests)
+    {
+    public:
+        // 문자열 인자는 적재 시점에 복사 — 임시 std::string 이 사라진 뒤 포맷해도 같은 결과.
+        TEST_METHOD(Push_DeferredFormat_CopiesArguments)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(64), { pSink }, spdlog::level::info);
+
+            {
+                std::string temporary = "session-7";
+                backend.Push("IOSession", spdlog::level::info, "Name : {}, Id : {}, Ratio : {}, Tag : {}", temporary, 7, 0.5, "lit");
+            }
+            backend.Push("IOSession", spdlog::level::debug, "filtered {}", 1);
+
+            backend.Start();
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            Assert::IsTrue(Contains(lines, "IOSession|Name : session-7, Id : 7, Ratio : 0.5, Tag : lit"));
+
+            const auto stats = backend.GetStats();
+            Assert::AreEqual<std::uint64_t>(1, stats.Enqueued, L"debug 는 레벨에서 걸러짐");
+            Assert::AreEqual<std::uint64_t>(1, stats.Written);
+            Assert::AreEqual<std::uint64_t>(0, stats.EagerFormatted);
+        }
+
+        // 한 칸에 안 들어가는 인자는 뒤 칸까지 이어 써서 잘리지 않는다 (포맷은 여전히 백그라운드).
+        TEST_METHOD(Push_LongArguments_SpanSlots)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(64), { pSink }, spdlog::level::info);
+
+            backend.Push("IOSession", spdlog::level::info, "Payload : {}", std::string(1000, 'x'));
+            backend.Push("IOSession", spdlog::level::info, "after {}", 1);
+            backend.Start();
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            Assert::AreEqual("IOSession|Payload : " + std::string(1000, 'x'), lines[0]);
+            Assert::AreEqual(std::string("IOSession|after 1"), lines[1]);
+
+            const auto stats = backend.GetStats();
+            Assert::AreEqual<std::uint64_t>(1, stats.Spanned);
+            Assert::AreEqual<std::uint64_t>(0, stats.EagerFormatted);
+            Assert::AreEqual<std::uint64_t>(0, stats.Truncated);
+        }
+
+        // ring 끝에서 감기는 여러 칸 record 도 그대로 이어 붙는다.
+        TEST_METHOD(Push_SpannedRecord_WrapsAroundRing)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(8), { pSink }, spdlog::level::info);
+            backend.Start();
+
+            std::string payload;
+            for (int i = 0; i < 700; ++i)
+            {
+                payload.push_back(static_cast<char>('a' + i % 26));
+            }
+
+            // 칸 3개짜리 record 를 반복해 Head 가 ring 끝을 여러 번 넘게 한다.
+            for (int i = 0; i < 20; ++i)
+            {
+                while (backend.GetStats().Enqueued - backend.GetStats().Written > 1)
+                {
+                    std::this_thread::yield();
+                }
+                backend.Push("IOSession", spdlog::level::info, "{} {}", i, payload);
+            }
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            for (int i = 0; i < 20; ++i)
+            {
+                Assert::IsTrue(Contains(lines, "IOSession|" + std::to_string(i) + " " + payload));
+            }
+            Assert::AreEqual<std::uint64_t>(20, backend.GetStats().Spanned);
+            Assert::AreEqual<std::uint64_t>(0, backend.GetStats().Dropped);
+        }
+
+        // 최대 칸 수로도 모자라면 호출 스레드에서 포맷해 잘라 내고 끝에 표시한다.
+        TEST_METHOD(Push_OversizedMessage_TruncatedAndMarked)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(64), { pSink }, spdlog::level::info);
+
+            backend.Push("IOSession", spdlog::level::info, "Payload : {}", std::string(100000, 'x'));
+            backend.Start();
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            const std::size_t capacity = LibCommons::AsyncLogRecord::GetPayloadCapacity(LibCommons::AsyncLogRecord::kMaxSlots);
+            Assert::IsTrue(lines.front().starts_with("IOSession|Payload : xxx"));
+            Assert::IsTrue(lines.front().ends_with(" ...[truncated]"));
+            Assert::AreEqual<std::size_t>(std::string("IOSession|").size() + capacity, lines.front().size());
+
+            const auto stats = backend.GetStats();
+            Assert::AreEqual<std::uint64_t>(1, stats.Truncated);
+            Assert::AreEqual<std::uint64_t>(1, stats.EagerFormatted);
+        }
+
+        // 리터럴 포맷 (LogFormat) 은 복사하지 않는다 — 긴 포맷이어도 인자만 작으면 한 칸.
+        TEST_METHOD(PushRecord_LiteralFormat_NotCopied)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(64), { pSink }, spdlog::level::info);
+            const std::uint16_t categoryId = backend.RegisterCategory("IOSession");
+
+            static constexpr char kLongFormat[] =
+                "Session state dump ------------------------------------------------------------------------------------ "
+                "------------------------------------------------------------------------------------------------------ "
+                "------------------------------------------------------------------------------------ Id : {}, Bytes : {}";
+            static_assert(sizeof(kLongFormat) > LibCommons::AsyncLogRecord::kDataCapacity);
+
+            backend.PushRecord(categoryId, spdlog::level::info, kLongFormat, 7, 1024);
+            backend.Start();
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            Assert::IsTrue(lines.front().starts_with("IOSession|Session state dump ---"));
+            Assert::IsTrue(lines.front().ends_with("Id : 7, Bytes : 1024"));
+
+            const auto stats = backend.GetStats();
+            Assert::AreEqual<std::uint64_t>(0, stats.Spanned, L"리터럴 포맷은 record 에 복사되지 않아야 함");
+            Assert::AreEqual<std::uint64_t>(0, stats.EagerFormatted);
+        }
+
+        // 잘못된 포맷 문자열은 백그라운드 스레드를 죽이지 않고 원문과 함께 기록.
+        TEST_METHOD(Push_BadFormat_WritesFormatError)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(64), { pSink }, spdlog::level::info);
+
+            backend.Push("IOSession", spdlog::level::err, "missing {} {}", 1);
+            backend.Push("IOSession", spdlog::level::err, "next {}", 2);
+            backend.Start();
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            Assert::IsTrue(lines[0].starts_with("IOSession|missing {} {} [format error"));
+            Assert::AreEqual(std::string("IOSession|next 2"), lines[1]);
+        }
+
+        // ring 이 가득 차면 Drop 정책은 버리고 세며, 버린 수를 경고로 남긴다.
+        TEST_METHOD(Push_RingFull_DropsAndReports)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(4), { pSink }, spdlog::level::info);
+
+            for (int i = 0; i < 10; ++i)
+            {
+                backend.Push("IOSession", spdlog::level::info, "n {}", i);
+            }
+
+            auto stats = backend.GetStats();
+            Assert::AreEqual<std::uint64_t>(4, stats.Enqueued);
+            Assert::AreEqual<std::uint64_t>(6, stats.Dropped);
+
+            backend.Start();
+            backend.Stop();
+
+            const auto lines = pSink->GetLines();
+            Assert::IsTrue(Contains(lines, "IOSession|n 3"));
+            Assert::IsFalse(Contains(lines, "IOSession|n 4"));
+            Assert::IsTrue(std::any_of(lines.begin(), lines.end(),
+                [](const std::string& rfLine) { return rfLine.starts_with("AsyncLog|6 log records dropped"); }));
+            Assert::AreEqual<std::uint64_t>(4, backend.GetStats().Written);
+        }
+
+        // 종료한 스레드의 ring 은 비운 뒤 등록 해제, 카운터는 유지.
+        TEST_METHOD(ThreadExit_RetiresRing)
+        {
+            auto pSink = std::make_shared<CollectingSink>();
+            LibCommons::AsyncLogBackend backend(MakeOptions(2048), { pSink }, spdlog::level::info);
+            backend.Start();
+
+            std::thread worker([&backend]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    backend.Push("Worker", spdlog::level::info, "w {}", i);
+                }
+            });
+            worker.join();
+            backend.Stop();
+
+            const auto stats = backend.GetStats();
+            Assert::AreEqual<std::uint64_t>(1000, stats.Enqueued);
+            Assert::AreEqual<std::uint64_t>(1000, stats.Written);
+            Assert::AreEqual<std::size_t>(0, stats.ThreadRings);
+            Assert::IsTrue(Contains(pSink->GetLines(), "Worker|w 999"));
+        }
+    };
+}
@@ -0,0 +1,92 @@
+﻿#include "CppUnitTest.h"
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <string>
+
+import commons.buffers.ibuffer;
+import commons.buffers.circle_buffer_queue;
+import commons.buffers.spsc_circle_buffer_queue;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    // 생산자 1 / 소비자 1 스레드가 동일 큐를 두고 경합하는 상황 (IOCP 수신 경로 모사).
+    // 생산자: Write(chunk) 반복, 소비자: GetReadBuffers + Consume 반복.
+    static double RunProducerConsumer(LibCommons::Buffers::IBuffer& rfQueue, size_t totalBytes, size_t chunkSize)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::thread producer([&rfQueue, totalBytes, chunkSize]() {
+            std::vector<std::byte> chunk(chunkSize, std::byte{ 0x5A });
+            size_t written = 0;
+            while (written < totalBytes)
+            {
+                // 실패 경로 로그(CircleBufferQueue)가 측정에 섞이지 않도록 공간을 먼저 확인.
+                if (rfQueue.CanWriteSize() < chunkSize)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                rfQueue.Write(chunk);
+                written += chunkSize;
+            }
+        });
+
+        std::thread consumer([&rfQueue, totalBytes]() {
+            std::vector<std::span<const std::byte>> spans;
+            size_t consumed = 0;
+            while (consumed < totalBytes)
+            {
+                if (rfQueue.CanReadSize() == 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                const size_t readable = rfQueue.GetReadBuffers(spans);
+                rfQueue.Consume(readable);
+                consumed += readable;
+            }
+        });
+
+        producer.join();
+        consumer.join();
+
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> elapsed = end - start;
+        return elapsed.count();
+    }
+
+    TEST_CLASS(BufferQueueBenchmarkTests)
+    {
+    public:
+        // 1. CircleBufferQueue (RWLock) 생산자/소비자 경합
+        TEST_METHOD(Benchmark_CircleBufferQueue_ProducerConsumer)
+        {
+            const size_t CAPACITY = 64 * 1024;
+            const size_t TOTAL = 256ull * 1024 * 1024;
+            const size_t CHUNK = 512;
+
+            LibCommons::Buffers::CircleBufferQueue queue(CAPACITY);
+            double elapsed = RunProducerConsumer(queue, TOTAL, CHUNK);
+
+            std::string msg = "CircleBufferQueue (SPSC load) Time: " + std::to_string(elapsed) + " ms";
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+
+        // 2. SPSCCircleBufferQueue (lock-free) 생산자/소비자 경합
+        TEST_METHOD(Benchmark_SPSCCircleBufferQueue_ProducerConsumer)
+        {
+            const size_t CAPACITY = 64 * 1024;
+            const size_t TOTAL = 256ull * 1024 * 1024;
+            const size_t CHUNK = 512;
+
+            LibCommons::Buffers::SPSCCircleBufferQueue queue(CAPACITY);
+            double elapsed = RunProducerConsumer(queue, TOTAL, CHUNK);
+
+            std::string msg = "SPSCCircleBufferQueue (SPSC load) Time: " + std::to_string(elapsed) + " ms";
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+    };
+}
@@ -0,0 +1,186 @@
+﻿#include "CppUnitTest.h"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+
+import commons.buffers.ibuffer;
+import commons.buffers.circle_buffer_queue;
+import commons.buffers.spsc_circle_buffer_queue;
+import commons.buffers.lazy_buffer;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        constexpr std::size_t kRingCapacity = 4096;
+
+        std::shared_ptr<LibCommons::Buffers::RingBufferPool> MakePool(std::size_t maxIdle = 4)
+        {
+            return std::make_shared<LibCommons::Buffers::RingBufferPool>(kRingCapacity,
+                [](std::size_t capacity) { return std::make_unique<LibCommons::Buffers::CircleBufferQueue>(capacity); },
+                maxIdle);
+        }
+    }
+
+    TEST_CLASS(LazyBufferTests)
+    {
+    public:
+        TEST_METHOD(NewBuffer_HoldsNoRing)
+        {
+            auto pPool = MakePool();
+            LibCommons::Buffers::LazyBuffer buffer(pPool);
+
+            Assert::IsFalse(buffer.IsAttached());
+            Assert::AreEqual<std::size_t>(0, buffer.CanReadSize());
+            Assert::AreEqual<std::size_t>(kRingCapacity, buffer.CanWriteSize());
+            Assert::AreEqual<std::size_t>(0, buffer.GetResidentBytes());
+            Assert::AreEqual<std::size_t>(0, pPool->GetBorrowedCount());
+
+            std::vector<std::span<const std::byte>> readBuffers;
+            Assert::AreEqual<std::size_t>(0, buffer.GetReadBuffers(readBuffers));
+            Assert::IsTrue(buffer.Consume(0));
+        }
+
+        TEST_METHOD(Write_AttachesRing_DrainReturnsIt)
+        {
+            auto pPool = MakePool();
+            LibCommons::Buffers::LazyBuffer buffer(pPool);
+
+            std::vector<std::byte> data(100, std::byte{ 0x5A });
+            Assert::IsTrue(buffer.Write(data));
+            Assert::IsTrue(buffer.IsAttached());
+            Assert::AreEqual<std::size_t>(kRingCapacity, buffer.GetResidentBytes());
+            Assert::AreEqual<std::size_t>(1, pPool->GetBorrowedCount());
+
+            // 일부만 소비하면 ring 유지.
+            std::vector<std::byte> out(40);
+            Assert::IsTrue(buffer.Pop(out));
+            Assert::IsTrue(buffer.IsAttached());
+            Assert::AreEqual<std::size_t>(60, buffer.CanReadSize());
+
+            // 비면 풀로 반환.
+            Assert::IsTrue(buffer.Consume(60));
+            Assert::IsFalse(buffer.IsAttached());
+            Assert::AreEqual<std::size_t>(0, buffer.GetResidentBytes());
+            Assert::AreEqual<std::size_t>(0, pPool->GetBorrowedCount());
+            Assert::AreEqual<std::size_t>(1, pPool->GetIdleCount());
+        }
+
+        // Recv 경로: GetWriteableBuffers 로 빌린 ring 은 CommitWrite 후 Consume 으로 비워질 때까지 유지.
+        TEST_METHOD(RecvPath_CommitThenConsume)
+        {
+            auto pPool = MakePool();
+            LibCommons::Buffers::LazyBuffer buffer(pPool);
+
+            std::vector<std::span<std::byte>> writeBuffers;
+            const std::size_t writable = buffer.GetWriteableBuffers(writeBuffers);
+            Assert::AreEqual<std::size_t>(kRingCapacity, writable);
+            Assert::IsTrue(buffer.IsAttached());
+
+            writeBuffers[0][0] = std::byte{ 0x11 };
+            writeBuffers[0][1] = std::byte{ 0x22 };
+            Assert::IsTrue(buffer.CommitWrite(2));
+
+            std::vector<std::span<const std::byte>> readBuffers;
+            Assert::AreEqual<std::size_t>(2, buffer.GetReadBuffers(readBuffers));
+            Assert::IsTrue(readBuffers[0][1] == std::byte{ 0x22 });
+
+            Assert::IsTrue(buffer.Consume(2));
+            Assert::IsFalse(buffer.IsAttached());
+        }
+
+        // 빈 수신 (CommitWrite(0)) 이면 빌린 ring 을 바로 돌려준다.
+        TEST_METHOD(CommitWriteZero_ReleasesRing)
+        {
+            auto pPool = MakePool();
+            LibCommons::Buffers::LazyBuffer buffer(pPool);
+
+            std::vector<std::span<std::byte>> writeBuffers;
+            buffer.GetWriteableBuffers(writeBuffers);
+            Assert::IsTrue(buffer.CommitWrite(0));
+            Assert::IsFalse(buffer.IsAttached());
+        }
+
+        TEST_METHOD(ReleasedRing_IsReusedAndCleared)
+        {
+            auto pPool = MakePool();
+            LibCommons::Buffers::LazyBuffer first(pPool);
+            LibCommons::Buffers::LazyBuffer second(pPool);
+
+            std::vector<std::byte> data(10, std::byte{ 0x01 });
+            Assert::IsTrue(first.Write(data));
+            first.Clear();
+            Assert::IsFalse(first.IsAttached());
+            Assert::AreEqual<std::size_t>(1, pPool->GetIdleCount());
+
+            Assert::IsTrue(second.Write(data));
+            Assert::AreEqual<std::size_t>(0, pPool->GetIdleCount(), L"보관된 ring 을 재사용해야 함");
+            Assert::AreEqual<std::size_t>(10, second.CanReadSize(), L"재사용 ring 은 비워진 상태여야 함");
+        }
+
+        TEST_METHOD(Pool_KeepsAtMostMaxIdle)
+        {
+            auto pPool = MakePool(1);
+            std::vector<std::unique_ptr<LibCommons::Buffers::LazyBuffer>> buffers;
+            std::vector<std::byte> data(8, std::byte{ 0x7F });
+            for (int i = 0; i < 3; ++i)
+            {
+                buffers.push_back(std::make_unique<LibCommons::Buffers::LazyBuffer>(pPool));
+                Assert::IsTrue(buffers.back()->Write(data));
+            }
+            Assert::AreEqual<std::size_t>(3, pPool->GetBorrowedCount());
+
+            buffers.clear();
+            Assert::AreEqual<std::size_t>(0, pPool->GetBorrowedCount());
+            Assert::AreEqual<std::size_t>(1, pPool->GetIdleCount());
+        }
+
+        // Serialized: SPSC ring 위에서 수신 경로 (빌림 → commit → consume → 반환) 를 락 없이 돌리는 동안
+        // 다른 스레드의 상주 바이트 조회는 ring 포인터만 읽는다.
+        TEST_METHOD(Serialized_RecvPathWithConcurrentResidentQuery)
+        {
+            auto pPool = std::make_shared<LibCommons::Buffers::RingBufferPool>(kRingCapacity,
+                [](std::size_t capacity) { return std::make_unique<LibCommons::Buffers::SPSCCircleBufferQueue>(capacity); },
+                4);
+            LibCommons::Buffers::LazyBuffer buffer(pPool, LibCommons::Buffers::ELazyRingAccess::Serialized);
+
+            std::atomic<bool> bDone{ false };
+            std::atomic<std::size_t> unexpected{ 0 };
+            std::thread stats([&]()
+                {
+                    while (!bDone.load())
+                    {
+                        const std::size_t resident = buffer.GetResidentBytes();
+                        if (resident != 0 && resident != kRingCapacity)
+                        {
+                            unexpected.fetch_add(1);
+                        }
+                    }
+                });
+
+            std::vector<std::span<std::byte>> writeBuffers;
+            std::vector<std::span<const std::byte>> readBuffers;
+            for (int i = 0; i < 20000; ++i)
+            {
+                const std::size_t bytes = 1 + i % 100;
+                Assert::IsTrue(buffer.GetWriteableBuffers(writeBuffers) >= bytes);
+                writeBuffers[0][0] = static_cast<std::byte>(i);
+                Assert::IsTrue(buffer.CommitWrite(bytes));
+
+                Assert::AreEqual(bytes, buffer.GetReadBuffers(readBuffers));
+                Assert::IsTrue(readBuffers[0][0] == static_cast<std::byte>(i));
+                Assert::IsTrue(buffer.Consume(bytes));
+                Assert::IsFalse(buffer.IsAttached());
+            }
+
+            bDone.store(true);
+            stats.join();
+
+            Assert::AreEqual<std::size_t>(0, unexpected.load());
+            Assert::AreEqual<std::size_t>(0, pPool->GetBorrowedCount());
+        }
+    };
+}
@@ -0,0 +1,67 @@
+﻿#include "CppUnitTest.h"
+#include <string>
+#include <spdlog/common.h>
+
+import commons.logger;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        constinit LibCommons::LogCategory<> s_Category{ "LogCategoryTests" };
+        constinit LibCommons::HotPathLogCategory s_HotPathCategory{ "LogCategoryTests" };
+        constinit LibCommons::LogCategory<spdlog::level::err> s_ErrorOnlyCategory{ "LogCategoryTests" };
+
+        int s_EvaluationCount = 0;
+
+        int CountEvaluation()
+        {
+            return ++s_EvaluationCount;
+        }
+    }
+
+    // 컴파일 타임 레벨: 카테고리 최소 레벨과 전역 최소 레벨 중 높은 쪽.
+    static_assert(LibCommons::LogCategory<spdlog::level::err>::IsCompiledIn<spdlog::level::err>());
+    static_assert(!LibCommons::LogCategory<spdlog::level::err>::IsCompiledIn<spdlog::level::warn>());
+    static_assert(LibCommons::HotPathLogCategory::kMinLevel >= LibCommons::kMinLogLevel);
+    static_assert(LibCommons::HotPathLogCategory::IsCompiledIn<spdlog::level::warn>());
+
+    TEST_CLASS(LogCategoryTests)
+    {
+    public:
+        TEST_METHOD(GetName_ReturnsLiteral)
+        {
+            Assert::AreEqual(std::string("LogCategoryTests"), std::string(s_Category.GetName()));
+            Assert::AreEqual(std::string("LogCategoryTests"), std::string(s_HotPathCategory.GetName()));
+        }
+
+        // 컴파일에서 빠진 레벨은 런타임 레벨과 무관하게 false.
+        TEST_METHOD(ShouldLog_BelowCategoryLevel_IsFalse)
+        {
+            auto& logger = LibCommons::Logger::GetInstance();
+
+            Assert::IsFalse(logger.ShouldLog<spdlog::level::info>(s_ErrorOnlyCategory));
+            Assert::IsFalse(logger.ShouldLog<spdlog::level::debug>(s_ErrorOnlyCategory));
+            Assert::AreEqual(logger.ShouldLog(spdlog::level::err), logger.ShouldLog<spdlog::level::err>(s_ErrorOnlyCategory));
+        }
+
+        // ShouldLog 로 감싼 인자는 걸러진 레벨에서 평가되지 않는다.
+        TEST_METHOD(GuardedArguments_NotEvaluatedWhenFiltered)
+        {
+            auto& logger = LibCommons::Logger::GetInstance();
+            s_EvaluationCount = 0;
+
+            if (logger.ShouldLog<spdlog::level::debug>(s_ErrorOnlyCategory))
+            {
+                logger.LogDebug(s_ErrorOnlyCategory, "value : {}", CountEvaluation());
+            }
+            Assert::AreEqual(0, s_EvaluationCount);
+
+            // 걸러진 레벨 호출은 아무것도 기록하지 않고 반환 (이름 조회 / 포맷 없음).
+            logger.LogInfo(s_ErrorOnlyCategory, "value : {}", 1);
+            logger.LogError(s_ErrorOnlyCategory, "value : {}", 2);
+        }
+    };
+}
@@ -0,0 +1,103 @@
+﻿#include "CppUnitTest.h"
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+
+import commons.log_rate_limit;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        // 호출 위치는 전역 목록에 등록되므로 테스트마다 별도 인스턴스.
+        constinit LibCommons::LogRateLimit s_BurstLimit{ "LogRateLimitTests.Burst", 3, 2 };
+        constinit LibCommons::LogRateLimit s_SummaryLimit{ "LogRateLimitTests.Summary", 1, 1 };
+        constinit LibCommons::LogRateLimit s_IdleLimit{ "LogRateLimitTests.Idle", 2, 1000 };
+        constinit LibCommons::LogSampler s_Sampler{ "LogRateLimitTests.Sampler", 4 };
+        constinit LibCommons::LogSampler s_SnapshotSampler{ "LogRateLimitTests.Snapshot", 2 };
+
+        const auto kStart = std::chrono::steady_clock::time_point(std::chrono::seconds(100));
+    }
+
+    TEST_CLASS(LogRateLimitTests)
+    {
+    public:
+        // burst 만큼 허용 후 억제, 초당 rate 만큼 회복.
+        TEST_METHOD(RateLimit_AdmitsBurstThenRefills)
+        {
+            int admitted = 0;
+            for (int i = 0; i < 10; ++i)
+            {
+                admitted += s_BurstLimit.Admit(kStart).bAdmitted ? 1 : 0;
+            }
+            Assert::AreEqual(3, admitted);
+
+            // 2/s — 토큰 1 개는 500ms 뒤.
+            Assert::IsFalse(s_BurstLimit.Admit(kStart + std::chrono::milliseconds(499)).bAdmitted);
+            Assert::IsTrue(s_BurstLimit.Admit(kStart + std::chrono::milliseconds(500)).bAdmitted);
+            Assert::IsFalse(s_BurstLimit.Admit(kStart + std::chrono::milliseconds(500)).bAdmitted);
+
+            const auto stats = s_BurstLimit.GetStats();
+            Assert::AreEqual<std::uint64_t>(4, stats.Admitted);
+            Assert::AreEqual<std::uint64_t>(9, stats.Suppressed);
+        }
+
+        // 다음 허용 호출이 직전 허용 이후 억제된 수를 받는다 (요약 줄 용).
+        TEST_METHOD(RateLimit_ReportsSuppressedSinceLastAdmit)
+        {
+            Assert::AreEqual<std::uint64_t>(0, s_SummaryLimit.Admit(kStart).SuppressedSinceLast);
+            for (int i = 0; i < 5; ++i)
+            {
+                Assert::IsFalse(s_SummaryLimit.Admit(kStart).bAdmitted);
+            }
+
+            const auto admission = s_SummaryLimit.Admit(kStart + std::chrono::seconds(1));
+            Assert::IsTrue(admission.bAdmitted);
+            Assert::AreEqual<std::uint64_t>(5, admission.SuppressedSinceLast);
+            Assert::AreEqual<std::uint64_t>(0, s_SummaryLimit.Admit(kStart + std::chrono::seconds(2)).SuppressedSinceLast);
+        }
+
+        // 오래 쉬어도 burst 이상 쌓이지 않는다.
+        TEST_METHOD(RateLimit_IdleRefillCappedAtBurst)
+        {
+            s_IdleLimit.Admit(kStart);
+
+            int admitted = 0;
+            for (int i = 0; i < 10; ++i)
+            {
+                admitted += s_IdleLimit.Admit(kStart + std::chrono::hours(1)).bAdmitted ? 1 : 0;
+            }
+            Assert::AreEqual(2, admitted);
+        }
+
+        // 첫 호출과 이후 N 번째마다 허용, 요약 수는 보고하지 않는다.
+        TEST_METHOD(Sampler_AdmitsOneInN)
+        {
+            int admitted = 0;
+            for (int i = 0; i < 12; ++i)
+            {
+                const auto admission = s_Sampler.Admit();
+                admitted += admission.bAdmitted ? 1 : 0;
+                Assert::AreEqual<std::uint64_t>(0, admission.SuppressedSinceLast);
+            }
+            Assert::AreEqual(3, admitted);
+            Assert::AreEqual<std::uint64_t>(9, s_Sampler.GetStats().Suppressed);
+        }
+
+        // 한 번이라도 Admit 된 호출 위치는 스냅샷에 나온다.
+        TEST_METHOD(Snapshot_ContainsAdmittedSites)
+        {
+            s_SnapshotSampler.Admit();
+
+            const auto sites = LibCommons::SnapshotLogSites();
+            const auto it = std::find_if(sites.begin(), sites.end(),
+                [](const LibCommons::LogSiteStats& rfStats) { return rfStats.Name == std::string_view("LogRateLimitTests.Snapshot"); });
+
+            Assert::IsTrue(it != sites.end());
+            Assert::IsTrue(LibCommons::ELogSiteKind::Sample == it->Kind);
+            Assert::AreEqual(s_SnapshotSampler.GetStats().Admitted, it->Admitted);
+        }
+    };
+}
@@ -0,0 +1,128 @@
+﻿#include "CppUnitTest.h"
+#include <string>
+
+import commons.buffers.mirrored_circle_buffer_queue;
+import std;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibCommons::Buffers;
+
+namespace LibCommonsTests
+{
+	TEST_CLASS(MirroredCircleBufferQueueTests)
+	{
+	public:
+
+		// • 요청 용량은 매핑 단위로 올림되고 초기 상태는 비어 있어야 함
+		TEST_METHOD(CapacityRoundUp)
+		{
+			MirroredCircleBufferQueue queue(10);
+
+			Assert::IsTrue(queue.IsValid());
+			Assert::IsTrue(queue.GetCapacity() >= 10);
+			Assert::AreEqual(queue.GetCapacity(), queue.CanWriteSize());
+			Assert::AreEqual((size_t)0, queue.CanReadSize());
+		}
+
+		// • 기본 Write / Peek / Pop / Consume / Clear 동작 확인
+		TEST_METHOD(BasicOperations)
+		{
+			MirroredCircleBufferQueue queue(10);
+			const size_t capacity = queue.GetCapacity();
+
+			char data[] = "12345";
+			Assert::IsTrue(queue.Write(std::as_bytes(std::span(data, 5))));
+			Assert::AreEqual((size_t)5, queue.CanReadSize());
+
+			char buffer[8] = { 0, };
+			Assert::IsTrue(queue.Peek(std::as_writable_bytes(std::span(buffer, 5))));
+			Assert::AreEqual(std::string("12345"), std::string(buffer, 5));
+
+			Assert::IsTrue(queue.Pop(std::as_writable_bytes(std::span(buffer, 3))));
+			Assert::AreEqual(std::string("123"), std::string(buffer, 3));
+
+			Assert::IsTrue(queue.Consume(2));
+			Assert::AreEqual((size_t)0, queue.CanReadSize());
+
+			Assert::IsFalse(queue.Consume(1));
+			Assert::IsFalse(queue.Pop(std::as_writable_bytes(std::span(buffer, 1))));
+
+			Assert::IsTrue(queue.Write(std::as_bytes(std::span(data, 5))));
+			queue.Clear();
+			Assert::AreEqual((size_t)0, queue.CanReadSize());
+			Assert::AreEqual(capacity, queue.CanWriteSize());
+		}
+
+		// • 버퍼 끝을 가로지르는 데이터도 GetReadBuffers 가 1개의 연속 span 으로 반환해야 함
+		TEST_METHOD(WrapAroundReadIsSingleSpan)
+		{
+			MirroredCircleBufferQueue queue(10);
+			const size_t capacity = queue.GetCapacity();
+
+			// Head/Tail 을 끝에서 3바이트 앞으로 이동
+			std::vector<std::byte> padding(capacity - 3, std::byte{ 0 });
+			Assert::IsTrue(queue.Write(padding));
+			Assert::IsTrue(queue.Consume(padding.size()));
+
+			char data[] = "ABCDEFGH";
+			Assert::IsTrue(queue.Write(std::as_bytes(std::span(data, 8))));
+
+			std::vector<std::span<const std::byte>> readBuffers;
+			Assert::AreEqual((size_t)8, queue.GetReadBuffers(readBuffers));
+			Assert::AreEqual((size_t)1, readBuffers.size());
+			Assert::AreEqual(std::string("ABCDEFGH"),
+				std::string(reinterpret_cast<const char*>(readBuffers[0].data()), readBuffers[0].size()));
+
+			char popBuffer[9] = { 0 };
+			Assert::IsTrue(queue.Pop(std::as_writable_bytes(std::span(popBuffer, 8))));
+			Assert::AreEqual(std::string("ABCDEFGH"), std::string(popBuffer));
+		}
+
+		// • AllocateWrite / GetWriteableBuffers 도 Wrap 지점에서 1개의 span 만 반환해야 함
+		TEST_METHOD(WrapAroundWriteIsSingleSpan)
+		{
+			MirroredCircleBufferQueue queue(10);
+			const size_t capacity = queue.GetCapacity();
+
+			std::vector<std::byte> padding(capacity - 2, std::byte{ 0 });
+			Assert::IsTrue(queue.Write(padding));
+			Assert::IsTrue(queue.Consume(padding.size()));
+
+			std::vector<std::span<std::byte>> writeBuffers;
+			Assert::AreEqual(capacity, queue.GetWriteableBuffers(writeBuffers));
+			Assert::AreEqual((size_t)1, writeBuffers.size());
+			Assert::AreEqual(capacity, writeBuffers[0].size());
+
+			Assert::IsTrue(queue.AllocateWrite(6, writeBuffers));
+			Assert::AreEqual((size_t)1, writeBuffers.size());
+			std::memcpy(writeBuffers[0].data(), "WXYZ12", 6);
+
+			char buffer[7] = { 0 };
+			Assert::IsTrue(queue.Peek(std::as_writable_bytes(std::span(buffer, 6))));
+			Assert::AreEqual(std::string("WXYZ12"), std::string(buffer));
+		}
+
+		// • 가득 찬 상태에서 추가 쓰기 실패, CommitWrite 초과 실패
+		TEST_METHOD(OverflowTests)
+		{
+			MirroredCircleBufferQueue queue(10);
+			const size_t capacity = queue.GetCapacity();
+
+			std::vector<std::byte> full(capacity, std::byte{ 0x11 });
+			Assert::IsTrue(queue.Write(full));
+			Assert::AreEqual((size_t)0, queue.CanWriteSize());
+
+			char extra = 'X';
+			Assert::IsFalse(queue.Write(std::as_bytes(std::span(&extra, 1))));
+
+			std::vector<std::span<std::byte>> writeBuffers;
+			Assert::IsFalse(queue.AllocateWrite(1, writeBuffers));
+			Assert::AreEqual((size_t)0, queue.GetWriteableBuffers(writeBuffers));
+			Assert::IsFalse(queue.CommitWrite(1));
+
+			Assert::IsTrue(queue.Consume(1));
+			Assert::IsTrue(queue.CommitWrite(1));
+			Assert::AreEqual(capacity, queue.CanReadSize());
+		}
+	};
+}
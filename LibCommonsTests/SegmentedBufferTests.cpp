@@ -0,0 +1,135 @@
+﻿#include "CppUnitTest.h"
+#include <vector>
+#include <cstdint>
+
+import commons.buffers.segmented_buffer;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        constexpr std::size_t kChunkSize = 1024;
+        constexpr std::size_t kMaxCapacity = 8 * kChunkSize;
+
+        std::vector<std::byte> MakeSequence(std::size_t size, std::uint8_t seed = 0)
+        {
+            std::vector<std::byte> data(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<std::byte>(static_cast<std::uint8_t>(seed + i));
+            }
+            return data;
+        }
+    }
+
+    TEST_CLASS(SegmentedBufferTests)
+    {
+    public:
+        TEST_METHOD(Write_BeyondOneChunk_GrowsAndRoundTrips)
+        {
+            LibCommons::Buffers::SegmentedBuffer buffer(kChunkSize, kMaxCapacity);
+            Assert::AreEqual<std::size_t>(0, buffer.GetResidentBytes());
+
+            auto data = MakeSequence(3 * kChunkSize + 100);
+            Assert::IsTrue(buffer.Write(data));
+            Assert::AreEqual<std::size_t>(4, buffer.GetChunkCount());
+            Assert::AreEqual<std::size_t>(data.size(), buffer.CanReadSize());
+
+            std::vector<std::byte> out(data.size());
+            Assert::IsTrue(buffer.Pop(out));
+            Assert::IsTrue(data == out);
+        }
+
+        TEST_METHOD(Write_AboveCeiling_Fails)
+        {
+            LibCommons::Buffers::SegmentedBuffer buffer(kChunkSize, kMaxCapacity);
+
+            Assert::IsTrue(buffer.Write(MakeSequence(kMaxCapacity)));
+            Assert::AreEqual<std::size_t>(0, buffer.CanWriteSize());
+            Assert::IsFalse(buffer.Write(MakeSequence(1)));
+
+            std::vector<std::span<std::byte>> spans;
+            Assert::IsFalse(buffer.AllocateWrite(1, spans));
+        }
+
+        // gather 송신: chunk 마다 span 1개, 합이 CanReadSize.
+        TEST_METHOD(GetReadBuffers_OneSpanPerChunk)
+        {
+            LibCommons::Buffers::SegmentedBuffer buffer(kChunkSize, kMaxCapacity);
+            auto data = MakeSequence(2 * kChunkSize + 10, 7);
+            Assert::IsTrue(buffer.Write(data));
+
+            std::vector<std::span<const std::byte>> spans;
+            Assert::AreEqual<std::size_t>(data.size(), buffer.GetReadBuffers(spans));
+            Assert::AreEqual<std::size_t>(3, spans.size());
+
+            std::size_t offset = 0;
+            for (const auto& span : spans)
+            {
+                for (const auto b : span)
+                {
+                    Assert::IsTrue(b == data[offset++]);
+                }
+            }
+            Assert::AreEqual<std::size_t>(data.size(), offset);
+        }
+
+        // chunk 크기 이하 예약은 tail 이 모자라도 단일 span (새 chunk 로 넘어감).
+        TEST_METHOD(AllocateWrite_FitsChunk_SingleSpan)
+        {
+            LibCommons::Buffers::SegmentedBuffer buffer(kChunkSize, kMaxCapacity);
+            Assert::IsTrue(buffer.Write(MakeSequence(kChunkSize - 10)));
+
+            std::vector<std::span<std::byte>> spans;
+            Assert::IsTrue(buffer.AllocateWrite(100, spans));
+            Assert::AreEqual<std::size_t>(1, spans.size());
+            Assert::AreEqual<std::size_t>(100, spans[0].size());
+            Assert::AreEqual<std::size_t>(kChunkSize - 10 + 100, buffer.CanReadSize());
+
+            // chunk 보다 큰 예약은 여러 span.
+            Assert::IsTrue(buffer.AllocateWrite(kChunkSize + 1, spans));
+            Assert::IsTrue(spans.size() >= 2);
+        }
+
+        // 소비된 chunk 는 즉시 반환, 비면 전부 반환.
+        TEST_METHOD(Consume_ShrinksToZero)
+        {
+            LibCommons::Buffers::SegmentedBuffer buffer(kChunkSize, kMaxCapacity);
+            Assert::IsTrue(buffer.Write(MakeSequence(4 * kChunkSize)));
+            Assert::AreEqual<std::size_t>(4 * kChunkSize, buffer.GetResidentBytes());
+
+            Assert::IsTrue(buffer.Consume(2 * kChunkSize + 1));
+            Assert::AreEqual<std::size_t>(2, buffer.GetChunkCount());
+
+            Assert::IsTrue(buffer.Consume(buffer.CanReadSize()));
+            Assert::AreEqual<std::size_t>(0, buffer.GetChunkCount());
+            Assert::AreEqual<std::size_t>(0, buffer.GetResidentBytes());
+        }
+
+        // Recv 경로: GetWriteableBuffers → CommitWrite → Peek/Consume.
+        TEST_METHOD(WriteableBuffers_CommitWrite_RoundTrip)
+        {
+            LibCommons::Buffers::SegmentedBuffer buffer(kChunkSize, kMaxCapacity);
+
+            std::vector<std::span<std::byte>> spans;
+            Assert::AreEqual<std::size_t>(kChunkSize, buffer.GetWriteableBuffers(spans));
+            Assert::AreEqual<std::size_t>(1, spans.size());
+
+            auto data = MakeSequence(300, 3);
+            std::copy(data.begin(), data.end(), spans[0].begin());
+            Assert::IsTrue(buffer.CommitWrite(data.size()));
+
+            std::vector<std::byte> out(data.size());
+            Assert::IsTrue(buffer.Peek(out));
+            Assert::IsTrue(data == out);
+            Assert::IsTrue(buffer.Consume(data.size()));
+
+            // 빈 수신은 chunk 를 남기지 않는다.
+            buffer.GetWriteableBuffers(spans);
+            Assert::IsTrue(buffer.CommitWrite(0));
+            Assert::AreEqual<std::size_t>(0, buffer.GetChunkCount());
+        }
+    };
+}
@@ -0,0 +1,115 @@
+﻿#include "CppUnitTest.h"
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <format>
+
+import commons.buffers.slab_pool;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        constexpr int kThreadCount = 16;
+        constexpr int kIterationsPerThread = 200000;
+
+        // 패킷 / 대기 송신 버퍼 크기대 (256B ~ 3.8KB) 를 순환.
+        constexpr std::size_t SizeAt(int i)
+        {
+            return 256 + static_cast<std::size_t>(i % 8) * 512;
+        }
+
+        template<typename TVector>
+        double RunAllocationChurn()
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < kThreadCount; ++t)
+            {
+                threads.emplace_back([]() {
+                    for (int i = 0; i < kIterationsPerThread; ++i)
+                    {
+                        TVector buffer(SizeAt(i));
+                        buffer[0] = std::byte{ 1 };
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+            return elapsed.count();
+        }
+
+        // 8 스레드가 256 개씩 할당하고 매번 다른 스레드에서 해제 — IOCP 워커 간 버퍼 이동 (remote free 경로).
+        template<typename TVector>
+        double RunCrossThreadHandoff()
+        {
+            constexpr int kPairs = kThreadCount / 2;
+            constexpr int kBatch = 256;
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            std::vector<std::thread> threads;
+            for (int pair = 0; pair < kPairs; ++pair)
+            {
+                threads.emplace_back([]() {
+                    for (int i = 0; i < kIterationsPerThread; i += kBatch)
+                    {
+                        std::vector<TVector> batch;
+                        batch.reserve(kBatch);
+                        for (int j = 0; j < kBatch; ++j)
+                        {
+                            batch.emplace_back(SizeAt(i + j));
+                        }
+                        // 다른 스레드에서 소멸.
+                        std::thread([moved = std::move(batch)]() mutable { moved.clear(); }).join();
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+            return elapsed.count();
+        }
+    }
+
+    TEST_CLASS(SlabPoolBenchmarkTests)
+    {
+    public:
+        TEST_METHOD(Benchmark_16Threads_VectorVsSlab)
+        {
+            const double vectorMs = RunAllocationChurn<std::vector<std::byte>>();
+            const double slabMs = RunAllocationChurn<LibCommons::Buffers::SlabVector<std::byte>>();
+
+            std::string msg = std::format("16 threads x {} alloc/free — std::vector: {:.1f} ms, SlabVector: {:.1f} ms (x{:.2f})",
+                kIterationsPerThread, vectorMs, slabMs, slabMs > 0 ? vectorMs / slabMs : 0.0);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+
+        TEST_METHOD(Benchmark_16Threads_CrossThreadFree)
+        {
+            const auto before = LibCommons::Buffers::SlabPool::GetStats();
+
+            const double vectorMs = RunCrossThreadHandoff<std::vector<std::byte>>();
+            const double slabMs = RunCrossThreadHandoff<LibCommons::Buffers::SlabVector<std::byte>>();
+
+            const auto after = LibCommons::Buffers::SlabPool::GetStats();
+
+            std::string msg = std::format("16 threads cross-thread free — std::vector: {:.1f} ms, SlabVector: {:.1f} ms, RemoteFrees: {}, Hits: {}, Misses: {}",
+                vectorMs, slabMs, after.RemoteFrees - before.RemoteFrees, after.Hits - before.Hits, after.Misses - before.Misses);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+
+            Assert::IsTrue(after.RemoteFrees > before.RemoteFrees, L"다른 스레드 해제가 remote free 로 집계되어야 함");
+        }
+    };
+}
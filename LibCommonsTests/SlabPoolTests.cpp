@@ -0,0 +1,146 @@
+﻿#include "CppUnitTest.h"
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+
+import commons.buffers.slab_pool;
+import commons.buffers.circle_buffer_queue;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    // SlabPool 은 프로세스 전역 — 통계는 테스트 전후 차이로 검증한다.
+    TEST_CLASS(SlabPoolTests)
+    {
+    public:
+        TEST_METHOD(AllocateDeallocate_SameThread_ReusesBlock)
+        {
+            using LibCommons::Buffers::SlabPool;
+
+            void* pFirst = SlabPool::Allocate(200);
+            SlabPool::Deallocate(pFirst);
+
+            const auto before = SlabPool::GetStats();
+            void* pSecond = SlabPool::Allocate(200);
+            const auto after = SlabPool::GetStats();
+
+            Assert::IsTrue(pFirst == pSecond, L"같은 스레드에서 방금 반환한 블록을 다시 받아야 함");
+            Assert::AreEqual<std::uint64_t>(before.Hits + 1, after.Hits);
+            Assert::AreEqual<std::uint64_t>(before.Misses, after.Misses);
+
+            SlabPool::Deallocate(pSecond);
+        }
+
+        TEST_METHOD(Allocate_ReturnsAlignedWritableBlocks)
+        {
+            using LibCommons::Buffers::SlabPool;
+
+            for (const std::size_t size : { std::size_t{ 1 }, std::size_t{ 64 }, std::size_t{ 65 }, std::size_t{ 4096 }, SlabPool::kMaxSlabSize })
+            {
+                void* p = SlabPool::Allocate(size);
+                Assert::IsNotNull(p);
+                Assert::AreEqual<std::size_t>(0, reinterpret_cast<std::uintptr_t>(p) % SlabPool::kAlignment);
+                std::memset(p, 0xAB, size);
+                SlabPool::Deallocate(p);
+            }
+        }
+
+        TEST_METHOD(Allocate_AboveMaxSlabSize_GoesDirect)
+        {
+            using LibCommons::Buffers::SlabPool;
+
+            const auto before = SlabPool::GetStats();
+            void* p = SlabPool::Allocate(SlabPool::kMaxSlabSize + 1);
+            std::memset(p, 0, SlabPool::kMaxSlabSize + 1);
+            SlabPool::Deallocate(p);
+            const auto after = SlabPool::GetStats();
+
+            Assert::AreEqual<std::uint64_t>(before.DirectAllocs + 1, after.DirectAllocs);
+        }
+
+        // 다른 스레드가 반환한 블록은 remote free 로 집계되고, 할당한 스레드가 다시 회수해 쓴다.
+        TEST_METHOD(Deallocate_OtherThread_ReturnsToOwner)
+        {
+            using LibCommons::Buffers::SlabPool;
+
+            const int count = 32;
+            std::vector<void*> blocks;
+            for (int i = 0; i < count; ++i)
+            {
+                blocks.push_back(SlabPool::Allocate(1000));
+            }
+
+            const auto before = SlabPool::GetStats();
+            std::thread([&blocks]() {
+                for (void* p : blocks)
+                {
+                    SlabPool::Deallocate(p);
+                }
+            }).join();
+            const auto after = SlabPool::GetStats();
+
+            Assert::AreEqual<std::uint64_t>(before.RemoteFrees + count, after.RemoteFrees);
+
+            // 회수 경로 — 새 slab 없이 공급되어야 한다.
+            std::vector<void*> again;
+            for (int i = 0; i < count; ++i)
+            {
+                again.push_back(SlabPool::Allocate(1000));
+            }
+            const auto reused = SlabPool::GetStats();
+            Assert::AreEqual<std::uint64_t>(after.Misses, reused.Misses, L"remote free 된 블록을 재사용해야 함");
+
+            for (void* p : again)
+            {
+                SlabPool::Deallocate(p);
+            }
+        }
+
+        // depot 이 high-water 를 넘으면 블록이 모두 돌아온 slab 은 통째로 해제되고 상주 바이트가 줄어든다.
+        TEST_METHOD(Deallocate_BeyondDepotHighWater_ReleasesWholeSlabs)
+        {
+            using LibCommons::Buffers::SlabPool;
+
+            // 16KB class 로 16MB — depot high-water (약 4MB) 의 4배.
+            constexpr std::size_t kBlockSize = 16 * 1024;
+            constexpr int kCount = 1024;
+
+            std::vector<void*> blocks;
+            for (int i = 0; i < kCount; ++i)
+            {
+                blocks.push_back(SlabPool::Allocate(kBlockSize));
+            }
+            const auto peak = SlabPool::GetStats();
+            Assert::IsTrue(peak.ResidentBytes >= kBlockSize * kCount);
+
+            for (void* p : blocks)
+            {
+                SlabPool::Deallocate(p);
+            }
+            const auto after = SlabPool::GetStats();
+
+            Assert::IsTrue(after.ReleasedSlabs > peak.ReleasedSlabs, L"high-water 초과분의 빈 slab 은 해제되어야 함");
+            Assert::IsTrue(after.ResidentBytes < peak.ResidentBytes - kBlockSize * kCount / 2, L"상주 바이트가 high-water 근처까지 줄어야 함");
+            Assert::AreEqual<std::size_t>(peak.ReservedBytes, after.ReservedBytes, L"누적 확보 바이트는 줄지 않음");
+
+            // 해제 후에도 같은 class 할당은 정상.
+            void* p = SlabPool::Allocate(kBlockSize);
+            std::memset(p, 0x5A, kBlockSize);
+            SlabPool::Deallocate(p);
+        }
+
+        TEST_METHOD(SlabVector_BacksCircleBufferQueue)
+        {
+            LibCommons::Buffers::CircleBufferQueue queue(64 * 1024);
+
+            std::vector<std::byte> data(1024, std::byte{ 0x3C });
+            Assert::IsTrue(queue.Write(data));
+
+            std::vector<std::byte> out(1024);
+            Assert::IsTrue(queue.Pop(out));
+            Assert::IsTrue(data == out);
+        }
+    };
+}
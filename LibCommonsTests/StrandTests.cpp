@@ -0,0 +1,262 @@
+﻿#include "CppUnitTest.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+import commons.thread_pool;
+import commons.strand;
+import commons.event_listener;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        // 조건이 만족될 때까지 대기 (최대 5초).
+        template<typename TPredicate>
+        bool WaitUntil(TPredicate predicate)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!predicate())
+            {
+                if (std::chrono::steady_clock::now() > deadline)
+                {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            return true;
+        }
+    }
+
+    TEST_CLASS(StrandTests)
+    {
+    public:
+        // 여러 스레드가 동시에 Post 해도 한 번에 하나씩, 보낸 스레드별 순서대로 실행된다.
+        TEST_METHOD(Post_ManyProducers_RunsSeriallyInProducerOrder)
+        {
+            constexpr int kProducers = 4;
+            constexpr int kTasksPerProducer = 20000;
+
+            auto pPool = LibCommons::ThreadPool::Create(4);
+            auto pStrand = LibCommons::Strand::Create(pPool);
+
+            // strand 안에서만 건드리는 상태 — 동시에 실행되면 깨진다.
+            std::array<int, kProducers> lastSequence{};
+            lastSequence.fill(-1);
+            int total = 0;
+            std::atomic<int> inFlight{ 0 };
+            std::atomic<bool> bViolation{ false };
+
+            std::vector<std::thread> producers;
+            for (int p = 0; p < kProducers; ++p)
+            {
+                producers.emplace_back([&, p]()
+                    {
+                        for (int i = 0; i < kTasksPerProducer; ++i)
+                        {
+                            pStrand->Post([&, p, i]()
+                                {
+                                    if (inFlight.fetch_add(1) != 0 || lastSequence[p] + 1 != i)
+                                    {
+                                        bViolation.store(true);
+                                    }
+                                    lastSequence[p] = i;
+                                    ++total;
+                                    inFlight.fetch_sub(1);
+                                });
+                        }
+                    });
+            }
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+
+            const std::uint64_t expected = kProducers * kTasksPerProducer;
+            Assert::IsTrue(WaitUntil([&]() { return pStrand->GetExecutedCount() == expected; }));
+            Assert::IsFalse(bViolation.load(), L"동시 실행 또는 순서 역전");
+            Assert::AreEqual(kProducers * kTasksPerProducer, total);
+        }
+
+        // batch 보다 긴 burst 를 여러 생산자가 동시에 넣어도 drain 은 하나뿐이다
+        // (batch 경계에서 카운터가 어긋나면 두 번째 drain 이 생겨 작업이 겹친다).
+        TEST_METHOD(Post_BurstsLongerThanBatch_NeverOverlap)
+        {
+            constexpr int kProducers = 8;
+            constexpr int kBursts = 200;
+            constexpr int kBurstSize = static_cast<int>(LibCommons::Strand::kMaxBatch) * 2 + 7;
+
+            auto pPool = LibCommons::ThreadPool::Create(4);
+            auto pStrand = LibCommons::Strand::Create(pPool);
+
+            std::atomic<int> inFlight{ 0 };
+            std::atomic<int> overlaps{ 0 };
+            std::atomic<bool> bStart{ false };
+
+            std::vector<std::thread> producers;
+            for (int p = 0; p < kProducers; ++p)
+            {
+                producers.emplace_back([&]()
+                    {
+                        WaitUntil([&]() { return bStart.load(); });
+                        for (int burst = 0; burst < kBursts; ++burst)
+                        {
+                            for (int i = 0; i < kBurstSize; ++i)
+                            {
+                                pStrand->Post([&]()
+                                    {
+                                        if (inFlight.fetch_add(1, std::memory_order_acq_rel) != 0)
+                                        {
+                                            overlaps.fetch_add(1, std::memory_order_relaxed);
+                                        }
+                                        std::this_thread::yield();
+                                        inFlight.fetch_sub(1, std::memory_order_acq_rel);
+                                    });
+                            }
+                            // drain 이 비워 유휴로 내려가는 구간을 만들어 0 → 1 전이를 자주 일으킨다.
+                            std::this_thread::yield();
+                        }
+                    });
+            }
+            bStart.store(true);
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+
+            const std::uint64_t expected = static_cast<std::uint64_t>(kProducers) * kBursts * kBurstSize;
+            Assert::IsTrue(WaitUntil([&]() { return pStrand->GetExecutedCount() == expected; }));
+            Assert::AreEqual(0, overlaps.load(), L"같은 strand 의 작업이 동시에 실행됨");
+        }
+
+        // 서로 다른 strand 는 동시에 실행될 수 있다.
+        TEST_METHOD(DifferentStrands_RunInParallel)
+        {
+            auto pPool = LibCommons::ThreadPool::Create(2);
+            auto pFirst = LibCommons::Strand::Create(pPool);
+            auto pSecond = LibCommons::Strand::Create(pPool);
+
+            std::atomic<int> started{ 0 };
+            std::atomic<int> bothSeen{ 0 };
+            auto rendezvous = [&]()
+                {
+                    started.fetch_add(1);
+                    if (WaitUntil([&]() { return started.load() == 2; }))
+                    {
+                        bothSeen.fetch_add(1);
+                    }
+                };
+
+            pFirst->Post(rendezvous);
+            pSecond->Post(rendezvous);
+
+            Assert::IsTrue(WaitUntil([&]() { return pFirst->GetExecutedCount() + pSecond->GetExecutedCount() == 2; }));
+            Assert::AreEqual(2, bothSeen.load(), L"두 strand 의 작업이 동시에 실행 중이어야 함");
+        }
+
+        // batch 를 넘는 작업은 나눠서 다시 스케줄되고, 그 사이 다른 strand 도 실행된다.
+        TEST_METHOD(Drain_LongerThanBatch_YieldsToOtherStrands)
+        {
+            constexpr int kTasks = static_cast<int>(LibCommons::Strand::kMaxBatch) * 20;
+
+            auto pPool = LibCommons::ThreadPool::Create(1);
+            auto pBusy = LibCommons::Strand::Create(pPool);
+            auto pOther = LibCommons::Strand::Create(pPool);
+
+            std::atomic<int> busyRun{ 0 };
+            std::atomic<int> busyRunWhenOtherRan{ -1 };
+
+            // 워커 1개를 막아 두고 양쪽을 채운 뒤 푼다.
+            std::atomic<bool> bRelease{ false };
+            pPool->Enqueue([&]() { WaitUntil([&]() { return bRelease.load(); }); });
+
+            for (int i = 0; i < kTasks; ++i)
+            {
+                pBusy->Post([&]() { busyRun.fetch_add(1); });
+            }
+            pOther->Post([&]() { busyRunWhenOtherRan.store(busyRun.load()); });
+            bRelease.store(true);
+
+            Assert::IsTrue(WaitUntil([&]() { return pBusy->GetExecutedCount() == kTasks && pOther->GetExecutedCount() == 1; }));
+            Assert::IsTrue(busyRunWhenOtherRan.load() < kTasks, L"다른 strand 가 긴 strand 가 끝날 때까지 밀리면 안 됨");
+        }
+
+        TEST_METHOD(IsRunningInThisThread_OnlyInsideTask)
+        {
+            auto pPool = LibCommons::ThreadPool::Create(1);
+            auto pStrand = LibCommons::Strand::Create(pPool);
+            auto pOther = LibCommons::Strand::Create(pPool);
+
+            std::atomic<int> result{ -1 };
+            pStrand->Post([&]()
+                {
+                    result.store((pStrand->IsRunningInThisThread() ? 1 : 0) + (pOther->IsRunningInThisThread() ? 2 : 0));
+                });
+
+            Assert::IsTrue(WaitUntil([&]() { return result.load() >= 0; }));
+            Assert::AreEqual(1, result.load());
+            Assert::IsFalse(pStrand->IsRunningInThisThread());
+        }
+
+        // 풀이 멈춘 뒤의 Post 는 호출 스레드에서 바로 실행된다 (대기 작업이 남지 않는다).
+        TEST_METHOD(Post_AfterPoolStop_RunsOnCaller)
+        {
+            auto pPool = LibCommons::ThreadPool::Create(1);
+            auto pStrand = LibCommons::Strand::Create(pPool);
+            pPool->Stop();
+
+            std::thread::id ranOn;
+            pStrand->Post([&]() { ranOn = std::this_thread::get_id(); });
+
+            Assert::IsTrue(std::this_thread::get_id() == ranOn);
+            Assert::AreEqual<std::uint64_t>(1, pStrand->GetExecutedCount());
+        }
+
+        // EventListener::Stop 이 풀을 놓아도 strand 가 잡고 있어 해제되지 않는다 — 이후 Post 는 호출 스레드에서 실행.
+        TEST_METHOD(Post_AfterEventListenerStop_RunsOnCaller)
+        {
+            auto& rfListener = LibCommons::EventListener::GetInstance();
+            rfListener.Init(1);
+            auto pStrand = rfListener.CreateStrand();
+            Assert::IsTrue(pStrand != nullptr);
+
+            std::atomic<int> ranBeforeStop{ 0 };
+            pStrand->Post([&]() { ranBeforeStop.fetch_add(1); });
+            Assert::IsTrue(WaitUntil([&]() { return pStrand->GetExecutedCount() == 1; }));
+
+            rfListener.Stop();
+
+            std::thread::id ranOn;
+            pStrand->Post([&]() { ranOn = std::this_thread::get_id(); });
+
+            Assert::IsTrue(std::this_thread::get_id() == ranOn);
+            Assert::AreEqual(1, ranBeforeStop.load());
+            Assert::AreEqual<std::uint64_t>(2, pStrand->GetExecutedCount());
+        }
+
+        // 풀의 마지막 참조가 워커 안에서 (drain 을 마친 strand 와 함께) 놓여도 워커가 자기 자신을 join 하지 않는다.
+        TEST_METHOD(LastPoolReference_ReleasedOnWorker_DoesNotSelfJoin)
+        {
+            std::atomic<bool> bRan{ false };
+            std::atomic<bool> bRelease{ false };
+            {
+                auto pPool = LibCommons::ThreadPool::Create(1);
+                auto pStrand = LibCommons::Strand::Create(pPool);
+                pStrand->Post([&]()
+                    {
+                        WaitUntil([&]() { return bRelease.load(); });
+                        bRan.store(true);
+                    });
+            }
+
+            // 이제 풀을 잡고 있는 것은 drain 작업 안의 strand 뿐이다.
+            bRelease.store(true);
+            Assert::IsTrue(WaitUntil([&]() { return bRan.load(); }));
+        }
+    };
+}
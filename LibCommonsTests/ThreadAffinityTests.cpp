@@ -0,0 +1,51 @@
+﻿#include "CppUnitTest.h"
+
+#include <Windows.h>
+
+import commons.thread_affinity;
+import std;
+
+// ThreadAffinity — thread-per-core shard 워커 고정 검증.
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+
+TEST_CLASS(ThreadAffinityTests)
+{
+public:
+
+    TEST_METHOD(GetProcessorCount_AtLeastOne)
+    {
+        Assert::IsTrue(LibCommons::ThreadAffinity::GetProcessorCount() >= 1u);
+    }
+
+    // 고정 후 현재 스레드는 지정한 프로세서에서만 실행되어야 한다.
+    TEST_METHOD(PinCurrentThread_RunsOnPinnedProcessor)
+    {
+        std::thread worker([]() {
+            Assert::IsTrue(LibCommons::ThreadAffinity::PinCurrentThread(0));
+
+            ::SwitchToThread();
+
+            PROCESSOR_NUMBER processor = {};
+            ::GetCurrentProcessorNumberEx(&processor);
+            Assert::AreEqual<int>(0, processor.Group);
+            Assert::AreEqual<int>(0, processor.Number);
+        });
+        worker.join();
+    }
+
+    // 프로세서 수를 넘는 인덱스는 나머지로 접어서 성공해야 한다 (shard 수 > 코어 수 설정).
+    TEST_METHOD(PinCurrentThread_IndexWrapsAround)
+    {
+        std::thread worker([]() {
+            const auto count = LibCommons::ThreadAffinity::GetProcessorCount();
+            Assert::IsTrue(LibCommons::ThreadAffinity::PinCurrentThread(count));
+        });
+        worker.join();
+    }
+};
+
+} // namespace LibCommonsTests
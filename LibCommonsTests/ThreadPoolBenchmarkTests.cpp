@@ -0,0 +1,252 @@
+﻿#include "CppUnitTest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <format>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+import commons.thread_pool;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        constexpr std::size_t kWorkerCount = 4;
+
+        // 비교 기준 — 교체 전 ThreadPool (단일 mutex + condition_variable + std::function 큐).
+        class LegacyThreadPool
+        {
+        public:
+            explicit LegacyThreadPool(std::size_t numThreads)
+            {
+                for (std::size_t i = 0; i < numThreads; ++i)
+                {
+                    m_Workers.emplace_back([this]() { WorkerThread(); });
+                }
+            }
+
+            ~LegacyThreadPool()
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_TaskQueueMutex);
+                    m_bStopped = true;
+                }
+                m_Condition.notify_all();
+                for (auto& worker : m_Workers)
+                {
+                    worker.join();
+                }
+            }
+
+            void Enqueue(std::function<void()> task)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_TaskQueueMutex);
+                    m_TaskQueue.emplace(std::move(task));
+                }
+                m_Condition.notify_one();
+            }
+
+        private:
+            void WorkerThread()
+            {
+                for (;;)
+                {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(m_TaskQueueMutex);
+                        m_Condition.wait(lock, [this] { return m_bStopped || !m_TaskQueue.empty(); });
+                        if (m_TaskQueue.empty())
+                        {
+                            return;
+                        }
+                        task = std::move(m_TaskQueue.front());
+                        m_TaskQueue.pop();
+                    }
+                    task();
+                }
+            }
+
+            std::vector<std::thread> m_Workers;
+            std::queue<std::function<void()>> m_TaskQueue;
+            std::mutex m_TaskQueueMutex;
+            std::condition_variable m_Condition;
+            bool m_bStopped = false;
+        };
+
+        void WaitForCount(const std::atomic<int>& rfCounter, int expected)
+        {
+            while (rfCounter.load(std::memory_order_acquire) < expected)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // 워커가 아닌 스레드 (IOCP 워커 역할) 여러 개가 작은 작업을 쏟아 넣는 패턴.
+        template<typename TPool>
+        double RunExternalProducers(TPool& rfPool, int producerCount, int tasksPerProducer)
+        {
+            std::atomic<int> executed{ 0 };
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            std::vector<std::thread> producers;
+            for (int p = 0; p < producerCount; ++p)
+            {
+                producers.emplace_back([&rfPool, &executed, tasksPerProducer]()
+                    {
+                        for (int i = 0; i < tasksPerProducer; ++i)
+                        {
+                            rfPool.Enqueue([&executed]() { executed.fetch_add(1, std::memory_order_release); });
+                        }
+                    });
+            }
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+            WaitForCount(executed, producerCount * tasksPerProducer);
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+            return elapsed.count();
+        }
+
+        // 작업이 하위 작업을 만드는 패턴 (fan-out). 루트 작업마다 하위 작업 children 개를 생성.
+        template<typename TPool>
+        double RunNestedSpawn(TPool& rfPool, int roots, int children)
+        {
+            std::atomic<int> executed{ 0 };
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (int r = 0; r < roots; ++r)
+            {
+                rfPool.Enqueue([&rfPool, &executed, children]()
+                    {
+                        for (int i = 0; i < children; ++i)
+                        {
+                            rfPool.Enqueue([&executed]() { executed.fetch_add(1, std::memory_order_release); });
+                        }
+                    });
+            }
+            WaitForCount(executed, roots * children);
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+            return elapsed.count();
+        }
+
+        struct LatencyResult
+        {
+            double P50Us = 0;
+            double P99Us = 0;
+        };
+
+        // 하나씩 넣고 실행 시작까지의 지연 — 유휴 워커를 깨우는 비용 (spin → park 경로 포함).
+        template<typename TPool>
+        LatencyResult RunEnqueueLatency(TPool& rfPool, int samples)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            std::vector<double> latencies;
+            latencies.reserve(samples);
+
+            for (int i = 0; i < samples; ++i)
+            {
+                std::atomic<bool> bDone{ false };
+                Clock::time_point started;
+
+                const auto enqueued = Clock::now();
+                rfPool.Enqueue([&bDone, &started]()
+                    {
+                        started = Clock::now();
+                        bDone.store(true, std::memory_order_release);
+                    });
+                while (!bDone.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                latencies.push_back(std::chrono::duration<double, std::micro>(started - enqueued).count());
+
+                // 매 10 번째는 워커가 잠들 만큼 쉬어 park 에서 깨우는 경로도 측정.
+                if (0 == i % 10)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                }
+            }
+
+            std::sort(latencies.begin(), latencies.end());
+            return { latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100] };
+        }
+    }
+
+    TEST_CLASS(ThreadPoolBenchmarkTests)
+    {
+    public:
+        TEST_METHOD(Benchmark_ExternalProducers_4x250K)
+        {
+            constexpr int kProducers = 4;
+            constexpr int kTasksPerProducer = 250000;
+
+            double legacyMs = 0;
+            {
+                LegacyThreadPool pool(kWorkerCount);
+                legacyMs = RunExternalProducers(pool, kProducers, kTasksPerProducer);
+            }
+
+            LibCommons::ThreadPool pool(kWorkerCount);
+            const double stealingMs = RunExternalProducers(pool, kProducers, kTasksPerProducer);
+            const auto stats = pool.GetStats();
+
+            std::string msg = std::format("ThreadPool {} producers x {} tasks — Legacy: {:.1f} ms, WorkStealing: {:.1f} ms (x{:.2f}), Stolen: {}, Parks: {}",
+                kProducers, kTasksPerProducer, legacyMs, stealingMs, stealingMs > 0 ? legacyMs / stealingMs : 0.0, stats.Stolen, stats.Parks);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+
+        TEST_METHOD(Benchmark_NestedSpawn_64x16K)
+        {
+            constexpr int kRoots = 64;
+            constexpr int kChildren = 16384;
+
+            double legacyMs = 0;
+            {
+                LegacyThreadPool pool(kWorkerCount);
+                legacyMs = RunNestedSpawn(pool, kRoots, kChildren);
+            }
+
+            LibCommons::ThreadPool pool(kWorkerCount);
+            const double stealingMs = RunNestedSpawn(pool, kRoots, kChildren);
+            const auto stats = pool.GetStats();
+
+            std::string msg = std::format("ThreadPool nested spawn {} x {} — Legacy: {:.1f} ms, WorkStealing: {:.1f} ms (x{:.2f}), Stolen: {}, Injected: {}",
+                kRoots, kChildren, legacyMs, stealingMs, stealingMs > 0 ? legacyMs / stealingMs : 0.0, stats.Stolen, stats.Injected);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+
+        TEST_METHOD(Benchmark_EnqueueToStartLatency)
+        {
+            constexpr int kSamples = 2000;
+
+            LatencyResult legacy;
+            {
+                LegacyThreadPool pool(kWorkerCount);
+                legacy = RunEnqueueLatency(pool, kSamples);
+            }
+
+            LibCommons::ThreadPool pool(kWorkerCount);
+            const LatencyResult stealing = RunEnqueueLatency(pool, kSamples);
+
+            std::string msg = std::format("ThreadPool enqueue->start latency ({} samples) — Legacy p50: {:.1f} us, p99: {:.1f} us / WorkStealing p50: {:.1f} us, p99: {:.1f} us, Parks: {}",
+                kSamples, legacy.P50Us, legacy.P99Us, stealing.P50Us, stealing.P99Us, pool.GetStats().Parks);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+    };
+}
@@ -0,0 +1,234 @@
+﻿#include "CppUnitTest.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+import commons.thread_pool;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    namespace
+    {
+        // 조건이 만족될 때까지 대기 (최대 5초).
+        template<typename TPredicate>
+        bool WaitUntil(TPredicate predicate)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!predicate())
+            {
+                if (std::chrono::steady_clock::now() > deadline)
+                {
+                    return false;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return true;
+        }
+    }
+
+    TEST_CLASS(ThreadPoolTests)
+    {
+    public:
+        TEST_METHOD(Task_SmallCaptureInline_LargeCaptureOnHeap)
+        {
+            int value = 0;
+            LibCommons::Task small([&value]() { value += 1; });
+            Assert::IsTrue(small.IsInline());
+
+            std::array<std::uint64_t, 16> payload{};
+            payload[15] = 41;
+            LibCommons::Task large([&value, payload]() { value += static_cast<int>(payload[15]); });
+            Assert::IsFalse(large.IsInline());
+
+            // 이동해도 캡처가 따라간다.
+            LibCommons::Task moved = std::move(large);
+            Assert::IsFalse(static_cast<bool>(large));
+
+            small();
+            moved();
+            Assert::AreEqual(42, value);
+        }
+
+        TEST_METHOD(Enqueue_MoveOnlyCapture_Runs)
+        {
+            LibCommons::ThreadPool pool(2);
+
+            auto pValue = std::make_unique<int>(7);
+            std::promise<int> promise;
+            auto future = promise.get_future();
+
+            pool.Enqueue([pValue = std::move(pValue), promise = std::move(promise)]() mutable
+                {
+                    promise.set_value(*pValue * 6);
+                });
+
+            Assert::AreEqual(42, future.get());
+        }
+
+        // 워커가 아닌 여러 스레드에서 동시에 넣어도 모두 한 번씩 실행된다.
+        TEST_METHOD(Enqueue_ManyProducers_RunsEveryTaskOnce)
+        {
+            constexpr int kProducers = 4;
+            constexpr int kTasksPerProducer = 20000;
+
+            LibCommons::ThreadPool pool(4);
+            std::atomic<int> executed{ 0 };
+
+            std::vector<std::thread> producers;
+            for (int p = 0; p < kProducers; ++p)
+            {
+                producers.emplace_back([&pool, &executed]()
+                    {
+                        for (int i = 0; i < kTasksPerProducer; ++i)
+                        {
+                            pool.Enqueue([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+                        }
+                    });
+            }
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+
+            Assert::IsTrue(WaitUntil([&]() { return executed.load() == kProducers * kTasksPerProducer; }));
+
+            const auto stats = pool.GetStats();
+            Assert::AreEqual<std::uint64_t>(kProducers * kTasksPerProducer, stats.Injected);
+        }
+
+        // 워커 안에서 넣은 작업은 자기 deque 로 가고, 남는 워커가 훔쳐 간다.
+        TEST_METHOD(Enqueue_FromWorker_FansOutAndIsStolen)
+        {
+            constexpr int kChildren = 10000;
+
+            LibCommons::ThreadPool pool(4);
+            std::atomic<int> executed{ 0 };
+
+            pool.Enqueue([&pool, &executed]()
+                {
+                    for (int i = 0; i < kChildren; ++i)
+                    {
+                        pool.Enqueue([&executed]()
+                            {
+                                // 훔쳐 갈 시간을 주도록 약간의 일.
+                                volatile int spin = 0;
+                                for (int j = 0; j < 200; ++j)
+                                {
+                                    spin = spin + j;
+                                }
+                                executed.fetch_add(1, std::memory_order_relaxed);
+                            });
+                    }
+                });
+
+            Assert::IsTrue(WaitUntil([&]() { return executed.load() == kChildren; }));
+
+            const auto stats = pool.GetStats();
+            Assert::AreEqual<std::uint64_t>(1, stats.Injected);
+            Assert::IsTrue(stats.Stolen > 0, L"다른 워커가 일부를 훔쳐 실행해야 함");
+        }
+
+        // Stop 이전에 들어온 작업은 모두 실행되고, 이후 작업은 버려진다.
+        TEST_METHOD(Stop_DrainsQueuedTasksThenRejects)
+        {
+            std::atomic<int> executed{ 0 };
+            {
+                LibCommons::ThreadPool pool(2);
+                for (int i = 0; i < 1000; ++i)
+                {
+                    pool.Enqueue([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+                }
+                pool.Stop();
+                Assert::IsTrue(pool.IsStopped());
+
+                Assert::IsFalse(pool.Enqueue([&executed]() { executed.fetch_add(1000, std::memory_order_relaxed); }));
+            }
+
+            Assert::AreEqual(1000, executed.load());
+        }
+
+        // Enqueue 와 Stop 이 동시에 일어나도 true 를 돌려받은 작업은 모두 실행된다
+        // (정지 확인 직후 Stop 이 끼어들어 워커가 먼저 종료하면 작업이 버려지고 strand drain 이 사라진다).
+        TEST_METHOD(Enqueue_RacingStop_AcceptedTasksAllRun)
+        {
+            constexpr int kRounds = 500;
+            constexpr int kProducers = 3;
+
+            for (int round = 0; round < kRounds; ++round)
+            {
+                std::atomic<int> accepted{ 0 };
+                std::atomic<int> executed{ 0 };
+                {
+                    LibCommons::ThreadPool pool(2);
+                    std::atomic<bool> bStart{ false };
+
+                    std::vector<std::thread> producers;
+                    for (int p = 0; p < kProducers; ++p)
+                    {
+                        producers.emplace_back([&, p]()
+                            {
+                                while (!bStart.load())
+                                {
+                                    std::this_thread::yield();
+                                }
+                                // injection queue 경로와 EnqueueGlobal 경로를 섞는다.
+                                while (true)
+                                {
+                                    auto task = [&executed]() { executed.fetch_add(1, std::memory_order_relaxed); };
+                                    const bool bAccepted = (p % 2 == 0) ? pool.Enqueue(task) : pool.EnqueueGlobal(task);
+                                    if (!bAccepted)
+                                    {
+                                        break;
+                                    }
+                                    accepted.fetch_add(1, std::memory_order_relaxed);
+                                }
+                            });
+                    }
+
+                    bStart.store(true);
+                    std::this_thread::yield();
+                    pool.Stop();
+
+                    for (auto& producer : producers)
+                    {
+                        producer.join();
+                    }
+                }
+
+                Assert::AreEqual(accepted.load(), executed.load(), L"받아들인 작업이 실행되지 않고 버려짐");
+            }
+        }
+
+        TEST_METHOD(WorkStealingDeque_OwnerLifoThiefFifo)
+        {
+            int items[300] = {};
+            LibCommons::detail::WorkStealingDeque<int*> deque(4);
+
+            // 초기 용량을 넘겨 Grow 경로도 지난다.
+            for (auto& item : items)
+            {
+                deque.Push(&item);
+            }
+            Assert::AreEqual<std::size_t>(300, deque.GetSizeApprox());
+
+            Assert::IsTrue(&items[0] == deque.Steal());
+            Assert::IsTrue(&items[299] == deque.Pop());
+            Assert::IsTrue(&items[1] == deque.Steal());
+
+            int remaining = 0;
+            while (deque.Pop())
+            {
+                ++remaining;
+            }
+            Assert::AreEqual(297, remaining);
+            Assert::IsTrue(nullptr == deque.Steal());
+        }
+    };
+}
@@ -0,0 +1,76 @@
+﻿#include "CppUnitTest.h"
+
+import commons.timer_queue;
+import std;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibCommonsTests
+{
+    // 타이밍 휠 Schedule / Cancel 처리량. 세션 수만큼 idle/재전송 타이머가 걸렸다 취소되는 패턴.
+    TEST_CLASS(TimerQueueBenchmarkTests)
+    {
+    public:
+        // 1M 타이머 등록 후 전부 취소 — 휠에 모두 걸린 상태에서의 등록/취소 비용.
+        TEST_METHOD(Benchmark_ScheduleCancel_1M)
+        {
+            const int OC = 1000000;
+
+            LibCommons::TimerQueue timerQueue;
+            std::vector<LibCommons::TimerId> ids;
+            ids.reserve(OC);
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            // 1초 ~ 10분 구간에 고르게 분산 — level0 부터 상위 level 까지 모두 사용.
+            for (int i = 0; i < OC; ++i)
+            {
+                const auto delay = std::chrono::milliseconds(1000 + (static_cast<std::int64_t>(i) * 7919) % 600000);
+                ids.push_back(timerQueue.ScheduleOnce(delay, []() {}, "Bench"));
+            }
+
+            auto scheduled = std::chrono::high_resolution_clock::now();
+
+            int cancelled = 0;
+            for (auto id : ids)
+            {
+                cancelled += timerQueue.Cancel(id) ? 1 : 0;
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+
+            Assert::AreEqual(OC, cancelled, L"Every pending timer should be cancelled");
+
+            std::chrono::duration<double, std::milli> scheduleElapsed = scheduled - start;
+            std::chrono::duration<double, std::milli> cancelElapsed = end - scheduled;
+
+            std::string msg = std::format("TimerQueue 1M Schedule: {:.1f} ms ({:.1f} ns/op), Cancel: {:.1f} ms ({:.1f} ns/op)",
+                scheduleElapsed.count(), scheduleElapsed.count() * 1e6 / OC,
+                cancelElapsed.count(), cancelElapsed.count() * 1e6 / OC);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+
+        // 등록 직후 취소 반복 — 엔트리 슬랩 재사용 경로 (요청당 타이머 1개 패턴).
+        TEST_METHOD(Benchmark_ScheduleCancelChurn_1M)
+        {
+            const int OC = 1000000;
+
+            LibCommons::TimerQueue timerQueue;
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (int i = 0; i < OC; ++i)
+            {
+                const auto id = timerQueue.ScheduleOnce(std::chrono::seconds(30), []() {}, "Bench");
+                timerQueue.Cancel(id);
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::milli> elapsed = end - start;
+
+            std::string msg = std::format("TimerQueue 1M Schedule+Cancel churn: {:.1f} ms ({:.1f} ns/op)",
+                elapsed.count(), elapsed.count() * 1e6 / OC);
+            Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(msg.c_str());
+        }
+    };
+}
@@ -449,6 +449,51 @@ public:
         Assert::AreEqual(1, callbackCount.load(std::memory_order_relaxed), L"Self-destruction callback should run exactly once");
         Assert::IsFalse(static_cast<bool>(*pQueueBox), L"Callback should destroy the local TimerQueue instance");
     }
+
+    // U-21: level0(256 tick) 경계를 넘는 지연도 cascade 후 제시간에 발사 — 먼저 발사되지 않음.
+    TEST_METHOD(ScheduleOnce_BeyondLevel0_FiresOnTime)
+    {
+        LibCommons::TimerQueue localTq;
+        const auto start = std::chrono::steady_clock::now();
+        std::atomic<long long> elapsedMs { -1 };
+
+        localTq.ScheduleOnce(400ms,
+            [&elapsedMs, start]()
+            {
+                elapsedMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+            },
+            "U21-Cascade");
+
+        std::this_thread::sleep_for(700ms);
+
+        Assert::IsTrue(elapsedMs.load() >= 400, L"Timer must not fire before its delay");
+        Assert::IsTrue(elapsedMs.load() < 600, L"Timer must fire shortly after cascade from level1");
+    }
+
+    // U-22: TimerQueueConfig executor 주입 — 콜백이 휠 스레드가 아닌 executor 경로로 실행.
+    TEST_METHOD(Config_CustomExecutor_RunsCallbacks)
+    {
+        std::atomic<int> submitted { 0 };
+
+        LibCommons::TimerQueueConfig config;
+        config.tickResolution = 5ms;
+        config.executor = [&submitted](std::function<void()> task)
+            {
+                submitted.fetch_add(1);
+                std::thread(std::move(task)).detach();
+            };
+
+        std::atomic<int> counter { 0 };
+        {
+            LibCommons::TimerQueue localTq(config);
+            localTq.ScheduleOnce(20ms, [&counter]() { counter.fetch_add(1); }, "U22-Executor");
+            std::this_thread::sleep_for(200ms);
+        }  // 소멸자 Shutdown(wait) — executor 로 넘긴 콜백 종료까지 대기.
+
+        Assert::AreEqual(1, submitted.load(), L"Expired timer should be handed to the executor once");
+        Assert::AreEqual(1, counter.load(), L"Executor should run the callback");
+    }
 };
 
 } // namespace LibCommonsTests
@@ -16,6 +16,7 @@ import std;
 import commons.logger;
 import networks.sessions.inetwork_session;
 import networks.core.packet;
+import networks.core.packet_view;
 import networks.stats.server_stats_collector;
 
 
@@ -40,6 +41,17 @@ inline ::fastport::protocols::admin::ServerMode ToProtoServerMode(Stats::ServerM
     default:                      return ::fastport::protocols::admin::SERVER_MODE_UNKNOWN;
     }
 }
+
+// ELogSiteKind → proto enum 변환.
+inline ::fastport::protocols::admin::LogSiteKind ToProtoLogSiteKind(LibCommons::ELogSiteKind kind) noexcept
+{
+    switch (kind)
+    {
+    case LibCommons::ELogSiteKind::RateLimit: return ::fastport::protocols::admin::LOG_SITE_KIND_RATE_LIMIT;
+    case LibCommons::ELogSiteKind::Sample:    return ::fastport::protocols::admin::LOG_SITE_KIND_SAMPLE;
+    default:                                  return ::fastport::protocols::admin::LOG_SITE_KIND_UNKNOWN;
+    }
+}
 } // anonymous namespace
 
 
@@ -51,6 +63,13 @@ AdminPacketHandler::AdminPacketHandler(Stats::ServerStatsCollector& collector)
 
 bool AdminPacketHandler::HandlePacket(Sessions::INetworkSession& sender,
                                       const Core::Packet& packet)
+{
+    return HandlePacket(sender, Core::PacketView::FromPacket(packet));
+}
+
+
+bool AdminPacketHandler::HandlePacket(Sessions::INetworkSession& sender,
+                                      const Core::PacketView& packet)
 {
     const auto packetId = packet.GetPacketId();
 
@@ -71,6 +90,10 @@ bool AdminPacketHandler::HandlePacket(Sessions::INetworkSession& sender,
             HandleSessionListRequest(sender, packet);
             return true;
 
+        case kPacketId_LogSuppressionReq:
+            HandleLogSuppressionRequest(sender, packet);
+            return true;
+
         default:
             LogWarning(std::format("Unknown admin packet id : {:#06x}, sessionId : {}",
                 packetId, sender.GetSessionId()));
@@ -86,7 +109,7 @@ bool AdminPacketHandler::HandlePacket(Sessions::INetworkSession& sender,
 
 
 void AdminPacketHandler::HandleSummaryRequest(Sessions::INetworkSession& sender,
-                                              const Core::Packet& packet)
+                                              const Core::PacketView& packet)
 {
     ::fastport::protocols::admin::AdminStatusSummaryRequest request;
     if (!packet.ParseMessage(request))
@@ -115,12 +138,21 @@ void AdminPacketHandler::HandleSummaryRequest(Sessions::INetworkSession& sender,
     response.set_process_cpu_percent(summary.processCpuPercent);
     response.set_server_timestamp_ms(static_cast<google::protobuf::uint64>(summary.serverTimestampMs));
 
+    for (const auto bucket : summary.completionBatches.Buckets)
+    {
+        response.add_completion_batch_histogram(bucket);
+    }
+    response.set_completion_batch_count(summary.completionBatches.BatchCount);
+    response.set_completion_count(summary.completionBatches.CompletionCount);
+    response.set_session_buffer_bytes(summary.sessionBufferBytes);
+    response.set_bytes_per_session(summary.bytesPerSession);
+
     sender.SendMessage(kPacketId_SummaryResponse, response);
 }
 
 
 void AdminPacketHandler::HandleSessionListRequest(Sessions::INetworkSession& sender,
-                                                  const Core::Packet& packet)
+                                                  const Core::PacketView& packet)
 {
     ::fastport::protocols::admin::AdminSessionListRequest request;
     if (!packet.ParseMessage(request))
@@ -155,4 +187,37 @@ void AdminPacketHandler::HandleSessionListRequest(Sessions::INetworkSession& sen
     sender.SendMessage(kPacketId_SessionListRes, response);
 }
 
+
+void AdminPacketHandler::HandleLogSuppressionRequest(Sessions::INetworkSession& sender,
+                                                     const Core::PacketView& packet)
+{
+    ::fastport::protocols::admin::AdminLogSuppressionRequest request;
+    if (!packet.ParseMessage(request))
+    {
+        LogError(std::format("LogSuppression parse failed. SessionId : {}", sender.GetSessionId()));
+        return;
+    }
+
+    LogDebug(std::format("LogSuppression request from session {}", sender.GetSessionId()));
+
+    ::fastport::protocols::admin::AdminLogSuppressionResponse response;
+    auto* pHeader = response.mutable_header();
+    pHeader->set_request_id(request.header().request_id());
+    pHeader->set_timestamp_ms(request.header().timestamp_ms());
+
+    response.set_result(::fastport::protocols::commons::RESULT_CODE_OK);
+
+    for (auto const& site : LibCommons::SnapshotLogSites())
+    {
+        auto* pSite = response.add_sites();
+        pSite->set_name(site.Name.data(), site.Name.size());
+        pSite->set_kind(ToProtoLogSiteKind(site.Kind));
+        pSite->set_admitted(site.Admitted);
+        pSite->set_suppressed(site.Suppressed);
+    }
+    response.set_async_log_dropped(LibCommons::Logger::GetInstance().GetAsyncLogStats().Dropped);
+
+    sender.SendMessage(kPacketId_LogSuppressionRes, response);
+}
+
 } // namespace LibNetworks::Admin
@@ -12,6 +12,7 @@ export module networks.admin.admin_packet_handler;
 import std;
 import networks.sessions.inetwork_session;
 import networks.core.packet;
+import networks.core.packet_view;
 import networks.stats.server_stats_collector;
 
 
@@ -23,6 +24,8 @@ export constexpr std::uint16_t kPacketId_SummaryRequest   = 0x8001;
 export constexpr std::uint16_t kPacketId_SummaryResponse  = 0x8002;
 export constexpr std::uint16_t kPacketId_SessionListReq   = 0x8003;
 export constexpr std::uint16_t kPacketId_SessionListRes   = 0x8004;
+export constexpr std::uint16_t kPacketId_LogSuppressionReq = 0x8005;
+export constexpr std::uint16_t kPacketId_LogSuppressionRes = 0x8006;
 
 // Admin 대역: 0x8000 ~ 0x8FFF.
 export inline bool IsAdminPacketId(std::uint16_t id) noexcept
@@ -37,12 +40,17 @@ public:
     explicit AdminPacketHandler(Stats::ServerStatsCollector& collector);
 
     // 패킷 ID 가 admin 대역이면 true (처리 완료). 아니면 false (호출자가 다른 dispatch).
+    bool HandlePacket(Sessions::INetworkSession& sender,
+                      const Core::PacketView& packet);
+
+    // 소유 Packet 호환 오버로드 — PacketView 로 위임.
     bool HandlePacket(Sessions::INetworkSession& sender,
                       const Core::Packet& packet);
 
 private:
-    void HandleSummaryRequest(Sessions::INetworkSession& sender, const Core::Packet& packet);
-    void HandleSessionListRequest(Sessions::INetworkSession& sender, const Core::Packet& packet);
+    void HandleSummaryRequest(Sessions::INetworkSession& sender, const Core::PacketView& packet);
+    void HandleSessionListRequest(Sessions::INetworkSession& sender, const Core::PacketView& packet);
+    void HandleLogSuppressionRequest(Sessions::INetworkSession& sender, const Core::PacketView& packet);
 
     Stats::ServerStatsCollector& m_Collector;
 };
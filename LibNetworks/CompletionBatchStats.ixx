@@ -0,0 +1,97 @@
+﻿module;
+
+#include <cstdint>
+
+export module networks.core.completion_batch_stats;
+
+import std;
+
+namespace LibNetworks::Core
+{
+
+// 완료 dequeue 배치 크기 분포. bucket i 는 (2^(i-1), 2^i] 구간 — 0:1, 1:2, 2:3~4, 3:5~8 ... 마지막은 상한 없음.
+export struct CompletionBatchHistogram
+{
+    static constexpr std::size_t kBucketCount = 10;
+
+    std::array<std::uint64_t, kBucketCount> Buckets{};
+    std::uint64_t BatchCount = 0;
+    std::uint64_t CompletionCount = 0;
+
+    // bucket 의 포함 상한 (마지막 bucket 은 0 = 무제한).
+    static constexpr std::uint32_t UpperBound(std::size_t index) noexcept
+    {
+        return index + 1 < kBucketCount ? (1u << index) : 0u;
+    }
+
+    static constexpr std::size_t BucketOf(std::size_t count) noexcept
+    {
+        const std::size_t index = count <= 1 ? 0 : static_cast<std::size_t>(std::bit_width(count - 1));
+        return (std::min)(index, kBucketCount - 1);
+    }
+};
+
+/**
+ * CompletionBatchStats
+ * 프로세스 전역 완료 배치 크기 집계 (GQCSEx 1회 = 배치 1개).
+ *
+ * - 워커는 wake 1회마다 Record(꺼낸 완료/이벤트 수) — 0 개(타임아웃) 는 기록하지 않는다.
+ * - relaxed atomic 누적. Snapshot 은 bucket 간 원자성을 보장하지 않는다 (관측용).
+ */
+export class CompletionBatchStats
+{
+public:
+    static void Record(std::size_t completionCount) noexcept
+    {
+        if (completionCount == 0)
+        {
+            return;
+        }
+
+        auto& state = State();
+        state.Buckets[CompletionBatchHistogram::BucketOf(completionCount)].fetch_add(1, std::memory_order_relaxed);
+        state.BatchCount.fetch_add(1, std::memory_order_relaxed);
+        state.CompletionCount.fetch_add(completionCount, std::memory_order_relaxed);
+    }
+
+    static CompletionBatchHistogram Snapshot() noexcept
+    {
+        auto& state = State();
+
+        CompletionBatchHistogram out;
+        for (std::size_t i = 0; i < CompletionBatchHistogram::kBucketCount; ++i)
+        {
+            out.Buckets[i] = state.Buckets[i].load(std::memory_order_relaxed);
+        }
+        out.BatchCount = state.BatchCount.load(std::memory_order_relaxed);
+        out.CompletionCount = state.CompletionCount.load(std::memory_order_relaxed);
+        return out;
+    }
+
+    static void Reset() noexcept
+    {
+        auto& state = State();
+        for (auto& bucket : state.Buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        state.BatchCount.store(0, std::memory_order_relaxed);
+        state.CompletionCount.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct Counters
+    {
+        std::array<std::atomic<std::uint64_t>, CompletionBatchHistogram::kBucketCount> Buckets{};
+        std::atomic<std::uint64_t> BatchCount = 0;
+        std::atomic<std::uint64_t> CompletionCount = 0;
+    };
+
+    static Counters& State() noexcept
+    {
+        static Counters counters;
+        return counters;
+    }
+};
+
+} // namespace LibNetworks::Core
@@ -1,13 +1,17 @@
 ﻿module;
 
 #include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <ranges>
+#include <type_traits>
 #include <google/protobuf/message.h>
 
-#include <WinSock2.h>
-
 export module networks.sessions.inetwork_session;
 
 import commons.buffers.ibuffer;
+import networks.core.shared_packet;
 
 namespace LibNetworks::Sessions
 {
@@ -25,6 +29,122 @@ export enum class DisconnectReason : std::uint8_t
 };
 
 
+// TrySendMessage 결과.
+export enum class SendResult : std::uint8_t
+{
+    Ok           = 0,  // 송신 버퍼/큐에 적재됨
+    WouldBlock   = 1,  // 적재량이 high watermark 이상 — 적재하지 않음 (호출자가 버리거나 합친다)
+    Overflow     = 2,  // 송신 버퍼/큐 한도 초과 — 적재하지 않음
+    Disconnected = 3,  // 종료 요청 이후
+    Failed       = 4,  // 직렬화 실패 (세션 종료)
+};
+
+
+/**
+ * 송신 적재량 high/low watermark.
+ *
+ * 적재량이 high 이상이 되면 backpressure 상태로, low 이하로 빠지면 해제 상태로 전이한다.
+ * 전이가 일어나면 Update 에 넘긴 통지 함수가 호출된다 — 세션은 그때 OnSendBackpressure 를 호출한다.
+ * high == 0 이면 비활성. 세션 생성 시 SetDefaults 로 지정한 프로세스 기본값을 쓴다.
+ *
+ * 판단은 호출자가 미리 읽은 값이 아니라 Update 안에서 다시 읽은 적재량으로 한다. 동시에 들어온 Update 는
+ * 먼저 들어온 스레드 하나가 몰아서 처리하며, 처리 도중 새 Update 가 오면 적재량을 다시 읽어 재평가한다.
+ * 그래서 송신과 완료가 엇갈려도 최종 상태는 마지막 적재량과 맞고, on / off 통지는 번갈아 순서대로 나간다.
+ *
+ * [Thread Safety] Update 는 임의 스레드 (SendMessage / 송신 완료) 에서 호출 가능. 통지 함수 안에서 다시
+ *                 Update 를 불러도 된다 (진행 중인 처리가 이어받는다).
+ */
+export class SendWatermark
+{
+public:
+    SendWatermark() noexcept
+        : m_LowBytes(m_DefaultLowBytes.load(std::memory_order_relaxed)),
+          m_HighBytes(m_DefaultHighBytes.load(std::memory_order_relaxed))
+    {
+    }
+
+    // 이후 생성되는 (또는 ResetToDefaults 하는) 세션의 기본값.
+    static void SetDefaults(std::size_t lowBytes, std::size_t highBytes) noexcept
+    {
+        m_DefaultLowBytes.store(lowBytes, std::memory_order_relaxed);
+        m_DefaultHighBytes.store(highBytes, std::memory_order_relaxed);
+    }
+
+    void Set(std::size_t lowBytes, std::size_t highBytes) noexcept
+    {
+        m_LowBytes.store(lowBytes, std::memory_order_relaxed);
+        m_HighBytes.store(highBytes, std::memory_order_relaxed);
+    }
+
+    void ResetToDefaults() noexcept
+    {
+        Set(m_DefaultLowBytes.load(std::memory_order_relaxed), m_DefaultHighBytes.load(std::memory_order_relaxed));
+        m_bBackpressured.store(false, std::memory_order_relaxed);
+    }
+
+    bool IsAboveHigh(std::size_t pendingBytes) const noexcept
+    {
+        const std::size_t high = m_HighBytes.load(std::memory_order_relaxed);
+        return high > 0 && pendingBytes >= high;
+    }
+
+    bool IsBackpressured() const noexcept { return m_bBackpressured.load(std::memory_order_acquire); }
+
+    // 적재량 변화 후 호출. readPending() 으로 현재 적재량을 읽고, 전이마다 notify(bBackpressured, pendingBytes).
+    template<typename TReadPending, typename TNotify>
+    void Update(TReadPending&& readPending, TNotify&& notify)
+    {
+        if (m_HighBytes.load(std::memory_order_relaxed) == 0 && !m_bBackpressured.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        // 이미 처리 중인 스레드가 있으면 맡긴다 — 그 스레드가 빠져나가기 전에 다시 읽는다.
+        if (m_UpdateRequests.fetch_add(1, std::memory_order_acq_rel) != 0)
+        {
+            return;
+        }
+
+        std::size_t handled = 0;
+        do
+        {
+            handled = m_UpdateRequests.load(std::memory_order_acquire);
+
+            const std::size_t pendingBytes = readPending();
+            const std::size_t high = m_HighBytes.load(std::memory_order_relaxed);
+            const bool bWasBackpressured = m_bBackpressured.load(std::memory_order_relaxed);
+
+            bool bBackpressured = bWasBackpressured;
+            if (high == 0 || pendingBytes <= m_LowBytes.load(std::memory_order_relaxed))
+            {
+                bBackpressured = false;
+            }
+            else if (pendingBytes >= high)
+            {
+                bBackpressured = true;
+            }
+
+            if (bBackpressured != bWasBackpressured)
+            {
+                m_bBackpressured.store(bBackpressured, std::memory_order_release);
+                notify(bBackpressured, pendingBytes);
+            }
+        } while (m_UpdateRequests.fetch_sub(handled, std::memory_order_acq_rel) != handled);
+    }
+
+private:
+    std::atomic<std::size_t> m_LowBytes;
+    std::atomic<std::size_t> m_HighBytes;
+    std::atomic<bool> m_bBackpressured { false };
+
+    // 처리되지 않은 Update 요청 수. 0 → 1 로 올린 스레드만 판단 / 통지한다.
+    std::atomic<std::size_t> m_UpdateRequests { 0 };
+
+    inline static std::atomic<std::size_t> m_DefaultLowBytes { 0 };
+    inline static std::atomic<std::size_t> m_DefaultHighBytes { 0 };
+};
+
+
 /**
  * 네트워크 세션 인터페이스 (IOCP, RIO 공통)
  */
@@ -36,6 +156,25 @@ public:
     // 메시지를 상대방에게 전송합니다.
     virtual void SendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage) = 0;
 
+    // 송신 적재량이 high watermark 이상이거나 한도를 넘으면 적재하지 않고 상태를 반환한다.
+    // 위치 갱신처럼 버려도 되는 트래픽용. 기본 구현은 SendMessage 로 위임.
+    virtual SendResult TrySendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage)
+    {
+        SendMessage(packetId, rfMessage);
+        return SendResult::Ok;
+    }
+
+    // 미리 직렬화된 공유 프레임 송신 (브로드캐스트용). TrySendMessage 와 같이 high watermark 이상이면
+    // WouldBlock 으로 건너뛴다 — 느린 수신자 하나가 공유 프레임을 무한히 붙잡지 않도록.
+    // 기본 구현은 미지원 (Failed).
+    virtual SendResult SendSharedPacket(const Core::SharedPacket& /*rfPacket*/) { return SendResult::Failed; }
+
+    // 송신 watermark 지정 (바이트). highBytes == 0 이면 비활성.
+    virtual void SetSendWatermarks(std::size_t /*lowBytes*/, std::size_t /*highBytes*/) {}
+
+    // 현재 backpressure 상태 (high 도달 후 low 로 빠지기 전).
+    virtual bool IsSendBackpressured() const { return false; }
+
     // 세션 고유 식별자 조회
     virtual uint64_t GetSessionId() const = 0;
 
@@ -46,8 +185,15 @@ public:
     // 연결 종료 이벤트 처리 훅
     virtual void OnDisconnected() = 0;
 
-    // (Outbound 전용) ConnectEx용 OVERLAPPED 포인터 반환
-    virtual OVERLAPPED* GetConnectOverlappedPtr() { return nullptr; }
+    // 송신 backpressure 전이 훅. true = high watermark 도달, false = low watermark 이하로 해소.
+    // 전이를 일으킨 스레드 (SendMessage 호출 스레드 또는 송신 완료 워커) 에서 호출된다.
+    virtual void OnSendBackpressure(bool /*bBackpressured*/) {}
+
+    // 송신 corking. Cork 중 SendMessage 는 송신 버퍼에만 누적되고, 마지막 Uncork 시
+    // 누적분을 한 번의 gather-send 로 flush 한다. 중첩 호출 가능 (depth 카운트).
+    // 기본 구현은 no-op — corking 을 지원하지 않는 세션은 즉시 송신.
+    virtual void Cork() {}
+    virtual void Uncork() {}
 
 protected:
     // 수신 데이터 누적 버퍼(큐).
@@ -56,4 +202,74 @@ protected:
     std::unique_ptr<LibCommons::Buffers::IBuffer> m_pSendBuffer{};
 };
 
+/**
+ * 세션 범위에 같은 SharedPacket 을 보낸다. 적재된 (SendResult::Ok) 세션 수를 반환.
+ * 원소는 세션 참조, 포인터, shared_ptr 모두 가능 (null 은 건너뜀).
+ *
+ * 사용 예)
+ *   auto packet = Core::SharedPacket::Serialize(PACKET_ID_CHAT, chat);
+ *   Broadcast(roomSessions, packet);
+ */
+export template <std::ranges::input_range TSessions>
+std::size_t Broadcast(TSessions&& rfSessions, const Core::SharedPacket& rfPacket)
+{
+    if (!rfPacket.IsValid())
+    {
+        return 0;
+    }
+
+    std::size_t accepted = 0;
+    for (auto&& rfEntry : rfSessions)
+    {
+        INetworkSession* pSession = nullptr;
+        if constexpr (std::is_pointer_v<std::remove_cvref_t<decltype(rfEntry)>>)
+        {
+            pSession = rfEntry;
+        }
+        else if constexpr (requires { rfEntry.get(); })
+        {
+            pSession = rfEntry.get();
+        }
+        else
+        {
+            pSession = &rfEntry;
+        }
+
+        if (pSession && pSession->SendSharedPacket(rfPacket) == SendResult::Ok)
+        {
+            ++accepted;
+        }
+    }
+    return accepted;
+}
+
+/**
+ * SendBatch
+ * Cork/Uncork RAII 스코프. 핸들러에서 여러 응답을 보낼 때 송신 syscall 을 1회로 합친다.
+ *
+ * 사용 예)
+ *   SendBatch batch(session);
+ *   for (auto& item : items) session.SendMessage(id, item);
+ *   // 스코프 종료 시 Uncork → 한 번에 flush
+ */
+export class SendBatch
+{
+public:
+    explicit SendBatch(INetworkSession& rfSession) : m_rfSession(rfSession)
+    {
+        m_rfSession.Cork();
+    }
+
+    ~SendBatch()
+    {
+        m_rfSession.Uncork();
+    }
+
+    SendBatch(const SendBatch&) = delete;
+    SendBatch& operator=(const SendBatch&) = delete;
+
+private:
+    INetworkSession& m_rfSession;
+};
+
 } // namespace LibNetworks::Sessions
@@ -1,7 +1,12 @@
 ﻿module;
+#include <cstdint>
+#if defined(_WIN32)
 #include <windows.h>
+#endif
 export module networks.core.io_consumer;
 
+import networks.core.io_operation;
+
 namespace LibNetworks::Core
 {
 
@@ -9,12 +14,27 @@ export class IIOConsumer
 {
 public:
 
-	virtual void OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped) = 0;
+	// 플랫폼 중립 완료 통지 진입점. 모든 백엔드(IOCP, epoll ...)는 이 경로로 dispatch 한다.
+	virtual void OnIOCompleted(const IoCompletion& rfCompletion) = 0;
+
+#if defined(_WIN32)
+	// IOCP 완료 통지 어댑터 — OVERLAPPED* 를 IoOperation 으로 역변환해 위임.
+	void OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped)
+	{
+		IoCompletion completion{};
+		completion.pOperation = IoOperation::FromOverlapped(pOverlapped);
+		completion.bSuccess = bSuccess;
+		completion.BytesTransferred = bytesTransferred;
+		completion.ErrorCode = bSuccess ? 0 : static_cast<int>(::GetLastError());
+		OnIOCompleted(completion);
+	}
+#endif
 
-	virtual ULONG_PTR GetCompletionId() const
+	// 완료 통지 라우팅 키 (IOCP completion key / epoll data).
+	virtual std::uintptr_t GetCompletionId() const
 	{
-		return reinterpret_cast<ULONG_PTR>(this);
+		return reinterpret_cast<std::uintptr_t>(this);
 	}
 };
 
-} // namespace LibNetworks::Core
\ No newline at end of file
+} // namespace LibNetworks::Core
@@ -11,9 +11,19 @@ import std;
 
 namespace LibNetworks::Services
 {
+/**
+ * IOService
+ * IOCP 워커 풀. 워커는 GetQueuedCompletionStatusEx 로 wake 1회에 최대 CompletionBatchSize 개의 완료를 꺼내 처리한다.
+ *
+ * - 배치 처리 후 큐가 비었으면(꺼낸 수 < 배치 크기) 배치 종료 — SendFlushBatch 에 지연된 세션 송신을 한 번에 flush.
+ * - 배치 크기 분포는 CompletionBatchStats 에 기록 (ServerStatsCollector 로 노출).
+ */
 export class IOService : public INetworkService
 {
 public:
+    static constexpr std::uint32_t kDefaultCompletionBatchSize = 64;
+    static constexpr std::uint32_t kMaxCompletionBatchSize = 1024;
+
     IOService();
     virtual ~IOService() override;
 
@@ -29,6 +39,16 @@ public:
 
     bool Post(ULONG_PTR uCompletionKey, DWORD bytes = 0, OVERLAPPED* ov = nullptr) const;
 
+    // wake 1회에 꺼낼 최대 완료 수. Start 전에 호출 (1 ~ kMaxCompletionBatchSize 로 clamp).
+    void SetCompletionBatchSize(std::uint32_t batchSize) noexcept;
+    std::uint32_t GetCompletionBatchSize() const noexcept { return m_CompletionBatchSize; }
+
+    // 이후 생성되는 IOService 의 기본 배치 크기 (프로세스 전역). Acceptor 가 내부에서 만드는 서비스에도 적용.
+    static void SetDefaultCompletionBatchSize(std::uint32_t batchSize) noexcept;
+
+    // 워커 i 를 논리 프로세서 (firstProcessor + i) 에 고정. Start 전에 호출 (thread-per-core shard 용).
+    void SetWorkerAffinity(std::uint32_t firstProcessor) noexcept { m_FirstWorkerProcessor = firstProcessor; }
+
 private:
     bool CreateCompletionPort();
 private:
@@ -39,6 +59,11 @@ private:
 
     HANDLE m_hICOP = nullptr;
 
+    std::uint32_t m_CompletionBatchSize = kDefaultCompletionBatchSize;
+    inline static std::atomic<std::uint32_t> m_DefaultCompletionBatchSize { kDefaultCompletionBatchSize };
+
+    std::optional<std::uint32_t> m_FirstWorkerProcessor;
+
     std::mutex m_Mutex;
     std::condition_variable m_cv;
     std::atomic<bool> m_bTerminated = false;
@@ -1,6 +1,5 @@
 ﻿module;
 
-#include <WinSock2.h>
 #include <spdlog/spdlog.h>
 #include <algorithm>
 #include <cstring>
@@ -9,13 +8,23 @@
 #include <span>
 #include <chrono>
 #include <cstdint>
+#include <mutex>
+#include <limits>
+#include <memory>
 
 module networks.sessions.io_session;
 
 import commons.logger;
+import commons.strand;
 import networks.core.packet;
+import networks.core.packet_view;
+import networks.core.span_output_stream;
 import networks.core.packet_framer;
+import networks.core.send_flush_batch;
+import networks.core.shared_packet;
 import networks.core.socket;
+import networks.core.io_operation;
+import networks.core.io_backend;
 
 
 namespace LibNetworks::Sessions
@@ -23,6 +32,18 @@ namespace LibNetworks::Sessions
 
 namespace
 {
+// 송수신 / completion 마다 도는 경로 — Release 에서는 Debug / Info 가 컴파일되지 않는다.
+constinit LibCommons::HotPathLogCategory s_LogCategory{ "IOSession" };
+
+// 대량 접속 종료 / 송신 포화 때 세션마다 한 줄씩 나오는 경로 — 호출 위치별 rate limit (초당 1, burst 10).
+constinit LibCommons::LogRateLimit s_SendOverflowLogLimit{ "IOSession.SendOverflow" };
+constinit LibCommons::LogRateLimit s_SendBufferWriteLogLimit{ "IOSession.SendBufferWrite" };
+constinit LibCommons::LogRateLimit s_RecvBufferFullLogLimit{ "IOSession.RecvBufferFull" };
+constinit LibCommons::LogRateLimit s_PostRecvFailedLogLimit{ "IOSession.PostRecvFailed" };
+constinit LibCommons::LogRateLimit s_PostSendFailedLogLimit{ "IOSession.PostSendFailed" };
+constinit LibCommons::LogRateLimit s_RecvFailedLogLimit{ "IOSession.RecvFailed" };
+constinit LibCommons::LogRateLimit s_SendFailedLogLimit{ "IOSession.SendFailed" };
+
 // Design Ref: session-idle-timeout §4.2 — steady_clock 기준 epoch-ms.
 // idle 비교의 기준 시간. wall clock 대신 steady_clock 사용으로 시스템 시각 변경 영향 없음.
 inline std::int64_t NowMs() noexcept
@@ -30,19 +51,33 @@ inline std::int64_t NowMs() noexcept
     return std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
 }
+
+// 송신율 추정용 steady_clock 기준 epoch-us.
+inline std::int64_t NowUs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 송신율(PPS) 재계산 주기.
+constexpr std::int64_t kSendRateWindowUs = 100'000;
+
+// 1회 송신에 싣는 공유 프레임 수 상한 (WSABUF 개수 제한).
+constexpr size_t kMaxSharedPacketsPerSend = 64;
+
+// watermark 비활성 세션에서 공유 프레임 대기열 상한.
+constexpr size_t kMaxSharedPendingBytes = 4 * 1024 * 1024;
 } // anonymous namespace
 
 
 IOSession::IOSession(const std::shared_ptr<Core::Socket>& pSocket,
     std::unique_ptr<LibCommons::Buffers::IBuffer> pReceiveBuffer,
-    std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer)
-    : m_pSocket(std::move(pSocket))
+    std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer,
+    Core::IIoBackend& rfBackend)
+    : m_pSocket(std::move(pSocket)), m_rfBackend(rfBackend)
 {
     m_pReceiveBuffer = std::move(pReceiveBuffer);
     m_pSendBuffer = std::move(pSendBuffer);
-
-    // Recv는 고정 크기 버퍼를 재사용.
-    m_RecvOverlapped.Buffers.resize(16 * 1024);
 }
 
 // # 소멸 시점 불변식 검증
@@ -54,17 +89,64 @@ IOSession::~IOSession()
 
     if (finalCount != 0)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession",
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory,
             "~IOSession() invariant violation. Session Id : {}, Outstanding : {}, DisconnectRequested : {}, OnDisconnectedFired : {}",
             GetSessionId(), finalCount, wasDisconnectRequested, wasOnDisconnectedFired);
         return;
     }
 
-    LibCommons::Logger::GetInstance().LogDebug("IOSession",
+    LibCommons::Logger::GetInstance().LogDebug(s_LogCategory,
         "~IOSession() Session Id : {}, DisconnectRequested : {}, OnDisconnectedFired : {}",
         GetSessionId(), wasDisconnectRequested, wasOnDisconnectedFired);
 }
 
+// # 세션 풀 재사용 초기화
+void IOSession::ResetForReuse(const std::shared_ptr<Core::Socket>& pSocket)
+{
+    const int outstanding = m_OutstandingIoCount.load(std::memory_order_acquire);
+    if (outstanding != 0)
+    {
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory,
+            "ResetForReuse() invariant violation. Session Id : {}, Outstanding : {}", GetSessionId(), outstanding);
+    }
+
+    m_ReceiveLoopStarted.store(false, std::memory_order_relaxed);
+    m_RecvInProgress.store(false, std::memory_order_relaxed);
+    m_SendInProgress.store(false, std::memory_order_relaxed);
+    m_CorkDepth.store(0, std::memory_order_relaxed);
+    m_bSendFlushDeferred.store(false, std::memory_order_relaxed);
+
+    m_SendRateWindowStartUs.store(0, std::memory_order_relaxed);
+    m_SendRateWindowCount.store(0, std::memory_order_relaxed);
+    m_SendRatePps.store(0, std::memory_order_relaxed);
+
+    m_LastRecvTimeMs.store(0, std::memory_order_relaxed);
+    m_TotalRxBytes.store(0, std::memory_order_relaxed);
+    m_TotalTxBytes.store(0, std::memory_order_relaxed);
+    m_SendWatermark.ResetToDefaults();
+
+    // 버퍼는 용량을 유지한 채 비운다 — 링 버퍼 재할당을 피하는 것이 풀의 목적.
+    m_pReceiveBuffer->Clear();
+    ClearSendQueue();
+    m_RecvReadBuffers.clear();
+    m_pPacketStrand.reset();
+
+    m_RecvOperation.ResetNative();
+    m_RecvOperation.Buffers.clear();
+    m_RecvOperation.RequestedBytes = 0;
+    m_RecvOperation.IsZeroByte = false;
+    m_SendOperation.ResetNative();
+    m_SendOperation.Buffers.clear();
+    m_SendOperation.RequestedBytes = 0;
+
+    m_pSocket = pSocket;
+    m_SessionId = m_NextSessionId.fetch_add(1, std::memory_order_relaxed);
+
+    // 종료 게이트는 마지막에 연다 — 이전 상태가 모두 정리된 뒤에만 새 세션으로 보인다.
+    m_bOnDisconnectedFired.store(false, std::memory_order_relaxed);
+    m_DisconnectRequested.store(false, std::memory_order_release);
+}
+
 // # 완료 통지 종료 게이트
 IOSession::IoCompletionGuard::~IoCompletionGuard() noexcept
 {
@@ -82,110 +164,273 @@ void IOSession::SendBuffer(std::span<const std::byte> data)
 {
     if (data.empty() || !m_pSendBuffer)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "SendBuffer() Invalid parameters. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "SendBuffer() Invalid parameters. Session Id : {}", GetSessionId());
 
         return;
     }
 
     if (m_DisconnectRequested.load(std::memory_order_acquire))
     {
-        LibCommons::Logger::GetInstance().LogDebug("IOSession",
+        LibCommons::Logger::GetInstance().LogDebug(s_LogCategory,
             "SendBuffer() skipped after disconnect request. Session Id : {}",
             GetSessionId());
         return;
     }
 
-    if (!m_pSendBuffer->Write(data))
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "SendBuffer() Failed to write data to send buffer. Session Id : {}, Data Length : {}", GetSessionId(), data.size());
+        std::lock_guard lock(m_SendOrderMutex);
+        if (!m_pSendBuffer->Write(data))
+        {
+            LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_SendBufferWriteLogLimit, "SendBuffer() Failed to write data to send buffer. Session Id : {}, Data Length : {}", GetSessionId(), data.size());
 
-        return;
+            return;
+        }
+        m_SendRingWritten += data.size();
     }
 
-    TryPostSendFromQueue();
+    UpdateSendRate();
+    UpdateSendBackpressure();
+    RequestSendFlush();
 }
 
-// 헬퍼 함수: 버퍼 조각들에 데이터를 씁니다.
-static void WriteToBuffers(const std::vector<std::span<std::byte>>& buffers, size_t& bufferIdx, size_t& offsetInSpan, const void* data, size_t size)
+// # 종료 이후 메시지 차단
+void IOSession::SendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage)
+{
+    EnqueueMessage(packetId, rfMessage, false);
+}
+
+// # watermark 초과 시 적재 거부
+SendResult IOSession::TrySendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage)
 {
-    const unsigned char* src = static_cast<const unsigned char*>(data);
-    size_t remaining = size;
+    return EnqueueMessage(packetId, rfMessage, true);
+}
 
-    while (remaining > 0 && bufferIdx < buffers.size())
+// # 송신 버퍼 직접 직렬화
+SendResult IOSession::EnqueueMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage, bool bTry)
+{
+    const size_t bodySize = rfMessage.ByteSizeLong();
+    const size_t totalSize = Core::Packet::GetHeaderSize() + Core::Packet::GetPacketIdSize() + bodySize;
+
+    if (m_DisconnectRequested.load(std::memory_order_acquire))
     {
-        std::span<std::byte> span = buffers[bufferIdx];
-        size_t spaceInSpan = span.size() - offsetInSpan;
-        size_t toCopy = remaining < spaceInSpan ? remaining : spaceInSpan;
+        LibCommons::Logger::GetInstance().LogDebug(s_LogCategory,
+            "SendMessage() skipped after disconnect request. Session Id : {}, Packet Id : {}",
+            GetSessionId(), packetId);
+        return SendResult::Disconnected;
+    }
 
+    if (bTry && m_SendWatermark.IsAboveHigh(GetPendingSendBytes()))
+    {
+        return SendResult::WouldBlock;
+    }
 
-        std::memcpy(span.data() + offsetInSpan, src, toCopy);
+    std::vector<std::span<std::byte>> buffers;
+    bool bAllocated = false;
+    bool bSerialized = false;
+    {
+        // 링버퍼에 직접 공간 예약 (실패 시 전송 불가). 예약과 누적 위치 갱신은 공유 프레임 적재와 직렬화.
+        // 예약 즉시 읽기 가능 크기가 늘어나므로 직렬화까지 같은 락 안에서 끝낸다 — 그렇지 않으면 송신 수집이
+        // 덜 쓰인 영역을 보내고, 그 완료가 SegmentedBuffer 청크를 반납해 직렬화 중인 메모리가 해제될 수 있다.
+        std::lock_guard lock(m_SendOrderMutex);
+        bAllocated = m_pSendBuffer->AllocateWrite(totalSize, buffers);
+        if (bAllocated)
+        {
+            m_SendRingWritten += totalSize;
 
-        src += toCopy;
-        remaining -= toCopy;
-        offsetInSpan += toCopy;
+            // 헤더 + Protobuf Body 를 예약 영역에 직접 직렬화 (Wrap 지점에서도 임시 버퍼 없음)
+            bSerialized = Core::SerializePacketToSpans(buffers, packetId, rfMessage, bodySize);
+        }
+    }
 
-        if (offsetInSpan == span.size())
+    if (!bAllocated)
+    {
+        if (bTry)
         {
-            bufferIdx++;
-            offsetInSpan = 0;
+            // 아무것도 쓰지 않았으므로 스트림은 온전하다 — 호출자에게 맡긴다.
+            return SendResult::Overflow;
         }
+
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_SendOverflowLogLimit, "SendMessage() Send buffer overflow. Session Id : {}, Packet Size : {}", GetSessionId(), totalSize);
+        RequestDisconnect(DisconnectReason::Backpressure);
+        return SendResult::Overflow;
+    }
+
+    if (!bSerialized)
+    {
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "SendMessage() Serialize failed. Session Id : {}, Packet Id : {}", GetSessionId(), packetId);
+        RequestDisconnect();
+        return SendResult::Failed;
     }
+
+    UpdateSendRate();
+    UpdateSendBackpressure();
+    RequestSendFlush();
+    return SendResult::Ok;
 }
 
-// # 종료 이후 메시지 차단
-void IOSession::SendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage)
+// # 공유 프레임 참조 적재
+SendResult IOSession::SendSharedPacket(const Core::SharedPacket& rfPacket)
 {
-    const size_t bodySize = rfMessage.ByteSizeLong();
-    const size_t totalSize = Core::Packet::GetHeaderSize() + Core::Packet::GetPacketIdSize() + bodySize;
+    if (!rfPacket.IsValid() || !m_pSendBuffer)
+    {
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "SendSharedPacket() Invalid parameters. Session Id : {}", GetSessionId());
+        return SendResult::Failed;
+    }
 
     if (m_DisconnectRequested.load(std::memory_order_acquire))
     {
-        LibCommons::Logger::GetInstance().LogDebug("IOSession",
-            "SendMessage() skipped after disconnect request. Session Id : {}, Packet Id : {}",
-            GetSessionId(), packetId);
+        return SendResult::Disconnected;
+    }
+
+    if (m_SendWatermark.IsAboveHigh(GetPendingSendBytes()))
+    {
+        return SendResult::WouldBlock;
+    }
+
+    if (m_SharedPendingBytes.load(std::memory_order_relaxed) + rfPacket.GetSize() > kMaxSharedPendingBytes)
+    {
+        return SendResult::Overflow;
+    }
+
+    {
+        std::lock_guard lock(m_SendOrderMutex);
+        m_SharedSendQueue.push_back(SharedSendEntry{ rfPacket, m_SendRingWritten, 0 });
+        m_SharedPendingBytes.fetch_add(rfPacket.GetSize(), std::memory_order_relaxed);
+    }
+
+    UpdateSendRate();
+    UpdateSendBackpressure();
+    RequestSendFlush();
+    return SendResult::Ok;
+}
+
+// # watermark 전이 시 훅 호출
+void IOSession::UpdateSendBackpressure()
+{
+    if (!m_pSendBuffer)
+    {
         return;
     }
 
-    std::vector<std::span<std::byte>> buffers;
-    // 링버퍼에 직접 공간 예약 (실패 시 전송 불가)
-    if (!m_pSendBuffer->AllocateWrite(totalSize, buffers))
+    // 적재량은 watermark 가 판단 직전에 다시 읽는다 — 호출 시점 값은 완료와 엇갈려 낡을 수 있다.
+    m_SendWatermark.Update(
+        [this]() { return GetPendingSendBytes(); },
+        [this](bool bBackpressured, size_t pendingBytes)
+        {
+            LibCommons::Logger::GetInstance().LogDebug(s_LogCategory,
+                "Send backpressure {}. Session Id : {}, Pending : {}",
+                bBackpressured ? "on" : "off", GetSessionId(), pendingBytes);
+            OnSendBackpressure(bBackpressured);
+        });
+}
+
+// # 송신 corking
+void IOSession::Cork()
+{
+    m_CorkDepth.fetch_add(1, std::memory_order_acq_rel);
+}
+
+// # 마지막 Uncork 시 누적분 flush
+void IOSession::Uncork()
+{
+    const int previousDepth = m_CorkDepth.fetch_sub(1, std::memory_order_acq_rel);
+    if (previousDepth <= 0)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "SendMessage() Send buffer overflow. Session Id : {}, Packet Size : {}", GetSessionId(), totalSize);
-        RequestDisconnect();
+        m_CorkDepth.fetch_add(1, std::memory_order_acq_rel);
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory,
+            "Uncork() underflow. Session Id : {}, Previous : {}",
+            GetSessionId(), previousDepth);
         return;
     }
 
-    // 헤더 및 패킷 ID 직렬화 (네트워크 바이트 오더)
-    uint16_t sizeNet = htons(static_cast<uint16_t>(totalSize));
-    uint16_t idNet = htons(packetId);
+    if (previousDepth == 1)
+    {
+        RequestSendFlush();
+    }
+}
 
-    size_t bufferIdx = 0;
-    size_t offsetInSpan = 0;
+// # 워커 배치 종료 시 지연 flush
+void IOSession::FlushDeferredSend()
+{
+    m_bSendFlushDeferred.store(false);
 
-    WriteToBuffers(buffers, bufferIdx, offsetInSpan, &sizeNet, sizeof(sizeNet));
-    WriteToBuffers(buffers, bufferIdx, offsetInSpan, &idNet, sizeof(idNet));
+    if (m_CorkDepth.load(std::memory_order_acquire) > 0)
+    {
+        // 다시 cork 된 상태 — 마지막 Uncork 가 flush 한다.
+        return;
+    }
 
-    // Protobuf Body 직렬화
-    if (bodySize > 0)
+    if (GetPendingSendBytes() > 0)
     {
-        // 최적화: 버퍼가 1개이고 공간이 충분하면 SerializeToArray 사용 (가장 빠름)
-        if (bufferIdx < buffers.size() && buffers[bufferIdx].size() - offsetInSpan >= bodySize)
+        TryPostSendFromQueue();
+    }
+}
+
+// # 송신 flush 정책 (cork → adaptive 지연 → 즉시 post)
+void IOSession::RequestSendFlush()
+{
+    if (m_CorkDepth.load(std::memory_order_acquire) > 0)
+    {
+        return;
+    }
+
+    if (GetPendingSendBytes() == 0)
+    {
+        return;
+    }
+
+    // Adaptive: 송신 중이 아니고 송신율이 임계 이상이면 워커의 완료 배치 종료까지 flush 지연.
+    // 이미 송신 중이면 완료 시점에 누적분이 함께 나가므로 지연할 필요 없음.
+    const std::int64_t delayUs = m_AdaptiveFlushDelayUs.load(std::memory_order_relaxed);
+    if (delayUs > 0
+        && !m_SendInProgress.load(std::memory_order_acquire)
+        && m_SendRatePps.load(std::memory_order_relaxed) >= m_AdaptiveFlushPpsThreshold.load(std::memory_order_relaxed))
+    {
+        // 이미 다른 워커 배치에 등록됨 — 그 배치가 누적분까지 flush.
+        if (m_bSendFlushDeferred.exchange(true))
         {
-            rfMessage.SerializeToArray(buffers[bufferIdx].data() + offsetInSpan, static_cast<int>(bodySize));
+            return;
         }
-        else
+
+        const auto deadline = Core::SendFlushBatch::Clock::now() + std::chrono::microseconds(delayUs);
+        if (Core::SendFlushBatch::Defer(weak_from_this().lock(), deadline))
         {
-            // 버퍼가 쪼개져 있거나(Wrap around), 공간이 부족한 경우
-            std::string temp; // Fallback
-            rfMessage.SerializeToString(&temp);
-            WriteToBuffers(buffers, bufferIdx, offsetInSpan, temp.data(), temp.size());
+            return;
         }
-    }
 
+        // 워커 스레드가 아니거나 shared 소유가 아님 — 즉시 flush.
+        m_bSendFlushDeferred.store(false);
+    }
 
     TryPostSendFromQueue();
 }
 
+// # 송신 메시지율 갱신
+void IOSession::UpdateSendRate() noexcept
+{
+    if (m_AdaptiveFlushDelayUs.load(std::memory_order_relaxed) <= 0)
+    {
+        return;
+    }
+
+    m_SendRateWindowCount.fetch_add(1, std::memory_order_relaxed);
+
+    const std::int64_t nowUs = NowUs();
+    std::int64_t windowStartUs = m_SendRateWindowStartUs.load(std::memory_order_relaxed);
+    const std::int64_t elapsedUs = nowUs - windowStartUs;
+    if (elapsedUs < kSendRateWindowUs)
+    {
+        return;
+    }
+
+    // 윈도우 교체는 한 스레드만 수행.
+    if (m_SendRateWindowStartUs.compare_exchange_strong(windowStartUs, nowUs, std::memory_order_relaxed))
+    {
+        const std::uint64_t count = m_SendRateWindowCount.exchange(0, std::memory_order_relaxed);
+        m_SendRatePps.store(static_cast<std::uint32_t>(count * 1'000'000 / static_cast<std::uint64_t>(elapsedUs)), std::memory_order_relaxed);
+    }
+}
+
 // # 최초 수신 루프 개시
 void IOSession::StartReceiveLoop()
 {
@@ -218,7 +463,7 @@ void IOSession::RequestReceived()
         return;
     }
 
-    // 비동기 0바이트 수신(WSARecv) 등록.
+    // 비동기 0바이트 수신 등록.
     if (!RequestRecv(true))
     {
         m_RecvInProgress.store(false);
@@ -229,42 +474,31 @@ void IOSession::RequestReceived()
 // # 수신 posting 준비
 bool IOSession::PrepareRecvBuffers(bool bZeroByte)
 {
-    m_RecvOverlapped.ResetOverlapped();
-    m_RecvOverlapped.IsZeroByte = bZeroByte;
-    m_RecvOverlapped.WSABufs.clear();
+    m_RecvOperation.ResetNative();
+    m_RecvOperation.IsZeroByte = bZeroByte;
+    m_RecvOperation.Buffers.clear();
 
     if (bZeroByte)
     {
-        WSABUF wsaBuf{};
-        wsaBuf.buf = nullptr;
-        wsaBuf.len = 0;
-        m_RecvOverlapped.WSABufs.push_back(wsaBuf);
+        // 버퍼 없는 요청 = zero-byte 수신 (readiness 대기)
+        m_RecvOperation.RequestedBytes = 0;
         return true;
     }
 
-    std::vector<std::span<std::byte>> buffers;
     size_t writableSize = 0;
     if (m_pReceiveBuffer)
     {
-        writableSize = m_pReceiveBuffer->GetWriteableBuffers(buffers);
+        writableSize = m_pReceiveBuffer->GetWriteableBuffers(m_RecvOperation.Buffers);
     }
 
     if (writableSize == 0)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "PostRecvImpl(Real) Receive buffer full. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_RecvBufferFullLogLimit, "PostRecvImpl(Real) Receive buffer full. Session Id : {}", GetSessionId());
         RequestDisconnect();
         return false;
     }
 
-    m_RecvOverlapped.WSABufs.reserve(buffers.size());
-    for (const auto& span : buffers)
-    {
-        WSABUF wsaBuf{};
-        wsaBuf.buf = reinterpret_cast<char*>(span.data());
-        wsaBuf.len = static_cast<ULONG>(span.size());
-        m_RecvOverlapped.WSABufs.push_back(wsaBuf);
-    }
-
+    m_RecvOperation.RequestedBytes = writableSize;
     return true;
 }
 
@@ -278,32 +512,18 @@ bool IOSession::RequestRecv(bool bZeroByte)
 
     if (!m_pSocket)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "RequestRecv() Socket is null. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "RequestRecv() Socket is null. Session Id : {}", GetSessionId());
         return false;
     }
 
     m_OutstandingIoCount.fetch_add(1, std::memory_order_acq_rel);
 
-    DWORD flags = 0;
-    DWORD bytes = 0;
-
-    int result = ::WSARecv(m_pSocket->GetSocket(),
-        m_RecvOverlapped.WSABufs.data(),
-        static_cast<DWORD>(m_RecvOverlapped.WSABufs.size()),
-        &bytes,
-        &flags,
-        &m_RecvOverlapped.Overlapped,
-        nullptr);
-
-    if (result == SOCKET_ERROR)
+    int errorCode = 0;
+    if (!m_rfBackend.PostRecv(*m_pSocket, m_RecvOperation, errorCode))
     {
-        int err = ::WSAGetLastError();
-        if (err != WSA_IO_PENDING)
-        {
-            LibCommons::Logger::GetInstance().LogError("IOSession", "RequestRecv() WSARecv failed. Session Id : {}, Error Code : {}, ZeroByte : {}", GetSessionId(), err, bZeroByte);
-            UndoOutstandingOnFailure("RequestRecv");
-            return false;
-        }
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_PostRecvFailedLogLimit, "RequestRecv() PostRecv failed. Session Id : {}, Error Code : {}, ZeroByte : {}", GetSessionId(), errorCode, bZeroByte);
+        UndoOutstandingOnFailure("RequestRecv");
+        return false;
     }
 
     return true;
@@ -312,18 +532,15 @@ bool IOSession::RequestRecv(bool bZeroByte)
 // # 송신 posting 준비
 void IOSession::PrepareSendBuffers(const std::vector<std::span<const std::byte>>& buffers, size_t bytesToSend)
 {
-    m_SendOverlapped.RequestedBytes = bytesToSend;
-    m_SendOverlapped.ResetOverlapped();
+    m_SendOperation.RequestedBytes = bytesToSend;
+    m_SendOperation.ResetNative();
 
-    // WSABUF 배열 구성
-    m_SendOverlapped.WSABufs.clear();
-    m_SendOverlapped.WSABufs.reserve(buffers.size());
+    // 송신 버퍼 segment 구성 (백엔드가 WSABUF / iovec 로 변환, 데이터는 읽기 전용으로만 사용)
+    m_SendOperation.Buffers.clear();
+    m_SendOperation.Buffers.reserve(buffers.size());
     for (const auto& span : buffers)
     {
-        WSABUF wsaBuf{};
-        wsaBuf.buf = const_cast<char*>(reinterpret_cast<const char*>(span.data()));
-        wsaBuf.len = static_cast<ULONG>(span.size());
-        m_SendOverlapped.WSABufs.push_back(wsaBuf);
+        m_SendOperation.Buffers.emplace_back(const_cast<std::byte*>(span.data()), span.size());
     }
 }
 
@@ -349,7 +566,11 @@ bool IOSession::TryPostSendFromQueue()
     }
 
     std::vector<std::span<const std::byte>> buffers;
-    const size_t bytesToSend = m_pSendBuffer->GetReadBuffers(buffers);
+    size_t bytesToSend = 0;
+    {
+        std::lock_guard lock(m_SendOrderMutex);
+        bytesToSend = CollectSendBuffersUnlocked(buffers);
+    }
 
     if (bytesToSend == 0)
     {
@@ -361,40 +582,146 @@ bool IOSession::TryPostSendFromQueue()
 
     if (!m_pSocket)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "TryPostSendFromQueue() Socket is null. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "TryPostSendFromQueue() Socket is null. Session Id : {}", GetSessionId());
         m_SendInProgress.store(false);
         return false;
     }
 
     m_OutstandingIoCount.fetch_add(1, std::memory_order_acq_rel);
 
-    DWORD bytesSent = 0;
-    int result = ::WSASend(m_pSocket->GetSocket(),
-        m_SendOverlapped.WSABufs.data(),
-        static_cast<DWORD>(m_SendOverlapped.WSABufs.size()),
-        &bytesSent,
-        0,
-        &m_SendOverlapped.Overlapped,
-        nullptr);
+    int errorCode = 0;
+    if (!m_rfBackend.PostSend(*m_pSocket, m_SendOperation, errorCode))
+    {
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_PostSendFailedLogLimit, "TryPostSendFromQueue() PostSend failed. Session Id : {}, Error Code : {}", GetSessionId(), errorCode);
 
-    if (result == SOCKET_ERROR)
+        UndoOutstandingOnFailure("TryPostSendFromQueue");
+        m_SendInProgress.store(false);
+        return false;
+    }
+
+    return true;
+}
+
+// # 송신 버퍼 + 공유 프레임 gather 구성
+size_t IOSession::CollectSendBuffersUnlocked(std::vector<std::span<const std::byte>>& rfOutBuffers)
+{
+    if (m_SharedSendQueue.empty())
     {
-        int err = ::WSAGetLastError();
-        if (err != WSA_IO_PENDING)
+        return m_pSendBuffer->GetReadBuffers(rfOutBuffers);
+    }
+
+    std::vector<std::span<const std::byte>> ringBuffers;
+    m_pSendBuffer->GetReadBuffers(ringBuffers);
+
+    rfOutBuffers.clear();
+    size_t totalBytes = 0;
+    size_t spanIndex = 0;
+    size_t spanOffset = 0;
+    std::uint64_t position = m_SendRingConsumed;
+
+    // 송신 버퍼 데이터를 누적 위치 limit 까지 잘라 붙인다.
+    auto appendRingUntil = [&](std::uint64_t limit)
+    {
+        while (position < limit && spanIndex < ringBuffers.size())
         {
-            LibCommons::Logger::GetInstance().LogError("IOSession", "TryPostSendFromQueue() WSASend failed. Session Id : {}, Error Code : {}", GetSessionId(), err);
+            const auto& rfSpan = ringBuffers[spanIndex];
+            const size_t part = static_cast<size_t>((std::min)(static_cast<std::uint64_t>(rfSpan.size() - spanOffset), limit - position));
+            if (part > 0)
+            {
+                rfOutBuffers.push_back(rfSpan.subspan(spanOffset, part));
+            }
+            spanOffset += part;
+            position += part;
+            totalBytes += part;
+            if (spanOffset == rfSpan.size())
+            {
+                ++spanIndex;
+                spanOffset = 0;
+            }
+        }
+    };
 
-            UndoOutstandingOnFailure("TryPostSendFromQueue");
-            m_SendInProgress.store(false);
-            return false;
+    size_t sharedCount = 0;
+    for (const auto& rfEntry : m_SharedSendQueue)
+    {
+        appendRingUntil(rfEntry.RingMark);
+        if (sharedCount == kMaxSharedPacketsPerSend)
+        {
+            // 나머지는 이번 송신 완료 후 이어서.
+            return totalBytes;
         }
+
+        const auto remaining = rfEntry.Packet.GetBytes().subspan(rfEntry.Offset);
+        rfOutBuffers.push_back(remaining);
+        totalBytes += remaining.size();
+        ++sharedCount;
     }
 
-    return true;
+    appendRingUntil((std::numeric_limits<std::uint64_t>::max)());
+    return totalBytes;
+}
+
+// # 송신 완료분 순서대로 소비
+void IOSession::ConsumeSentBytes(size_t bytesTransferred)
+{
+    if (!m_pSendBuffer)
+    {
+        return;
+    }
+
+    std::lock_guard lock(m_SendOrderMutex);
+    while (bytesTransferred > 0)
+    {
+        if (!m_SharedSendQueue.empty() && m_SharedSendQueue.front().RingMark == m_SendRingConsumed)
+        {
+            auto& rfFront = m_SharedSendQueue.front();
+            const size_t part = (std::min)(bytesTransferred, rfFront.Packet.GetSize() - rfFront.Offset);
+            rfFront.Offset += part;
+            bytesTransferred -= part;
+            m_SharedPendingBytes.fetch_sub(part, std::memory_order_relaxed);
+
+            if (rfFront.Offset == rfFront.Packet.GetSize())
+            {
+                // 다 보낸 공유 프레임 참조 해제.
+                m_SharedSendQueue.pop_front();
+            }
+            continue;
+        }
+
+        size_t part = (std::min)(bytesTransferred, m_pSendBuffer->CanReadSize());
+        if (!m_SharedSendQueue.empty())
+        {
+            part = static_cast<size_t>((std::min)(static_cast<std::uint64_t>(part), m_SharedSendQueue.front().RingMark - m_SendRingConsumed));
+        }
+
+        if (part == 0)
+        {
+            break;
+        }
+
+        // 전송 완료된 만큼 버퍼 비우기 (Delayed Consume)
+        m_pSendBuffer->Consume(part);
+        m_SendRingConsumed += part;
+        bytesTransferred -= part;
+    }
+}
+
+// # 송신 대기열 초기화
+void IOSession::ClearSendQueue()
+{
+    std::lock_guard lock(m_SendOrderMutex);
+    if (m_pSendBuffer)
+    {
+        m_pSendBuffer->Clear();
+    }
+    m_SharedSendQueue.clear();
+    m_SendRingWritten = 0;
+    m_SendRingConsumed = 0;
+    m_SharedPendingBytes.store(0, std::memory_order_relaxed);
 }
 
 // # 제로바이트 수신 전환
-void IOSession::HandleZeroByteRecvCompletion(DWORD bytesTransferred)
+void IOSession::HandleZeroByteRecvCompletion(size_t bytesTransferred)
 {
     if (bytesTransferred == 0)
     {
@@ -410,12 +737,12 @@ void IOSession::HandleZeroByteRecvCompletion(DWORD bytesTransferred)
 }
 
 // # 실제 수신 후속 처리
-void IOSession::HandleRealRecvCompletion(DWORD bytesTransferred)
+void IOSession::HandleRealRecvCompletion(size_t bytesTransferred)
 {
     if (bytesTransferred == 0)
     {
         m_RecvInProgress.store(false);
-        LibCommons::Logger::GetInstance().LogInfo("IOSession", "OnIOCompleted() Recv 0 byte (Real). Disconnected. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogInfo(s_LogCategory, "OnIOCompleted() Recv 0 byte (Real). Disconnected. Session Id : {}", GetSessionId());
         RequestDisconnect();
         return;
     }
@@ -423,7 +750,7 @@ void IOSession::HandleRealRecvCompletion(DWORD bytesTransferred)
     // Zero-Copy Recv Commit
     if (!m_pReceiveBuffer->CommitWrite(bytesTransferred))
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "OnIOCompleted() CommitWrite failed (Overflow?). Session Id : {}, Bytes : {}", GetSessionId(), bytesTransferred);
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "OnIOCompleted() CommitWrite failed (Overflow?). Session Id : {}, Bytes : {}", GetSessionId(), bytesTransferred);
         m_RecvInProgress.store(false);
         RequestDisconnect();
         return;
@@ -439,7 +766,7 @@ void IOSession::HandleRealRecvCompletion(DWORD bytesTransferred)
     // # 멱등성 및 Rule D1 준수: 종료 요청 상태라면 상위 레이어로 패킷을 배달하지 않는다.
     if (m_DisconnectRequested.load(std::memory_order_acquire))
     {
-        LibCommons::Logger::GetInstance().LogDebug("IOSession",
+        LibCommons::Logger::GetInstance().LogDebug(s_LogCategory,
             "HandleRealRecvCompletion() dropping data dispatch due to disconnect request. Session Id : {}",
             GetSessionId());
         m_RecvInProgress.store(false);
@@ -453,42 +780,41 @@ void IOSession::HandleRealRecvCompletion(DWORD bytesTransferred)
 }
 
 // # 수신 완료 분기
-void IOSession::HandleRecvCompletion(bool bSuccess, DWORD bytesTransferred)
+void IOSession::HandleRecvCompletion(const Core::IoCompletion& rfCompletion)
 {
-    if (!bSuccess)
+    if (!rfCompletion.bSuccess)
     {
         m_RecvInProgress.store(false);
-        LibCommons::Logger::GetInstance().LogInfo("IOSession", "OnIOCompleted() Recv failed. Session Id : {}, Error Code : {}", GetSessionId(), GetLastError());
+        LibCommons::Logger::GetInstance().LogInfo(s_LogCategory, s_RecvFailedLogLimit, "OnIOCompleted() Recv failed. Session Id : {}, Error Code : {}", GetSessionId(), rfCompletion.ErrorCode);
         RequestDisconnect();
         return;
     }
 
-    if (m_RecvOverlapped.IsZeroByte)
+    if (m_RecvOperation.IsZeroByte)
     {
-        HandleZeroByteRecvCompletion(bytesTransferred);
+        HandleZeroByteRecvCompletion(rfCompletion.BytesTransferred);
         return;
     }
 
-    HandleRealRecvCompletion(bytesTransferred);
+    HandleRealRecvCompletion(rfCompletion.BytesTransferred);
 }
 
 // # 송신 완료 후속 처리
-void IOSession::HandleSendCompletion(bool bSuccess, DWORD bytesTransferred)
+void IOSession::HandleSendCompletion(const Core::IoCompletion& rfCompletion)
 {
     m_SendInProgress.store(false);
 
-    if (!bSuccess)
+    if (!rfCompletion.bSuccess)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession", "OnIOCompleted() Send failed. Session Id : {}, Error Code : {}", GetSessionId(), GetLastError());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_SendFailedLogLimit, "OnIOCompleted() Send failed. Session Id : {}, Error Code : {}", GetSessionId(), rfCompletion.ErrorCode);
         RequestDisconnect();
         return;
     }
 
-    // 전송 완료된 만큼 버퍼 비우기 (Delayed Consume)
-    if (m_pSendBuffer)
-    {
-        m_pSendBuffer->Consume(bytesTransferred);
-    }
+    const size_t bytesTransferred = rfCompletion.BytesTransferred;
+
+    // 전송 완료된 만큼 송신 버퍼 / 공유 프레임 소비
+    ConsumeSentBytes(bytesTransferred);
 
     // Design Ref: server-status §3.3 — 누적 송신 바이트.
     m_TotalTxBytes.fetch_add(bytesTransferred, std::memory_order_relaxed);
@@ -496,25 +822,27 @@ void IOSession::HandleSendCompletion(bool bSuccess, DWORD bytesTransferred)
     // # 종료 요청 이후 상위 송신 콜백 차단
     if (m_DisconnectRequested.load(std::memory_order_acquire))
     {
-        LibCommons::Logger::GetInstance().LogDebug("IOSession",
+        LibCommons::Logger::GetInstance().LogDebug(s_LogCategory,
             "HandleSendCompletion() skipping OnSent due to disconnect request. Session Id : {}",
             GetSessionId());
         return;
     }
 
+    UpdateSendBackpressure();
     OnSent(bytesTransferred);
 
-    const bool hasPending = m_pSendBuffer && (m_pSendBuffer->CanReadSize() > 0);
+    const bool hasPending = GetPendingSendBytes() > 0;
     if (hasPending && !m_DisconnectRequested.load(std::memory_order_acquire))
     {
-        TryPostSendFromQueue();
+        // cork 중이면 Uncork 가 flush 한다.
+        RequestSendFlush();
     }
 }
 
 // # 완료 통지 수명 보호
-void IOSession::OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped)
+void IOSession::OnIOCompleted(const Core::IoCompletion& rfCompletion)
 {
-    if (!pOverlapped)
+    if (!rfCompletion.pOperation)
     {
         return;
     }
@@ -523,46 +851,54 @@ void IOSession::OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED*
 
     IoCompletionGuard guard(pIOSession);
 
-    // 멤버 Overlapped 주소로 구분
-    if (pOverlapped == &(m_RecvOverlapped.Overlapped))
+    // 멤버 요청 기술자 주소로 구분
+    if (rfCompletion.pOperation == &m_RecvOperation)
     {
-        HandleRecvCompletion(bSuccess, bytesTransferred);
+        HandleRecvCompletion(rfCompletion);
         return;
     }
 
-    if (pOverlapped == &(m_SendOverlapped.Overlapped))
+    if (rfCompletion.pOperation == &m_SendOperation)
     {
-        HandleSendCompletion(bSuccess, bytesTransferred);
+        HandleSendCompletion(rfCompletion);
         return;
     }
 
-    LibCommons::Logger::GetInstance().LogError("IOSession",
-        "OnIOCompleted() Unknown OVERLAPPED. Session Id : {}",
+    LibCommons::Logger::GetInstance().LogError(s_LogCategory,
+        "OnIOCompleted() Unknown operation. Session Id : {}",
         GetSessionId());
 }
 
 // # 수신 버퍼 프레이밍 처리
+// 수신 링버퍼를 복사 없이 PacketView 로 분리해 전달하고, 핸들러 반환 후 프레임 단위로 Consume.
 void IOSession::ReadReceivedBuffers()
 {
-    if (!m_pReceiveBuffer)
+    if (!m_pReceiveBuffer || m_pReceiveBuffer->CanReadSize() == 0)
     {
         return;
     }
 
     auto& logger = LibCommons::Logger::GetInstance();
 
+    // 배치 내 핸들러들의 응답을 모아 dispatch 종료 시 1회 flush.
+    SendBatch sendBatch(*this);
+
+    // 스냅샷 이후 추가 수신은 free 영역에만 기록되므로 segment 는 Consume 전까지 유효.
+    m_pReceiveBuffer->GetReadBuffers(m_RecvReadBuffers);
+
+    size_t offset = 0;
     while (true)
     {
         // # 종료 요청 이후 추가 프레임 처리 차단
         if (m_DisconnectRequested.load(std::memory_order_acquire))
         {
-            logger.LogDebug("IOSession",
+            logger.LogDebug(s_LogCategory,
                 "ReadReceivedBuffers() stopping due to disconnect request. Session Id : {}",
                 GetSessionId());
             break;
         }
 
-        auto frame = Core::PacketFramer::TryFrameFromBuffer(*m_pReceiveBuffer);
+        auto frame = Core::PacketFramer::TryFrameView(m_RecvReadBuffers, offset);
         if (frame.Result == Core::PacketFrameResult::NeedMore)
         {
             break;
@@ -570,14 +906,14 @@ void IOSession::ReadReceivedBuffers()
 
         if (frame.Result == Core::PacketFrameResult::Invalid)
         {
-            logger.LogError("IOSession", "ReadReceivedBuffers() Invalid packet frame. Session Id : {}", GetSessionId());
+            logger.LogError(s_LogCategory, "ReadReceivedBuffers() Invalid packet frame. Session Id : {}", GetSessionId());
             RequestDisconnect();
             break;
         }
 
-        if (!frame.PacketOpt.has_value())
+        if (!frame.ViewOpt.has_value())
         {
-            logger.LogError("IOSession", "ReadReceivedBuffers() Packet frame ok but packet missing. Session Id : {}", GetSessionId());
+            logger.LogError(s_LogCategory, "ReadReceivedBuffers() Packet frame ok but packet missing. Session Id : {}", GetSessionId());
             RequestDisconnect();
             break;
         }
@@ -585,14 +921,51 @@ void IOSession::ReadReceivedBuffers()
         // # 종료 요청 이후 패킷 콜백 차단
         if (m_DisconnectRequested.load(std::memory_order_acquire))
         {
-            logger.LogDebug("IOSession",
+            logger.LogDebug(s_LogCategory,
                 "ReadReceivedBuffers() dropping packet dispatch due to disconnect request. Session Id : {}",
                 GetSessionId());
             break;
         }
 
-        OnPacketReceived(*frame.PacketOpt);
+        if (m_pPacketStrand)
+        {
+            PostPacketToStrand(*frame.ViewOpt);
+        }
+        else
+        {
+            OnPacketViewReceived(*frame.ViewOpt);
+        }
+
+        // # 핸들러 반환 후 프레임 해제 (뷰 수명 종료)
+        m_pReceiveBuffer->Consume(frame.FrameSize);
+        offset += frame.FrameSize;
     }
+
+    m_RecvReadBuffers.clear();
+}
+
+// # strand 로 패킷 처리 위임
+// 뷰는 Consume 과 함께 무효가 되므로 소유 Packet 으로 복사해 넘긴다. guard 가 outstanding I/O 를 잡고 있어
+// 대기 중인 패킷이 모두 처리 (또는 폐기) 되기 전에는 OnDisconnected / 세션 풀 반환이 일어나지 않는다.
+void IOSession::PostPacketToStrand(const Core::PacketView& rfView)
+{
+    auto pSelf = shared_from_this();
+
+    AddOutstandingIo();
+    auto pGuard = std::make_unique<IoCompletionGuard>(pSelf);
+
+    m_pPacketStrand->Post([pGuard = std::move(pGuard), packet = rfView.ToOwned()]()
+        {
+            IOSession& rfSession = *pGuard->Self;
+
+            // # 종료 요청 이후 대기 중이던 패킷 콜백 차단
+            if (rfSession.m_DisconnectRequested.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            rfSession.OnPacketViewReceived(Core::PacketView::FromPacket(packet));
+        });
 }
 
 // Design Ref: session-idle-timeout §4.2 — 기존 호출자(8곳) 호환을 위한 무인자 버전.
@@ -619,34 +992,34 @@ void IOSession::RequestDisconnect(DisconnectReason reason)
         {
             const std::int64_t lastMs = m_LastRecvTimeMs.load(std::memory_order_relaxed);
             const std::int64_t idleMs = (lastMs > 0) ? (NowMs() - lastMs) : -1;
-            logger.LogInfo("IOSession",
+            logger.LogInfo(s_LogCategory,
                 "IdleTimeout detected. Session Id : {}, IdleMs : {}",
                 GetSessionId(), idleMs);
         }
 
         if (!m_pSocket)
         {
-            logger.LogWarning("IOSession",
+            logger.LogWarning(s_LogCategory,
                 "RequestDisconnect() Socket is null. Session Id : {}, Reason : {}",
                 GetSessionId(), static_cast<int>(reason));
         }
         else
         {
-            m_pSocket->Shutdown(SD_BOTH);
+            m_pSocket->Shutdown();
             m_pSocket->Close();
         }
 
         m_RecvInProgress.store(false);
         m_SendInProgress.store(false);
 
-        logger.LogInfo("IOSession",
+        logger.LogInfo(s_LogCategory,
             "RequestDisconnect() initiated. Session Id : {}, Reason : {}, Outstanding : {}",
             GetSessionId(), static_cast<int>(reason),
             m_OutstandingIoCount.load(std::memory_order_acquire));
     }
     else
     {
-        logger.LogDebug("IOSession",
+        logger.LogDebug(s_LogCategory,
             "RequestDisconnect() idempotent skip. Session Id : {}, Reason : {}",
             GetSessionId(), static_cast<int>(reason));
     }
@@ -670,7 +1043,7 @@ void IOSession::TryFireOnDisconnected()
     }
 
     auto& logger = LibCommons::Logger::GetInstance();
-    logger.LogInfo("IOSession",
+    logger.LogInfo(s_LogCategory,
         "TryFireOnDisconnected() firing. Session Id : {}",
         GetSessionId());
 
@@ -679,10 +1052,8 @@ void IOSession::TryFireOnDisconnected()
         m_pReceiveBuffer->Clear();
     }
 
-    if (m_pSendBuffer)
-    {
-        m_pSendBuffer->Clear();
-    }
+    // outstanding Send 가 없으므로 공유 프레임 참조도 여기서 놓는다.
+    ClearSendQueue();
 
     OnDisconnected();
 }
@@ -693,7 +1064,7 @@ void IOSession::UndoOutstandingOnFailure(const char* site) noexcept
     const int previousCount = m_OutstandingIoCount.fetch_sub(1, std::memory_order_acq_rel);
     if (previousCount <= 0)
     {
-        LibCommons::Logger::GetInstance().LogError("IOSession",
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory,
             "UndoOutstandingOnFailure() underflow. Session Id : {}, Site : {}, Previous : {}",
             GetSessionId(), site, previousCount);
     }
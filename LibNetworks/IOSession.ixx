@@ -1,11 +1,13 @@
 ﻿module;
 
-#include <WinSock2.h>
 #include <memory>
 #include <vector>
 #include <atomic>
 #include <span>
 #include <cstdint>
+#include <chrono>
+#include <deque>
+#include <mutex>
 #include <google/protobuf/message.h>
 
 export module networks.sessions.io_session;
@@ -14,10 +16,16 @@ import networks.sessions.inetwork_session;
 import networks.sessions.iidle_aware;
 import networks.sessions.isession_stats;
 import networks.core.io_consumer;
+import networks.core.io_operation;
+import networks.core.io_backend;
 import networks.core.socket;
 import networks.core.packet;
+import networks.core.packet_view;
 import networks.core.packet_framer;
+import networks.core.send_flush_batch;
+import networks.core.shared_packet;
 import commons.buffers.ibuffer;
+import commons.strand;
 
 namespace LibNetworks::Sessions
 {
@@ -29,6 +37,7 @@ export class IOSession : public Core::IIOConsumer,
                           public INetworkSession,
                           public IIdleAware,
                           public ISessionStats,
+                          public Core::IDeferredSendFlush,
                           public std::enable_shared_from_this<IOSession>
 {
 public:
@@ -37,9 +46,11 @@ public:
     IOSession& operator=(const IOSession&) = delete;
 
     // 소켓/송수신 버퍼 의존성 주입 기반 세션 초기화.
+    // rfBackend 는 송수신 posting 백엔드 (기본: 플랫폼 백엔드, Windows 는 IOCP).
     explicit IOSession(const std::shared_ptr<Core::Socket>& pSocket,
         std::unique_ptr<LibCommons::Buffers::IBuffer> pReceiveBuffer,
-        std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer);
+        std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer,
+        Core::IIoBackend& rfBackend = Core::GetPlatformIoBackend());
 
     // # 소멸 시점 불변식 검증
     virtual ~IOSession() override;
@@ -54,8 +65,48 @@ public:
 
     virtual void SendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage) override;
 
-    // (Outbound 전용) ConnectEx용 OVERLAPPED 포인터 반환
-    virtual OVERLAPPED* GetConnectOverlappedPtr() override { return nullptr; }
+    // 송신 버퍼 적재량이 high watermark 이상이면 WouldBlock, 버퍼 한도 초과면 Overflow (둘 다 세션 유지).
+    SendResult TrySendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage) override;
+
+    // 공유 프레임을 복사 없이 송신 대기열에 참조로 건다. 송신 버퍼 데이터와 적재 순서대로
+    // gather-send 되고, 송신 완료 시 참조를 놓는다.
+    SendResult SendSharedPacket(const Core::SharedPacket& rfPacket) override;
+
+    // 송신 대기 바이트 (송신 버퍼 + 공유 프레임 미송신분). watermark 판단 기준.
+    size_t GetPendingSendBytes() const noexcept
+    {
+        const size_t ringBytes = m_pSendBuffer ? m_pSendBuffer->CanReadSize() : 0;
+        return ringBytes + m_SharedPendingBytes.load(std::memory_order_relaxed);
+    }
+
+    // 세션 생성/재사용 시 SendWatermark::SetDefaults 값으로 초기화된다.
+    void SetSendWatermarks(std::size_t lowBytes, std::size_t highBytes) override { m_SendWatermark.Set(lowBytes, highBytes); }
+    bool IsSendBackpressured() const override { return m_SendWatermark.IsBackpressured(); }
+
+    // 송신 corking — Cork 중 SendMessage 는 송신 버퍼에만 누적, 마지막 Uncork 시 1회 flush.
+    // 수신 배치 dispatch(ReadReceivedBuffers) 중에는 자동으로 cork 된다.
+    void Cork() override;
+    void Uncork() override;
+
+    // IDeferredSendFlush 구현 — 워커 스레드의 완료 배치 종료/deadline 시점에 호출.
+    void FlushDeferredSend() override;
+
+    // 수신 패킷 처리를 strand 로 넘긴다. nullptr 이면 (기본) I/O 완료 스레드에서 바로 처리.
+    // 설정하면 프레임마다 소유 Packet 으로 복사해 Post 하고, strand 위에서 OnPacketViewReceived 가 불린다.
+    // 세션마다 strand 를 두면 세션 순서를 지키며 I/O 워커를 비우고, 여러 세션이 하나를 공유하면 (방) 함께 직렬화된다.
+    // 수신 루프 시작 전에 설정한다. 처리 대기 중인 패킷은 outstanding I/O 로 세므로
+    // 모두 끝난 뒤에 OnDisconnected 가 (strand 스레드에서) 불릴 수 있다. ResetForReuse 에서 해제된다.
+    void SetPacketStrand(std::shared_ptr<LibCommons::Strand> pStrand) noexcept { m_pPacketStrand = std::move(pStrand); }
+    const std::shared_ptr<LibCommons::Strand>& GetPacketStrand() const noexcept { return m_pPacketStrand; }
+
+    // Adaptive flush 설정 (프로세스 전역). 세션 송신율이 ppsThreshold 이상이면
+    // flush 를 최대 maxDelay 만큼 미뤄 워커의 완료 배치 종료 시점에 합쳐 보낸다.
+    // maxDelay == 0 이면 비활성 (기본값).
+    static void SetAdaptiveSendFlush(std::chrono::microseconds maxDelay, std::uint32_t ppsThreshold) noexcept
+    {
+        m_AdaptiveFlushPpsThreshold.store(ppsThreshold, std::memory_order_relaxed);
+        m_AdaptiveFlushDelayUs.store(maxDelay.count(), std::memory_order_relaxed);
+    }
 
     // Design Ref: session-idle-timeout §3.2 — IIdleAware 구현.
     // steady_clock 기준 epoch-ms. 0 은 수신 이력 없음 (연결 직후).
@@ -74,6 +125,13 @@ public:
     {
         return m_TotalTxBytes.load(std::memory_order_relaxed);
     }
+    std::uint64_t GetBufferBytes() const noexcept override
+    {
+        std::uint64_t bytes = 0;
+        if (m_pReceiveBuffer) bytes += m_pReceiveBuffer->GetResidentBytes();
+        if (m_pSendBuffer)    bytes += m_pSendBuffer->GetResidentBytes();
+        return bytes;
+    }
 
     // Design Ref: session-idle-timeout §4.2 — 사유 파라미터 오버로드.
     // 
@@ -83,6 +141,17 @@ public:
     // 기존 호출자(8곳) 호환 — 내부에서 Normal 사유로 delegation.
     void RequestDisconnect();
 
+    // 세션 풀 반환 가능 여부 — outstanding I/O 가 없어야 한다.
+    bool IsReusable() const noexcept
+    {
+        return m_OutstandingIoCount.load(std::memory_order_acquire) == 0;
+    }
+
+    // 세션 풀 재사용 훅. 종료가 끝난 세션을 새 소켓으로 되살린다 (IsReusable 인 상태에서만 호출).
+    // 플래그/카운터/통계를 초기값으로 돌리고 송수신 버퍼는 재할당 없이 비우며, 세션 id 를 새로 발급.
+    // 서브클래스는 override 해 자기 상태를 초기화한 뒤 IOSession::ResetForReuse 를 호출한다.
+    virtual void ResetForReuse(const std::shared_ptr<Core::Socket>& pSocket);
+
 protected:
     // # outstanding I/O 증가 (외부 posting 포함)
     void AddOutstandingIo() noexcept
@@ -125,42 +194,26 @@ protected:
     // 세션 소켓 조회.
     const std::shared_ptr<Core::Socket> GetSocket() const { return m_pSocket; }
 
-    // IOCP 완료 통지 처리 진입점.
-    virtual void OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped) override;
+    // 플랫폼 중립 완료 통지 처리 진입점. pOperation 주소로 Recv/Send 구분.
+    virtual void OnIOCompleted(const Core::IoCompletion& rfCompletion) override;
+    // IOCP 어댑터 오버로드 노출 (IIOConsumer::OnIOCompleted(bool, DWORD, OVERLAPPED*)).
+    using Core::IIOConsumer::OnIOCompleted;
 
-    // 수신 데이터 처리
+    // 수신 데이터 처리 (zero-copy). rfView 는 핸들러 반환 전까지만 유효하며 반환 후 Consume 된다.
+    // 기본 구현은 ToOwned() 복사 후 OnPacketReceived 로 위임 — 기존 서브클래스 호환용.
+    virtual void OnPacketViewReceived(const Core::PacketView& rfView) { OnPacketReceived(rfView.ToOwned()); }
+
+    // 수신 데이터 처리 (소유 Packet). OnPacketViewReceived 를 재정의하지 않은 세션에서만 호출된다.
     virtual void OnPacketReceived(const Core::Packet& rfPacket) {}
 
     // 송신 완료 처리
     virtual void OnSent(size_t bytesSent) {}
 
 protected:
-    // IOCP용 OVERLAPPED 확장 컨텍스트.
-    // protected: 서브클래스(테스트용 TestableIOSession 등)가 OnIOCompleted 를 시뮬레이션할 때
-    //            이 Overlapped 주소가 필요 — OnIOCompleted 는 pOverlapped 주소로 Recv/Send 구분.
-    struct OverlappedEx
-    {
-        OVERLAPPED Overlapped{};
-        // WSARecv/WSASend용 연속 버퍼 저장소.
-        std::vector<char> Buffers{};
-        // Scatter-Gather I/O를 위한 WSABUF 배열
-        std::vector<WSABUF> WSABufs{};
-        // 이번 요청 바이트 수.
-        size_t RequestedBytes = 0;
-
-        // Zero-byte Recv 여부 (Recv Overlapped 전용)
-        bool IsZeroByte = false;
-
-        // OVERLAPPED 재사용을 위한 초기화.
-        void ResetOverlapped()
-        {
-            std::memset(&Overlapped, 0, sizeof(Overlapped));
-        }
-    };
-
-    // 수신/송신 Overlapped — protected 로 서브클래스가 OnIOCompleted 호출 시 주소 접근 가능.
-    OverlappedEx m_RecvOverlapped{};
-    OverlappedEx m_SendOverlapped{};
+    // 수신/송신 요청 기술자 — protected 로 서브클래스(테스트용 TestableIOSession 등)가
+    // 완료 통지를 시뮬레이션할 때 주소 접근 가능. OnIOCompleted 는 pOperation 주소로 Recv/Send 구분.
+    Core::IoOperation m_RecvOperation{ Core::IoOperationType::Recv };
+    Core::IoOperation m_SendOperation{ Core::IoOperationType::Send };
 
     // # 완료 통지 수명 보호
     struct IoCompletionGuard
@@ -176,29 +229,53 @@ private:
     // 송신 큐 적재 및 비동기 송신 트리거.
     void SendBuffer(std::span<const std::byte> data);
 
+    // SendMessage / TrySendMessage 공통. bTry 면 watermark 를 지키고 한도 초과 시 세션을 유지한다.
+    SendResult EnqueueMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage, bool bTry);
+
+    // 송신 적재량으로 watermark 전이 판단 — 전이 시 OnSendBackpressure 호출.
+    void UpdateSendBackpressure();
+
     void ReadReceivedBuffers();
 
-    // Recv용 WSABUF 배열 준비.
+    // 프레임을 복사해 m_pPacketStrand 로 넘긴다.
+    void PostPacketToStrand(const Core::PacketView& rfView);
+
+    // Recv 요청 버퍼 준비.
     bool PrepareRecvBuffers(bool bZeroByte);
 
     // Recv 요청 공통 구현
     bool RequestRecv(bool bZeroByte);
 
-    // Send용 WSABUF 배열 준비.
+    // Send 요청 버퍼 준비.
     void PrepareSendBuffers(const std::vector<std::span<const std::byte>>& buffers, size_t bytesToSend);
 
-    // 송신 큐 기반 비동기 송신(WSASend) 등록.
+    // 송신 큐 기반 비동기 송신 등록.
     bool TryPostSendFromQueue();
 
+    // 송신 버퍼 segment 와 공유 프레임을 적재 순서대로 엮는다. m_SendOrderMutex 보유 상태에서 호출.
+    size_t CollectSendBuffersUnlocked(std::vector<std::span<const std::byte>>& rfOutBuffers);
+
+    // 송신 완료 바이트를 적재 순서대로 소비 — 송신 버퍼 Consume / 다 보낸 공유 프레임 해제.
+    void ConsumeSentBytes(size_t bytesTransferred);
+
+    // 송신 버퍼와 공유 프레임 대기열을 함께 비운다 (outstanding Send 가 없을 때만).
+    void ClearSendQueue();
+
+    // 송신 flush 요청 — cork 중이면 보류, adaptive 조건이면 배치 종료까지 지연, 아니면 즉시 post.
+    void RequestSendFlush();
+
+    // 송신 메시지율 갱신 (adaptive flush 판단용).
+    void UpdateSendRate() noexcept;
+
     // Recv 완료 처리 분기.
-    void HandleRecvCompletion(bool bSuccess, DWORD bytesTransferred);
+    void HandleRecvCompletion(const Core::IoCompletion& rfCompletion);
 	// Zero-byte Recv 완료 처리: 실제 데이터 수신이 아닌, recv loop 지속을 위한 완료 통지 경로.
-    void HandleZeroByteRecvCompletion(DWORD bytesTransferred);
+    void HandleZeroByteRecvCompletion(size_t bytesTransferred);
 	// Real Recv 완료 처리: 실제 데이터 수신 경로. bytesTransferred > 0 일 때만 호출.
-    void HandleRealRecvCompletion(DWORD bytesTransferred);
+    void HandleRealRecvCompletion(size_t bytesTransferred);
 
     // Send 완료 처리 분기.
-    void HandleSendCompletion(bool bSuccess, DWORD bytesTransferred);
+    void HandleSendCompletion(const Core::IoCompletion& rfCompletion);
 
 protected:
     // # posting 실패 카운터 복구
@@ -216,6 +293,42 @@ private:
 
     std::atomic_bool m_DisconnectRequested = false;
 
+    // Cork 중첩 depth. 0 보다 크면 송신 post 를 보류한다.
+    std::atomic<int> m_CorkDepth { 0 };
+
+    // 워커 배치에 지연 flush 가 등록되어 있는지 여부 (중복 Defer 방지).
+    std::atomic_bool m_bSendFlushDeferred = false;
+
+    // 송신 메시지율 추정 — 윈도우 시작 시각(steady_clock us), 윈도우 내 메시지 수, 직전 윈도우 PPS.
+    std::atomic<std::int64_t> m_SendRateWindowStartUs { 0 };
+    std::atomic<std::uint32_t> m_SendRateWindowCount { 0 };
+    std::atomic<std::uint32_t> m_SendRatePps { 0 };
+
+    // 송신 적재량 high/low watermark 와 backpressure 상태.
+    SendWatermark m_SendWatermark{};
+
+    // 송신 대기 중인 공유 프레임. RingMark 는 이 프레임 앞에 나가야 할 송신 버퍼 누적 바이트 위치.
+    struct SharedSendEntry
+    {
+        Core::SharedPacket Packet;
+        std::uint64_t RingMark = 0;
+        size_t Offset = 0;  // 이미 송신된 바이트
+    };
+
+    // 송신 버퍼 적재 / 공유 프레임 적재 / 송신 구성 / 완료 소비의 순서를 맞춘다.
+    // 공유 프레임이 없으면 경합 없는 lock 1회가 추가될 뿐이다.
+    std::mutex m_SendOrderMutex;
+    std::deque<SharedSendEntry> m_SharedSendQueue{};
+    std::uint64_t m_SendRingWritten = 0;   // 송신 버퍼에 적재된 누적 바이트
+    std::uint64_t m_SendRingConsumed = 0;  // 송신 완료로 소비된 누적 바이트
+    std::atomic<size_t> m_SharedPendingBytes { 0 };
+
+    // ReadReceivedBuffers 용 segment 저장소 (수신 경로는 직렬화되어 있어 재사용 가능).
+    std::vector<std::span<const std::byte>> m_RecvReadBuffers{};
+
+    // 수신 패킷 처리 strand (SetPacketStrand). nullptr 이면 인라인 처리.
+    std::shared_ptr<LibCommons::Strand> m_pPacketStrand{};
+
     // # outstanding I/O 카운터
     std::atomic<int> m_OutstandingIoCount { 0 };
 
@@ -235,12 +348,19 @@ private:
     // 세션 소켓 핸들
     std::shared_ptr<Core::Socket> m_pSocket = {};
 
+    // 송수신 posting 백엔드.
+    Core::IIoBackend& m_rfBackend;
+
     // 세션 식별자.
     uint64_t m_SessionId = m_NextSessionId.fetch_add(1, std::memory_order_relaxed);
 
     // 세션 식별자 시퀀스.
     inline static std::atomic<uint64_t> m_NextSessionId = 1;
 
+    // Adaptive flush 설정 (SetAdaptiveSendFlush).
+    inline static std::atomic<std::int64_t> m_AdaptiveFlushDelayUs { 0 };
+    inline static std::atomic<std::uint32_t> m_AdaptiveFlushPpsThreshold { 0 };
+
 };
 
 
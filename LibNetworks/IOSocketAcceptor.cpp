@@ -11,6 +11,7 @@ import std;
 import commons.logger;
 import networks.services.io_service;
 import networks.core.io_consumer;
+import networks.core.io_operation;
 
 namespace LibNetworks::Core
 {
@@ -35,8 +36,42 @@ std::shared_ptr<LibNetworks::Core::IOSocketAcceptor> IOSocketAcceptor::Create(
 
 }
 
+std::shared_ptr<LibNetworks::Core::IOSocketAcceptor> IOSocketAcceptor::CreateSharded(
+    Core::Socket& rfListenerSocket,
+    OnDoFuncCreateShardSession pOnDoFuncCreateSession,
+    const unsigned short listenPort,
+    const unsigned long maxConnectionCount,
+    const unsigned int shardCount,
+    const unsigned int beginAcceptCount /*= 100*/,
+    const std::optional<std::uint32_t> firstProcessor /*= std::nullopt*/)
+{
+    auto pAcceptor = std::make_shared<IOSocketAcceptor>(LibNetworks::Core::Socket::ENetworkMode::IOCP, rfListenerSocket, pOnDoFuncCreateSession);
+    if (!pAcceptor->StartShards(shardCount, firstProcessor))
+    {
+        LibCommons::Logger::GetInstance().LogError("IOSocketAcceptor", "CreateSharded - StartShards failed. Shard Count : {}", shardCount);
+        pAcceptor->Shutdown();
+        return nullptr;
+    }
+
+    // accept 완료는 소켓을 shard 로 넘기기만 하므로 워커 1개로 충분.
+    if (!pAcceptor->Start(listenPort, maxConnectionCount, 1, beginAcceptCount))
+    {
+        LibCommons::Logger::GetInstance().LogError("IOSocketAcceptor", "CreateSharded - Start failed. Port : {}", listenPort);
+        pAcceptor->Shutdown();
+        return nullptr;
+    }
+    return pAcceptor;
+}
+
 
 IOSocketAcceptor::IOSocketAcceptor(LibNetworks::Core::Socket::ENetworkMode listenSocketMode, Core::Socket& rfListenerSocket, OnDoFuncCreateSession pOnDoFuncCreateSession)
+    : m_ListenerSocketMode(listenSocketMode), m_ListenerSocket(std::move(rfListenerSocket))
+    , m_pOnDoFuncCreateSession([pOnDoFuncCreateSession](const std::shared_ptr<Core::Socket>& pSocket, std::uint32_t) { return pOnDoFuncCreateSession(pSocket); })
+{
+
+}
+
+IOSocketAcceptor::IOSocketAcceptor(LibNetworks::Core::Socket::ENetworkMode listenSocketMode, Core::Socket& rfListenerSocket, OnDoFuncCreateShardSession pOnDoFuncCreateSession)
     : m_ListenerSocketMode(listenSocketMode), m_ListenerSocket(std::move(rfListenerSocket)), m_pOnDoFuncCreateSession(pOnDoFuncCreateSession)
 {
 
@@ -50,30 +85,30 @@ void IOSocketAcceptor::Shutdown()
         m_pService->Stop();
     }
     m_ListenerSocket.Close();
+
+    for (auto& pShard : m_SessionShards)
+    {
+        pShard->Stop();
+    }
 }
 
 //------------------------------------------------------------------------ 
-void IOSocketAcceptor::OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped)
+void IOSocketAcceptor::OnIOCompleted(const Core::IoCompletion& rfCompletion)
 {
     auto& logger = LibCommons::Logger::GetInstance();
-    if (!pOverlapped)
+    if (!rfCompletion.pOperation || rfCompletion.pOperation->Type != Core::IoOperationType::Accept)
     {
-        logger.LogError("IOSocketAcceptor", "OnIOCompleted: OVERLAPPED is null. bSuccess : {}, BytesTransferred : {}", bSuccess, bytesTransferred);
+        logger.LogError("IOSocketAcceptor", "OnIOCompleted: Invalid accept operation. bSuccess : {}, BytesTransferred : {}", rfCompletion.bSuccess, rfCompletion.BytesTransferred);
 
         return;
     }
 
-    // 1. AcceptOverlapped 구조체로 캐스팅
-    AcceptOverlapped* pAcceptOverlapped = CONTAINING_RECORD(pOverlapped, AcceptOverlapped, Overlapped);
-    if (!pAcceptOverlapped)
-    {
-        logger.LogError("IOSocketAcceptor", "OnIOCompleted: AcceptOverlapped is null. bSuccess : {}, BytesTransferred : {}", bSuccess, bytesTransferred);
-        return;
-    }
+    // 1. AcceptOverlapped 구조체로 캐스팅 — 소유권을 받아 다음 AcceptEx 에 재사용.
+    std::unique_ptr<AcceptOverlapped> pAcceptOverlapped(static_cast<AcceptOverlapped*>(rfCompletion.pOperation));
 
-    if (!bSuccess)
+    if (!rfCompletion.bSuccess)
     {
-        logger.LogError("IOSocketAcceptor", "Accept failed");
+        logger.LogError("IOSocketAcceptor", "Accept failed. Error : {}", rfCompletion.ErrorCode);
         if (pAcceptOverlapped->AcceptSocket != INVALID_SOCKET)
         {
             ::closesocket(pAcceptOverlapped->AcceptSocket);
@@ -81,60 +116,68 @@ void IOSocketAcceptor::OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVER
     }
     else
     {
-        logger.LogInfo("IOSocketAcceptor", "OnIOCompleted: Accept success. Socket : {}", pAcceptOverlapped->AcceptSocket);
-
+        HandleAccepted(pAcceptOverlapped->AcceptSocket);
+    }
+    pAcceptOverlapped->AcceptSocket = INVALID_SOCKET;
 
-        auto pSocket = std::make_shared<Socket>(pAcceptOverlapped->AcceptSocket);
-        // AcceptContext 업데이트
-        if (!pSocket->UpdateAcceptContext(m_ListenerSocket.GetSocket()))
+    if (m_bExecuted)
+    {
+        // 3. 다시 AcceptEx 요청
+        if (!BeginAcceptEx(std::move(pAcceptOverlapped)))
         {
-            logger.LogError("IOSocketAcceptor", "OnIOCompleted: UpdateAcceptContext failed. Error: {}", ::WSAGetLastError());
-            pSocket->Close();
-            return;
+            logger.LogWarning("IOSocketAcceptor", "Failed to post next accept.");
         }
+    }
+}
 
-        // 최적화 설정 적용
-        // 1. Nagle Off (TCP_NODELAY)
-        pSocket->UpdateContextDisableNagleAlgorithm();
-        // 2. Zero-Copy (커널 버퍼 0)
-        pSocket->UpdateContextZeroCopy();
-        // 3. Keep-Alive (30초 유휴 후 1초 간격)
-        pSocket->UpdateContextKeepAlive(30000, 1000);
+void IOSocketAcceptor::HandleAccepted(SOCKET acceptSocket)
+{
+    auto& logger = LibCommons::Logger::GetInstance();
 
-        std::shared_ptr<Sessions::INetworkSession> pInboundSession = m_pOnDoFuncCreateSession(pSocket);
+    logger.LogInfo("IOSocketAcceptor", "OnIOCompleted: Accept success. Socket : {}", acceptSocket);
 
-        // 명시적 모드 기반 분기: m_ListenerSocketMode로 판단
-        if (m_ListenerSocketMode == LibNetworks::Core::Socket::ENetworkMode::IOCP)
-        {
-            auto pIOService = std::dynamic_pointer_cast<LibNetworks::Services::IOService>(m_pService);
-            if (!pIOService)
-            {
-                logger.LogError("IOSocketAcceptor", "IOCP mode but IOService not available. Session dropped.");
-                pSocket->Close();
-                return;
-            }
-
-            auto pIOConsumer = std::dynamic_pointer_cast<Core::IIOConsumer>(pInboundSession);
-            if (pIOConsumer)
-            {
-                pIOService->Associate(pAcceptOverlapped->AcceptSocket, pIOConsumer->GetCompletionId());
-            }
-        }
-        // RIO 모드: RIOSession이 내부적으로 RQ를 생성하여 소켓을 처리
-
-        pInboundSession->OnAccepted();
+    auto pSocket = std::make_shared<Socket>(acceptSocket);
+    // AcceptContext 업데이트
+    if (!pSocket->UpdateAcceptContext(m_ListenerSocket.GetSocket()))
+    {
+        logger.LogError("IOSocketAcceptor", "OnIOCompleted: UpdateAcceptContext failed. Error: {}", ::WSAGetLastError());
+        pSocket->Close();
+        return;
     }
 
-    if (m_bExecuted)
+    // 최적화 설정 적용
+    // 1. Nagle Off (TCP_NODELAY)
+    pSocket->UpdateContextDisableNagleAlgorithm();
+    // 2. Zero-Copy (커널 버퍼 0)
+    pSocket->UpdateContextZeroCopy();
+    // 3. Keep-Alive (30초 유휴 후 1초 간격)
+    pSocket->UpdateContextKeepAlive(30000, 1000);
+
+    // shard 모드: 세션이 수명 내내 머물 shard 를 먼저 정한다.
+    const std::uint32_t shardIndex = m_SessionShards.empty() ? 0 : m_NextShard.fetch_add(1, std::memory_order_relaxed) % static_cast<std::uint32_t>(m_SessionShards.size());
+
+    std::shared_ptr<Sessions::INetworkSession> pInboundSession = m_pOnDoFuncCreateSession(pSocket, shardIndex);
+
+    // 명시적 모드 기반 분기: m_ListenerSocketMode로 판단
+    if (m_ListenerSocketMode == LibNetworks::Core::Socket::ENetworkMode::IOCP)
     {
-        // 3. 다시 AcceptEx 요청
-        if (!BeginAcceptEx())
+        auto pIOService = m_SessionShards.empty() ? std::dynamic_pointer_cast<LibNetworks::Services::IOService>(m_pService) : m_SessionShards[shardIndex];
+        if (!pIOService)
         {
-            logger.LogWarning("IOSocketAcceptor", "Failed to post next accept.");
+            logger.LogError("IOSocketAcceptor", "IOCP mode but IOService not available. Session dropped.");
+            pSocket->Close();
+            return;
+        }
+
+        auto pIOConsumer = std::dynamic_pointer_cast<Core::IIOConsumer>(pInboundSession);
+        if (pIOConsumer)
+        {
+            pIOService->Associate(acceptSocket, pIOConsumer->GetCompletionId());
         }
     }
+    // RIO 모드: RIOSession이 내부적으로 RQ를 생성하여 소켓을 처리
 
-    delete pAcceptOverlapped;
+    pInboundSession->OnAccepted();
 }
 
 //------------------------------------------------------------------------ 
@@ -191,6 +234,32 @@ bool IOSocketAcceptor::Start(const unsigned short listenPort, const unsigned lon
     return true;
 }
 
+bool IOSocketAcceptor::StartShards(const unsigned int shardCount, const std::optional<std::uint32_t> firstProcessor)
+{
+    auto& logger = LibCommons::Logger::GetInstance();
+
+    m_SessionShards.reserve(shardCount);
+    for (unsigned int i = 0; i < shardCount; ++i)
+    {
+        auto pShard = std::make_shared<Services::IOService>();
+        if (firstProcessor)
+        {
+            pShard->SetWorkerAffinity(*firstProcessor + i);
+        }
+
+        if (!pShard->Start(1))
+        {
+            logger.LogError("IOSocketAcceptor", "StartShards, Shard IOService Start failed. Index : {}", i);
+            return false;
+        }
+        m_SessionShards.push_back(std::move(pShard));
+    }
+
+    logger.LogInfo("IOSocketAcceptor", "StartShards, {} session shards started.", shardCount);
+
+    return true;
+}
+
 bool IOSocketAcceptor::ListenSocket(const unsigned short listenPort, const unsigned long maxConnectionCount)
 {
     auto& logger = LibCommons::Logger::GetInstance();
@@ -270,7 +339,7 @@ bool IOSocketAcceptor::ListenSocket(const unsigned short listenPort, const unsig
     return true;
 }
 
-bool IOSocketAcceptor::BeginAcceptEx()
+bool IOSocketAcceptor::BeginAcceptEx(std::unique_ptr<AcceptOverlapped> pAcceptOverlapped /*= nullptr*/)
 {
     auto& logger = LibCommons::Logger::GetInstance();
     if (!m_bExecuted)
@@ -279,8 +348,15 @@ bool IOSocketAcceptor::BeginAcceptEx()
         return false;
     }
 
-    // 1. AcceptEx용 OVERLAPPED 확장 구조체 생성
-    AcceptOverlapped* pAcceptOverlapped = new AcceptOverlapped();
+    // 1. AcceptEx용 OVERLAPPED 확장 구조체 — 완료된 요청이 넘어오면 재사용, 없으면 생성.
+    if (pAcceptOverlapped)
+    {
+        pAcceptOverlapped->ResetNative();
+    }
+    else
+    {
+        pAcceptOverlapped = std::make_unique<AcceptOverlapped>();
+    }
 
     // 2. 클라이언트용 소켓 생성
     DWORD dwFlags = WSA_FLAG_OVERLAPPED;
@@ -293,7 +369,6 @@ bool IOSocketAcceptor::BeginAcceptEx()
     if (INVALID_SOCKET == pAcceptOverlapped->AcceptSocket)
     {
         logger.LogError("IOSocketAcceptor", "BeginAcceptEx: Failed to create accept socket. Error : {}", ::WSAGetLastError());
-        delete pAcceptOverlapped;
         return false;
     }
 
@@ -307,7 +382,7 @@ bool IOSocketAcceptor::BeginAcceptEx()
         sizeof(sockaddr_in) + 16,				// 로컬 주소 길이
         sizeof(sockaddr_in) + 16,				// 원격 주소 길이
         &bytesReceived,							// 실제 수신된 바이트 수
-        &(pAcceptOverlapped->Overlapped)		// OVERLAPPED 구조체
+        pAcceptOverlapped->GetOverlapped()		// OVERLAPPED 구조체
     );
 
     if (!bResult)
@@ -318,11 +393,13 @@ bool IOSocketAcceptor::BeginAcceptEx()
             logger.LogError("IOSocketAcceptor", "BeginAcceptEx: AcceptEx failed. Error : {}", nError);
 
             ::closesocket(pAcceptOverlapped->AcceptSocket);
-            delete pAcceptOverlapped;
             return false;
         }
     }
 
+    // 완료 통지(OnIOCompleted)가 소유권을 다시 가져간다.
+    pAcceptOverlapped.release();
+
     logger.LogDebug("IOSocketAcceptor", "AcceptEx posted successfully.");
 
     return true;
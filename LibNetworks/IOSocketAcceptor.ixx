@@ -4,23 +4,29 @@
 #include <MSWSock.h>
 #include <memory>
 #include <functional>
+#include <cstdint>
 
 export module networks.core.io_socket_acceptor;
 
 import networks.core.io_consumer;
+import networks.core.io_operation;
 import networks.core.socket;
 
 import networks.sessions.inetwork_session;
 import networks.services.inetwork_service;
+import networks.services.io_service;
+
+import std;
 
 namespace LibNetworks::Core
 {
 export class IOSocketAcceptor : public Core::IIOConsumer, std::enable_shared_from_this<IOSocketAcceptor>
 {
-    // AcceptEx용 OVERLAPPED 확장 구조체
-    struct AcceptOverlapped
+    // AcceptEx용 IoOperation 확장 구조체
+    struct AcceptOverlapped : public Core::IoOperation
     {
-        OVERLAPPED Overlapped = {};
+        AcceptOverlapped() : Core::IoOperation(Core::IoOperationType::Accept) {}
+
         SOCKET AcceptSocket = {};
         char Buffer[(sizeof(sockaddr_in) + 16) * 2] = {};  // 로컬 주소 + 원격 주소
     };
@@ -28,6 +34,9 @@ public:
 
     using OnDoFuncCreateSession = std::function<std::shared_ptr<Sessions::INetworkSession>(const std::shared_ptr<Core::Socket>&)>;
 
+    // shard 모드 세션 생성 — 세션이 고정될 shard 인덱스를 함께 받는다 (shard 별 세션 목록 / 타이머 선택용).
+    using OnDoFuncCreateShardSession = std::function<std::shared_ptr<Sessions::INetworkSession>(const std::shared_ptr<Core::Socket>&, std::uint32_t)>;
+
     static std::shared_ptr<IOSocketAcceptor> Create(
         LibNetworks::Core::Socket::ENetworkMode listenSocketMode,
         Core::Socket& rfListenerSocket,
@@ -37,19 +46,44 @@ public:
         const unsigned int threadCount,
         const unsigned int beginAcceptCount = 100);
 
+    // thread-per-core shard 모드 (IOCP 전용).
+    // AcceptEx 완료는 accept 전용 IOService(워커 1개) 가 받고, 세션 소켓은 shard IOService 중 하나에 round-robin 으로 고정된다.
+    // shard 마다 완료 포트 + 워커 1개 — 세션은 수명 내내 같은 워커(코어) 에서만 완료를 처리한다.
+    // firstProcessor 가 있으면 shard i 의 워커를 논리 프로세서 (firstProcessor + i) 에 고정.
+    // (Windows 에는 SO_REUSEPORT 분산이 없어 리스너는 1개.)
+    static std::shared_ptr<IOSocketAcceptor> CreateSharded(
+        Core::Socket& rfListenerSocket,
+        OnDoFuncCreateShardSession pOnDoFuncCreateSession,
+        const unsigned short listenPort,
+        const unsigned long maxConnectionCount,
+        const unsigned int shardCount,
+        const unsigned int beginAcceptCount = 100,
+        const std::optional<std::uint32_t> firstProcessor = std::nullopt);
+
     IOSocketAcceptor() = delete;
 
     explicit IOSocketAcceptor(LibNetworks::Core::Socket::ENetworkMode listenSocketMode, Core::Socket& rfListenerSocket, OnDoFuncCreateSession pOnDoFuncCreateSession);
 
+    explicit IOSocketAcceptor(LibNetworks::Core::Socket::ENetworkMode listenSocketMode, Core::Socket& rfListenerSocket, OnDoFuncCreateShardSession pOnDoFuncCreateSession);
+
     void Shutdown();
 
+    // shard 모드면 shard 수, 아니면 0.
+    std::uint32_t GetShardCount() const { return static_cast<std::uint32_t>(m_SessionShards.size()); }
+
 protected:
-    void OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped) override;
+    void OnIOCompleted(const Core::IoCompletion& rfCompletion) override;
 private:
     bool Start(const unsigned short listenPort, const unsigned long maxConnectionCount, const unsigned int threadCount, const unsigned int beginAcceptCount);
 
+    bool StartShards(const unsigned int shardCount, const std::optional<std::uint32_t> firstProcessor);
+
     bool ListenSocket(const unsigned short listenPort, const unsigned long maxConnectionCount);
-    bool BeginAcceptEx();
+    // pAcceptOverlapped 가 있으면 완료된 Accept 요청을 재사용 (accept 마다 new/delete 하지 않는다).
+    bool BeginAcceptEx(std::unique_ptr<AcceptOverlapped> pAcceptOverlapped = nullptr);
+
+    // Accept 성공 소켓의 세션 생성 / 완료 포트 연결.
+    void HandleAccepted(SOCKET acceptSocket);
 
 private:
 
@@ -63,7 +97,11 @@ private:
     LPFN_ACCEPTEX m_lpfnAcceptEx = {};
     LPFN_GETACCEPTEXSOCKADDRS m_lpfnGetAcceptExSockaddrs = {};
 
-    OnDoFuncCreateSession m_pOnDoFuncCreateSession = {};
+    OnDoFuncCreateShardSession m_pOnDoFuncCreateSession = {};
+
+    // shard 모드 세션용 IOService (shard 당 워커 1개). 비어 있으면 m_pService 공유 모드.
+    std::vector<std::shared_ptr<Services::IOService>> m_SessionShards;
+    std::atomic<std::uint32_t> m_NextShard = 0;
 
 };
 
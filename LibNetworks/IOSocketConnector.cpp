@@ -10,6 +10,7 @@ import std;
 import commons.logger;
 import networks.services.io_service;
 import networks.core.io_consumer;
+import networks.core.io_operation;
 import networks.sessions.outbound_session;
 
 namespace LibNetworks::Core
@@ -229,7 +230,7 @@ bool IOSocketConnector::ConnectEx(std::string ip, const unsigned short port)
         nullptr,                                        // 전송 버퍼
         0,                                              // 전송 버퍼 길이
         nullptr,                                        // 실제 전송된 바이트 수
-        pOutboundSession->GetConnectOverlappedPtr()     // OVERLAPPED 구조체
+        pOutboundSession->GetConnectOperation().GetOverlapped() // OVERLAPPED 구조체
     );
 
     if (!bResult)
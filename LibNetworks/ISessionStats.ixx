@@ -23,6 +23,9 @@ export struct ISessionStats
 
     // 세션 생성 이후 누적 송신 바이트 (ok = OnIOCompleted 에서 Send 완료 성공 경로).
     virtual std::uint64_t GetTotalTxBytes() const noexcept = 0;
+
+    // 현재 세션이 붙들고 있는 송수신 버퍼 바이트. 지연 부착 버퍼면 유휴 시 0.
+    virtual std::uint64_t GetBufferBytes() const noexcept { return 0; }
 };
 
 } // namespace LibNetworks::Sessions
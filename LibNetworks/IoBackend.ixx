@@ -0,0 +1,37 @@
+﻿module;
+
+#include <cstdint>
+
+export module networks.core.io_backend;
+
+import networks.core.io_operation;
+import networks.core.socket;
+
+namespace LibNetworks::Core
+{
+
+/**
+ * IIoBackend
+ * 세션이 사용하는 비동기 송수신 posting 인터페이스.
+ *
+ * - IOSession 은 IoOperation 에 버퍼만 채우고 PostRecv/PostSend 를 호출한다.
+ *   완료는 백엔드의 워커가 IIOConsumer::OnIOCompleted(IoCompletion) 로 전달한다.
+ * - 반환값 false 는 "즉시 실패 (완료 통지 없음)" 를 뜻하며 rfErrorCode 에 플랫폼 에러 코드를 담는다.
+ *   대기(pending) 상태는 성공으로 취급한다.
+ */
+export class IIoBackend
+{
+public:
+    virtual ~IIoBackend() = default;
+
+    // 비동기 수신 요청. rfOperation.Buffers 가 비어 있으면 zero-byte 수신.
+    virtual bool PostRecv(Socket& rfSocket, IoOperation& rfOperation, int& rfErrorCode) = 0;
+
+    // 비동기 송신 요청 (gather).
+    virtual bool PostSend(Socket& rfSocket, IoOperation& rfOperation, int& rfErrorCode) = 0;
+};
+
+// 현재 플랫폼의 기본 백엔드 (Windows: IOCP). 구현은 플랫폼별 구현 파일에 있다.
+export IIoBackend& GetPlatformIoBackend();
+
+} // namespace LibNetworks::Core
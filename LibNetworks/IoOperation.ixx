@@ -0,0 +1,101 @@
+﻿module;
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#if defined(_WIN32)
+#include <WinSock2.h>
+#endif
+
+export module networks.core.io_operation;
+
+import std;
+
+namespace LibNetworks::Core
+{
+
+// 비동기 I/O 요청 종류.
+export enum class IoOperationType : std::uint8_t
+{
+    None    = 0,
+    Recv    = 1,
+    Send    = 2,
+    Accept  = 3,
+    Connect = 4,
+};
+
+/**
+ * IoOperation
+ * 플랫폼 중립 비동기 I/O 요청 기술자.
+ *
+ * - 세션은 요청 종류 / 버퍼 / 요청 바이트만 기술하고, 백엔드(IIoBackend)가 native 요청으로 변환한다.
+ * - 완료 통지 시 IoCompletion::pOperation 주소로 어떤 요청이 끝났는지 구분한다.
+ * - Windows 에서는 OVERLAPPED 를 내장 — IOCP 의 OVERLAPPED* 는 FromOverlapped() 로 역변환.
+ *   AcceptEx/ConnectEx 처럼 추가 상태가 필요한 요청은 이 구조체를 상속해 확장한다.
+ */
+export struct IoOperation
+{
+#if defined(_WIN32)
+    // IOCP 요청용 native 헤더. 백엔드 외부에서는 직접 다루지 않는다.
+    OVERLAPPED Overlapped{};
+#endif
+
+    // 요청 종류.
+    IoOperationType Type = IoOperationType::None;
+
+    // 요청 버퍼 목록 (Recv: 기록 대상, Send: 송신 대상). 백엔드가 WSABUF / iovec 로 변환.
+    // 비어 있는 Recv 는 zero-byte 수신(readiness 대기)으로 처리된다.
+    std::vector<std::span<std::byte>> Buffers{};
+
+    // 이번 요청 바이트 수.
+    std::size_t RequestedBytes = 0;
+
+    // Zero-byte Recv 여부 (Recv 전용).
+    bool IsZeroByte = false;
+
+    IoOperation() = default;
+    explicit IoOperation(IoOperationType type) noexcept : Type(type) {}
+
+    IoOperation(const IoOperation&) = delete;
+    IoOperation& operator=(const IoOperation&) = delete;
+
+    // 재사용을 위한 native 상태 초기화 (버퍼 목록은 호출자가 다시 채운다).
+    void ResetNative() noexcept
+    {
+#if defined(_WIN32)
+        std::memset(&Overlapped, 0, sizeof(Overlapped));
+#endif
+    }
+
+#if defined(_WIN32)
+    OVERLAPPED* GetOverlapped() noexcept { return &Overlapped; }
+
+    // IOCP 완료 통지의 OVERLAPPED* → IoOperation 역변환. 모든 IOCP 요청은 IoOperation 기반이어야 한다.
+    static IoOperation* FromOverlapped(OVERLAPPED* pOverlapped) noexcept
+    {
+        if (!pOverlapped)
+        {
+            return nullptr;
+        }
+
+        return reinterpret_cast<IoOperation*>(
+            reinterpret_cast<std::byte*>(pOverlapped) - offsetof(IoOperation, Overlapped));
+    }
+#endif
+};
+
+// 플랫폼 중립 완료 통지.
+export struct IoCompletion
+{
+    // 완료된 요청. 소유권은 요청을 post 한 쪽(세션/acceptor)에 있다.
+    IoOperation* pOperation = nullptr;
+
+    bool bSuccess = false;
+
+    std::size_t BytesTransferred = 0;
+
+    // 실패 시 플랫폼 에러 코드 (Windows: GetLastError, Linux: errno). 성공 시 0.
+    int ErrorCode = 0;
+};
+
+} // namespace LibNetworks::Core
@@ -0,0 +1,100 @@
+﻿module;
+
+#include <WinSock2.h>
+#include <vector>
+
+module networks.core.io_backend;
+
+import std;
+
+namespace LibNetworks::Core
+{
+
+namespace
+{
+// IOCP 백엔드 — WSARecv/WSASend overlapped posting.
+// WSABUF 배열은 호출 중에만 유효하면 된다 (Winsock 이 overlapped 요청 등록 시 캡처).
+class IocpBackend final : public IIoBackend
+{
+public:
+    bool PostRecv(Socket& rfSocket, IoOperation& rfOperation, int& rfErrorCode) override
+    {
+        std::vector<WSABUF> wsaBufs;
+        BuildWSABufs(rfOperation, wsaBufs);
+
+        DWORD flags = 0;
+        DWORD bytes = 0;
+        const int result = ::WSARecv(rfSocket.GetSocket(),
+            wsaBufs.data(),
+            static_cast<DWORD>(wsaBufs.size()),
+            &bytes,
+            &flags,
+            rfOperation.GetOverlapped(),
+            nullptr);
+
+        return CheckResult(result, rfErrorCode);
+    }
+
+    bool PostSend(Socket& rfSocket, IoOperation& rfOperation, int& rfErrorCode) override
+    {
+        std::vector<WSABUF> wsaBufs;
+        BuildWSABufs(rfOperation, wsaBufs);
+
+        DWORD bytesSent = 0;
+        const int result = ::WSASend(rfSocket.GetSocket(),
+            wsaBufs.data(),
+            static_cast<DWORD>(wsaBufs.size()),
+            &bytesSent,
+            0,
+            rfOperation.GetOverlapped(),
+            nullptr);
+
+        return CheckResult(result, rfErrorCode);
+    }
+
+private:
+    static void BuildWSABufs(const IoOperation& rfOperation, std::vector<WSABUF>& rfWSABufs)
+    {
+        if (rfOperation.Buffers.empty())
+        {
+            // Zero-byte Recv
+            rfWSABufs.push_back(WSABUF{ 0, nullptr });
+            return;
+        }
+
+        rfWSABufs.reserve(rfOperation.Buffers.size());
+        for (const auto& span : rfOperation.Buffers)
+        {
+            WSABUF wsaBuf{};
+            wsaBuf.buf = reinterpret_cast<char*>(span.data());
+            wsaBuf.len = static_cast<ULONG>(span.size());
+            rfWSABufs.push_back(wsaBuf);
+        }
+    }
+
+    static bool CheckResult(int result, int& rfErrorCode)
+    {
+        if (result != SOCKET_ERROR)
+        {
+            return true;
+        }
+
+        const int err = ::WSAGetLastError();
+        if (err == WSA_IO_PENDING)
+        {
+            return true;
+        }
+
+        rfErrorCode = err;
+        return false;
+    }
+};
+} // anonymous namespace
+
+IIoBackend& GetPlatformIoBackend()
+{
+    static IocpBackend backend;
+    return backend;
+}
+
+} // namespace LibNetworks::Core
@@ -14,7 +14,6 @@ OutboundSession::OutboundSession(const std::shared_ptr<Core::Socket>& pSocket,
     std::unique_ptr<LibCommons::Buffers::IBuffer> pSendBuffer)
     : IOSession(std::move(pSocket), std::move(pReceiveBuffer), std::move(pSendBuffer))
 {
-    std::memset(&m_ConnectOverlapped, 0, sizeof(OVERLAPPED));
 }
 
 void OutboundSession::OnConnected()
@@ -31,9 +30,9 @@ void OutboundSession::OnDisconnected()
     NotifyDisconnectObserver();
 }
 
-bool OutboundSession::IsConnectCompletion(const OVERLAPPED* pOverlapped) const
+bool OutboundSession::IsConnectCompletion(const Core::IoOperation* pOperation) const
 {
-    return pOverlapped == &m_ConnectOverlapped;
+    return pOperation == &m_ConnectOperation;
 }
 
 void OutboundSession::MarkConnectIoPosted() noexcept
@@ -86,7 +85,7 @@ bool OutboundSession::FinalizeConnect()
 {
     if (!GetSocket()->UpdateConnectContext())
     {
-        LibCommons::Logger::GetInstance().LogError("OutboundSession", "OnIOCompleted: UpdateConnectContext failed. Session Id : {}, Error : {}", GetSessionId(), ::GetLastError());
+        LibCommons::Logger::GetInstance().LogError("OutboundSession", "OnIOCompleted: UpdateConnectContext failed. Session Id : {}", GetSessionId());
         RequestDisconnect();
         return false;
     }
@@ -99,11 +98,11 @@ bool OutboundSession::FinalizeConnect()
     return true;
 }
 
-void OutboundSession::OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped)
+void OutboundSession::OnIOCompleted(const Core::IoCompletion& rfCompletion)
 {
-    if (!IsConnectCompletion(pOverlapped))
+    if (!IsConnectCompletion(rfCompletion.pOperation))
     {
-        __super::OnIOCompleted(bSuccess, bytesTransferred, pOverlapped);
+        IOSession::OnIOCompleted(rfCompletion);
         return;
     }
 
@@ -120,11 +119,9 @@ void OutboundSession::OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERL
         return;
     }
 
-    if (!bSuccess)
+    if (!rfCompletion.bSuccess)
     {
-        DWORD dwError = ::GetLastError();
-
-        LibCommons::Logger::GetInstance().LogError("OutboundSession", "OnIOCompleted: ConnectEx failed. Session Id : {}, Error : {}", GetSessionId(), dwError);
+        LibCommons::Logger::GetInstance().LogError("OutboundSession", "OnIOCompleted: Connect failed. Session Id : {}, Error : {}", GetSessionId(), rfCompletion.ErrorCode);
 
         RequestDisconnect();
         return;
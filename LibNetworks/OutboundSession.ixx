@@ -5,6 +5,7 @@ module;
 export module networks.sessions.outbound_session;
 
 import networks.sessions.io_session;
+import networks.core.io_operation;
 import networks.core.socket;
 import commons.buffers.ibuffer;
 
@@ -29,16 +30,14 @@ public:
 
     virtual void OnDisconnected() override;
 
-    // GET : ConnectOverlapped
-    const OVERLAPPED& GetConnectOverlapped() const { return m_ConnectOverlapped; }
-    OVERLAPPED& GetConnectOverlapped()
+    // GET : Connect 요청 기술자 (백엔드 connector 가 post, 완료 시 주소로 구분)
+    const Core::IoOperation& GetConnectOperation() const { return m_ConnectOperation; }
+    Core::IoOperation& GetConnectOperation()
     {
         const OutboundSession& rfThis = *this;
-        return const_cast<OVERLAPPED&>(rfThis.GetConnectOverlapped());
+        return const_cast<Core::IoOperation&>(rfThis.GetConnectOperation());
     }
 
-    virtual OVERLAPPED* GetConnectOverlappedPtr() override { return &m_ConnectOverlapped; }
-
     void MarkConnectIoPosted() noexcept;
     void UndoConnectIoOnPostFailure() noexcept;
     bool IsConnectIoPending() const noexcept { return m_ConnectIoPending.load(std::memory_order_acquire); }
@@ -46,16 +45,17 @@ public:
     void SetDisconnectObserver(std::function<void()> observer);
 
 protected:
-    void OnIOCompleted(bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped) override;
+    void OnIOCompleted(const Core::IoCompletion& rfCompletion) override;
+    using IOSession::OnIOCompleted;
 
 private:
-    bool IsConnectCompletion(const OVERLAPPED* pOverlapped) const;
+    bool IsConnectCompletion(const Core::IoOperation* pOperation) const;
     bool FinalizeConnect();
     void ApplyConnectedSocketOptions();
     void NotifyActivationObserver();
     void NotifyDisconnectObserver();
 
-    OVERLAPPED m_ConnectOverlapped;
+    Core::IoOperation m_ConnectOperation{ Core::IoOperationType::Connect };
     std::atomic_bool m_ConnectIoPending { false };
     std::function<void()> m_ActivationObserver{};
     std::function<void()> m_DisconnectObserver{};
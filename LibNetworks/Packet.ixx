@@ -7,6 +7,7 @@
 export module networks.core.packet;
 
 import std;
+import commons.buffers.slab_pool;
 
 namespace LibNetworks::Core
 {
@@ -21,8 +22,8 @@ export class Packet
 public:
     Packet() = delete;
 
-    // Raw 버퍼 기반 패킷 생성(버퍼 소유권 이동)
-    Packet(std::vector<unsigned char>&& buffers)
+    // Raw 버퍼 기반 패킷 생성(버퍼 소유권 이동). 원본 바이트는 SlabPool 블록에 보관.
+    Packet(LibCommons::Buffers::SlabVector<unsigned char>&& buffers)
         : m_PacketId(GetPacketIdFromBuffer(std::as_bytes(std::span(buffers)))),
           m_Payload(reinterpret_cast<const char*>(buffers.data() + GetHeaderSize() + GetPacketIdSize()),
                    buffers.size() - GetHeaderSize() - GetPacketIdSize()),
@@ -30,6 +31,12 @@ public:
     {
     }
 
+    // std::vector 호환 — SlabPool 블록으로 복사.
+    Packet(std::vector<unsigned char>&& buffers)
+        : Packet(LibCommons::Buffers::SlabVector<unsigned char>(buffers.begin(), buffers.end()))
+    {
+    }
+
     Packet(uint16_t packetId, std::string content)
         : m_PacketId(static_cast<int16_t>(packetId)), m_Payload(std::move(content))
     {
@@ -119,7 +126,7 @@ private:
 private:
     const int16_t m_PacketId = 0;
     const std::string m_Payload{};
-    std::vector<unsigned char> m_RawBinaries{};
+    LibCommons::Buffers::SlabVector<unsigned char> m_RawBinaries{};
 };
 
 } // namespace LibNetworks::Core
@@ -0,0 +1,304 @@
+﻿module;
+
+#include <cstdint>
+
+export module networks.core.packet_dispatcher;
+
+import std;
+import commons.logger;
+import networks.core.packet_view;
+
+namespace LibNetworks::Core
+{
+
+// 패킷 ID 별 dispatch 통계 스냅샷. 핸들러 시간 bucket i 는 (2^(i-1), 2^i] us — 0: 1us 이하, 마지막은 상한 없음.
+export struct PacketHandlerStats
+{
+    static constexpr std::size_t kBucketCount = 12;
+
+    std::uint16_t PacketId = 0;
+    std::uint64_t CallCount = 0;
+    std::uint64_t ParseFailureCount = 0;
+    std::array<std::uint64_t, kBucketCount> TimeBuckets{};
+
+    // bucket 의 포함 상한 us (마지막 bucket 은 0 = 무제한).
+    static constexpr std::uint32_t UpperBoundUs(std::size_t index) noexcept
+    {
+        return index + 1 < kBucketCount ? (1u << index) : 0u;
+    }
+
+    static constexpr std::size_t BucketOf(std::uint64_t elapsedUs) noexcept
+    {
+        const std::size_t index = elapsedUs <= 1 ? 0 : static_cast<std::size_t>(std::bit_width(elapsedUs - 1));
+        return (std::min)(index, kBucketCount - 1);
+    }
+
+    // 로그용 "<=1us:10 <=2us:3 >1024us:1" — 0 인 bucket 은 생략.
+    std::string DescribeTimeBuckets() const
+    {
+        std::string out;
+        for (std::size_t i = 0; i < kBucketCount; ++i)
+        {
+            if (TimeBuckets[i] == 0)
+            {
+                continue;
+            }
+
+            if (!out.empty())
+            {
+                out += ' ';
+            }
+            out += UpperBoundUs(i) > 0
+                ? std::format("<={}us:{}", UpperBoundUs(i), TimeBuckets[i])
+                : std::format(">{}us:{}", UpperBoundUs(i - 1), TimeBuckets[i]);
+        }
+        return out;
+    }
+};
+
+
+/**
+ * 파싱된 메시지를 받는 핸들러 기술자. Handler 는 void(TContext&, const TMessage&) 로 호출 가능해야 한다
+ * (TContext 의 멤버 함수 포인터 또는 자유 함수).
+ *
+ * 메시지 객체는 워커 스레드마다 1개를 재사용한다 — Parse 가 Clear 후 채우므로 이전 내용은 남지 않고
+ * 문자열/반복 필드의 할당 용량만 재사용된다. 핸들러가 같은 스레드에서 같은 타입을 중첩 dispatch 하면
+ * 안 되고, 핸들러 밖으로 메시지 참조를 보관하면 안 된다.
+ */
+export template <std::uint16_t PacketId, class TMessage, auto Handler>
+struct PacketHandler
+{
+    static constexpr std::uint16_t kPacketId = PacketId;
+
+    // 파싱 실패면 false (핸들러 미호출).
+    template <class TContext>
+    static bool Invoke(TContext& rfContext, const PacketView& rfView)
+    {
+        thread_local TMessage t_Message;
+        if (!rfView.ParseMessage(t_Message))
+        {
+            return false;
+        }
+
+        std::invoke(Handler, rfContext, static_cast<const TMessage&>(t_Message));
+        return true;
+    }
+};
+
+/**
+ * PacketView 를 그대로 받는 핸들러 기술자 — 자체 파싱하거나 다른 처리기 (예: AdminPacketHandler) 로 위임.
+ * Handler 는 void(TContext&, const PacketView&) 로 호출 가능해야 한다.
+ */
+export template <std::uint16_t PacketId, auto Handler>
+struct RawPacketHandler
+{
+    static constexpr std::uint16_t kPacketId = PacketId;
+
+    template <class TContext>
+    static bool Invoke(TContext& rfContext, const PacketView& rfView)
+    {
+        std::invoke(Handler, rfContext, rfView);
+        return true;
+    }
+};
+
+
+/**
+ * PacketDispatcher
+ * 패킷 ID → 핸들러 표를 컴파일 타임에 만든다. switch 대신 2단 jump table (상위 바이트 → 256 칸 page).
+ *
+ * - 조회는 배열 2회 접근. 사용하는 상위 바이트 대역만 page 를 만든다 (page 0 은 빈 page 공용).
+ * - 중복 ID 는 static_assert.
+ * - 패킷 ID 별 호출 수 / 파싱 실패 수 / 핸들러 시간 histogram 을 relaxed atomic 으로 누적 (Snapshot).
+ *   시간 측정은 SetTimingEnabled(false) 로 끌 수 있다.
+ *
+ * 사용 예)
+ *   using Dispatcher = PacketDispatcher<MySession,
+ *       PacketHandler<PACKET_ID_ECHO, EchoRequest, &MySession::HandleEcho>,
+ *       RawPacketHandler<kPacketId_SummaryRequest, &MySession::HandleAdmin>>;
+ *   if (!Dispatcher::Dispatch(*this, rfView)) { // 미등록 ID }
+ */
+export template <class TContext, class... THandlers>
+class PacketDispatcher
+{
+    static constexpr std::size_t kHandlerCount = sizeof...(THandlers);
+    static_assert(kHandlerCount > 0, "PacketDispatcher requires at least one handler");
+
+    static constexpr std::array<std::uint16_t, kHandlerCount> kPacketIds{ THandlers::kPacketId... };
+
+    static consteval bool HasUniqueIds()
+    {
+        for (std::size_t i = 0; i < kHandlerCount; ++i)
+        {
+            for (std::size_t j = i + 1; j < kHandlerCount; ++j)
+            {
+                if (kPacketIds[i] == kPacketIds[j])
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    static_assert(HasUniqueIds(), "PacketDispatcher has duplicate packet ids");
+
+    static consteval std::size_t CountPages()
+    {
+        std::array<bool, 256> used{};
+        std::size_t count = 0;
+        for (const auto id : kPacketIds)
+        {
+            if (!used[id >> 8])
+            {
+                used[id >> 8] = true;
+                ++count;
+            }
+        }
+        return count;
+    }
+
+public:
+    // 등록된 ID 면 핸들러 호출 후 true, 아니면 false (미등록 ID 정책은 호출자 몫).
+    static bool Dispatch(TContext& rfContext, const PacketView& rfView)
+    {
+        const std::uint16_t packetId = rfView.GetPacketId();
+        const auto& rfTable = GetTable();
+        const Thunk pThunk = rfTable.Pages[rfTable.PageOf[packetId >> 8]][packetId & 0xFF];
+        if (!pThunk)
+        {
+            return false;
+        }
+
+        pThunk(rfContext, rfView);
+        return true;
+    }
+
+    static bool IsRegistered(std::uint16_t packetId) noexcept
+    {
+        const auto& rfTable = GetTable();
+        return rfTable.Pages[rfTable.PageOf[packetId >> 8]][packetId & 0xFF] != nullptr;
+    }
+
+    static void SetTimingEnabled(bool bEnabled) noexcept
+    {
+        m_bTimingEnabled.store(bEnabled, std::memory_order_relaxed);
+    }
+
+    // 등록 순서대로 패킷 ID 별 통계. 필드 간 원자성은 보장하지 않는다 (관측용).
+    static std::vector<PacketHandlerStats> Snapshot()
+    {
+        std::vector<PacketHandlerStats> out(kHandlerCount);
+        for (std::size_t i = 0; i < kHandlerCount; ++i)
+        {
+            const auto& rfCounters = CountersOf()[i];
+            out[i].PacketId = kPacketIds[i];
+            out[i].CallCount = rfCounters.Calls.load(std::memory_order_relaxed);
+            out[i].ParseFailureCount = rfCounters.ParseFailures.load(std::memory_order_relaxed);
+            for (std::size_t b = 0; b < PacketHandlerStats::kBucketCount; ++b)
+            {
+                out[i].TimeBuckets[b] = rfCounters.TimeBuckets[b].load(std::memory_order_relaxed);
+            }
+        }
+        return out;
+    }
+
+    static void ResetStats() noexcept
+    {
+        for (auto& rfCounters : CountersOf())
+        {
+            rfCounters.Calls.store(0, std::memory_order_relaxed);
+            rfCounters.ParseFailures.store(0, std::memory_order_relaxed);
+            for (auto& rfBucket : rfCounters.TimeBuckets)
+            {
+                rfBucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    using Thunk = void (*)(TContext&, const PacketView&);
+    using Clock = std::chrono::steady_clock;
+
+    struct Table
+    {
+        std::array<std::uint16_t, 256> PageOf{};
+        std::array<std::array<Thunk, 256>, CountPages() + 1> Pages{};
+    };
+
+    // 워커 간 false sharing 을 줄이도록 패킷 ID 별로 cache line 분리.
+    struct alignas(64) Counters
+    {
+        std::atomic<std::uint64_t> Calls { 0 };
+        std::atomic<std::uint64_t> ParseFailures { 0 };
+        std::array<std::atomic<std::uint64_t>, PacketHandlerStats::kBucketCount> TimeBuckets{};
+    };
+
+    static std::array<Counters, kHandlerCount>& CountersOf() noexcept
+    {
+        static std::array<Counters, kHandlerCount> counters;
+        return counters;
+    }
+
+    template <std::size_t Index>
+    static void Invoke(TContext& rfContext, const PacketView& rfView)
+    {
+        using THandler = std::tuple_element_t<Index, std::tuple<THandlers...>>;
+
+        auto& rfCounters = CountersOf()[Index];
+        rfCounters.Calls.fetch_add(1, std::memory_order_relaxed);
+
+        const bool bTiming = m_bTimingEnabled.load(std::memory_order_relaxed);
+        const auto start = bTiming ? Clock::now() : Clock::time_point{};
+
+        if (!THandler::template Invoke<TContext>(rfContext, rfView))
+        {
+            rfCounters.ParseFailures.fetch_add(1, std::memory_order_relaxed);
+            if constexpr (requires { rfContext.GetSessionId(); })
+            {
+                LibCommons::Logger::GetInstance().LogError("PacketDispatcher",
+                    "Failed to parse. Packet Id : {:#06x}, Session Id : {}", THandler::kPacketId, rfContext.GetSessionId());
+            }
+            else
+            {
+                LibCommons::Logger::GetInstance().LogError("PacketDispatcher",
+                    "Failed to parse. Packet Id : {:#06x}", THandler::kPacketId);
+            }
+        }
+
+        if (bTiming)
+        {
+            const auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+            rfCounters.TimeBuckets[PacketHandlerStats::BucketOf(static_cast<std::uint64_t>(elapsedUs))].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <std::size_t... Indices>
+    static consteval Table BuildTable(std::index_sequence<Indices...>)
+    {
+        Table table{};
+        const std::array<Thunk, kHandlerCount> thunks{ &Invoke<Indices>... };
+
+        std::uint16_t nextPage = 1;
+        for (std::size_t i = 0; i < kHandlerCount; ++i)
+        {
+            const std::size_t high = kPacketIds[i] >> 8;
+            if (table.PageOf[high] == 0)
+            {
+                table.PageOf[high] = nextPage++;
+            }
+            table.Pages[table.PageOf[high]][kPacketIds[i] & 0xFF] = thunks[i];
+        }
+        return table;
+    }
+
+    // 표는 컴파일 타임 상수 (클래스 완성 이후 평가되도록 함수 안에 둔다).
+    static const Table& GetTable() noexcept
+    {
+        static constexpr Table table = BuildTable(std::index_sequence_for<THandlers...>{});
+        return table;
+    }
+
+    inline static std::atomic<bool> m_bTimingEnabled { true };
+};
+
+} // namespace LibNetworks::Core
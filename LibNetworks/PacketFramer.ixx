@@ -2,12 +2,15 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstring>
 
 export module networks.core.packet_framer;
 
 import std;
 import networks.core.packet;
+import networks.core.packet_view;
 import commons.buffers.ibuffer;
+import commons.buffers.slab_pool;
 
 namespace LibNetworks::Core
 {
@@ -25,6 +28,14 @@ export struct PacketFrame
     std::optional<Packet> PacketOpt{};
 };
 
+export struct PacketViewFrame
+{
+    PacketFrameResult Result = PacketFrameResult::NeedMore;
+    std::optional<PacketView> ViewOpt{};
+    // 헤더 포함 프레임 전체 크기. 핸들러 반환 후 수신 버퍼에서 Consume 할 크기.
+    size_t FrameSize = 0;
+};
+
 // TCP 스트림에서 패킷 단위로 분리
 export class PacketFramer
 {
@@ -64,7 +75,7 @@ public:
             return { PacketFrameResult::NeedMore, std::nullopt };
         }
 
-        std::vector<unsigned char> buffers;
+        LibCommons::Buffers::SlabVector<unsigned char> buffers;
         buffers.resize(static_cast<size_t>(packetSize));
 
         if (!rfReceiveBuffer.Pop(std::as_writable_bytes(std::span(buffers))))
@@ -74,6 +85,107 @@ public:
 
         return { PacketFrameResult::Ok, Packet(std::move(buffers)) };
     }
+
+    // Zero-copy 프레이밍: GetReadBuffers 로 얻은 segment 들에서 offset 위치의 패킷을 뷰로 반환.
+    // 버퍼는 변경하지 않는다. 호출자가 핸들러 반환 후 FrameSize 만큼 Consume 해야 한다.
+    static PacketViewFrame TryFrameView(std::span<const std::span<const std::byte>> segments, size_t offset)
+    {
+        size_t totalReadable = 0;
+        for (const auto& segment : segments)
+        {
+            totalReadable += segment.size();
+        }
+
+        if (totalReadable < offset + Packet::GetHeaderSize())
+        {
+            return { PacketFrameResult::NeedMore, std::nullopt, 0 };
+        }
+        const size_t canRead = totalReadable - offset;
+
+        std::byte header[Packet::GetHeaderSize() + Packet::GetPacketIdSize()]{};
+        CopyFromSegments(segments, offset, std::span(header, Packet::GetHeaderSize()));
+
+        const uint16_t packetSize = Packet::GetHeaderFromBuffer(std::span<const std::byte>(header, Packet::GetHeaderSize()));
+        const size_t minPacketSize = Packet::GetHeaderSize() + Packet::GetPacketIdSize();
+
+        if (packetSize < minPacketSize)
+        {
+            return { PacketFrameResult::Invalid, std::nullopt, 0 };
+        }
+
+        if (canRead < static_cast<size_t>(packetSize))
+        {
+            return { PacketFrameResult::NeedMore, std::nullopt, 0 };
+        }
+
+        CopyFromSegments(segments, offset, std::span(header));
+        const uint16_t packetId = Packet::GetPacketIdFromBuffer(std::span<const std::byte>(header));
+
+        std::array<std::span<const std::byte>, 2> payload{};
+        if (!SliceFromSegments(segments, offset + minPacketSize, packetSize - minPacketSize, payload))
+        {
+            return { PacketFrameResult::Invalid, std::nullopt, 0 };
+        }
+
+        return { PacketFrameResult::Ok, PacketView(packetId, payload[0], payload[1]), static_cast<size_t>(packetSize) };
+    }
+
+private:
+    // 논리 위치 position 부터 out.size() 바이트를 segment 경계와 무관하게 복사 (헤더 전용, 소량).
+    static void CopyFromSegments(std::span<const std::span<const std::byte>> segments, size_t position, std::span<std::byte> out)
+    {
+        size_t copied = 0;
+        for (const auto& segment : segments)
+        {
+            if (copied == out.size())
+            {
+                break;
+            }
+
+            if (position >= segment.size())
+            {
+                position -= segment.size();
+                continue;
+            }
+
+            const size_t toCopy = std::min(segment.size() - position, out.size() - copied);
+            std::memcpy(out.data() + copied, segment.data() + position, toCopy);
+            copied += toCopy;
+            position = 0;
+        }
+    }
+
+    // 논리 구간 [position, position + length) 를 최대 2개의 span 으로 분할. 3개 이상 필요하면 false.
+    static bool SliceFromSegments(std::span<const std::span<const std::byte>> segments, size_t position, size_t length,
+        std::array<std::span<const std::byte>, 2>& outSlices)
+    {
+        size_t sliceCount = 0;
+        for (const auto& segment : segments)
+        {
+            if (length == 0)
+            {
+                break;
+            }
+
+            if (position >= segment.size())
+            {
+                position -= segment.size();
+                continue;
+            }
+
+            if (sliceCount == outSlices.size())
+            {
+                return false;
+            }
+
+            const size_t take = std::min(segment.size() - position, length);
+            outSlices[sliceCount++] = segment.subspan(position, take);
+            length -= take;
+            position = 0;
+        }
+
+        return length == 0;
+    }
 };
 
 } // namespace LibNetworks::Core
@@ -0,0 +1,114 @@
+﻿module;
+
+#include <cstdint>
+#include <cstring>
+#include <google/protobuf/io/zero_copy_stream.h>
+
+export module networks.core.packet_view;
+
+import std;
+import networks.core.packet;
+import networks.core.span_input_stream;
+
+namespace LibNetworks::Core
+{
+
+/**
+ * PacketView
+ * 수신 링버퍼 내부를 가리키는 비소유(non-owning) 패킷 뷰.
+ *
+ * [HEADER]        [PAYLOAD]
+ * [2 bytes - Size][2 bytes - Packet ID][N bytes - Payload]
+ *
+ * - Payload 는 링버퍼 Wrap 지점에서 최대 2개의 segment 로 나뉠 수 있다.
+ * - 유효 기간: OnPacketViewReceived 핸들러가 반환할 때까지 (반환 후 세션이 Consume).
+ *   핸들러 밖으로 데이터를 보관하려면 ToOwned() 로 Packet 을 만들어야 한다.
+ */
+export class PacketView
+{
+public:
+    PacketView() = delete;
+
+    PacketView(uint16_t packetId, std::span<const std::byte> first, std::span<const std::byte> second = {}) noexcept
+        : m_PacketId(packetId), m_Segments{ first, second }
+    {
+        if (m_Segments[0].empty())
+        {
+            m_Segments[0] = m_Segments[1];
+            m_Segments[1] = {};
+        }
+    }
+
+    // 소유 Packet 의 Payload 를 가리키는 뷰 (Packet 수명 동안 유효).
+    static PacketView FromPacket(const Packet& rfPacket) noexcept
+    {
+        const auto raw = rfPacket.GetRawSpan();
+        const size_t headerSize = Packet::GetHeaderSize() + Packet::GetPacketIdSize();
+        return PacketView(rfPacket.GetPacketId(), raw.size() > headerSize ? raw.subspan(headerSize) : std::span<const std::byte>{});
+    }
+
+    uint16_t GetPacketId() const noexcept { return m_PacketId; }
+
+    size_t GetPayloadSize() const noexcept { return m_Segments[0].size() + m_Segments[1].size(); }
+
+    size_t GetPacketSize() const noexcept { return GetPayloadSize() + Packet::GetHeaderSize() + Packet::GetPacketIdSize(); }
+
+    // Payload 가 하나의 연속 메모리인지 여부.
+    bool IsContiguous() const noexcept { return m_Segments[1].empty(); }
+
+    // Payload segment 목록 (0~2개, 빈 segment 제외).
+    std::span<const std::span<const std::byte>> GetSegments() const noexcept
+    {
+        const size_t count = m_Segments[0].empty() ? 0 : (m_Segments[1].empty() ? 1 : 2);
+        return std::span<const std::span<const std::byte>>(m_Segments.data(), count);
+    }
+
+    // Payload 를 outBuffer 로 복사. outBuffer 크기가 부족하면 false.
+    bool CopyPayloadTo(std::span<std::byte> outBuffer) const noexcept
+    {
+        if (outBuffer.size() < GetPayloadSize())
+        {
+            return false;
+        }
+
+        size_t offset = 0;
+        for (const auto& segment : GetSegments())
+        {
+            std::memcpy(outBuffer.data() + offset, segment.data(), segment.size());
+            offset += segment.size();
+        }
+        return true;
+    }
+
+    // 소유권 있는 Packet 으로 복사. 핸들러 반환 이후에도 데이터가 필요할 때만 사용.
+    Packet ToOwned() const
+    {
+        if (IsContiguous())
+        {
+            return Packet(m_PacketId, m_Segments[0]);
+        }
+
+        std::string payload(GetPayloadSize(), '\0');
+        CopyPayloadTo(std::as_writable_bytes(std::span(payload)));
+        return Packet(m_PacketId, std::move(payload));
+    }
+
+    template<class T>
+    bool ParseMessage(T& outMessage) const
+    {
+        if (IsContiguous())
+        {
+            return outMessage.ParseFromArray(m_Segments[0].data(), static_cast<int>(m_Segments[0].size()));
+        }
+
+        // Wrap 지점에 걸친 Payload — 임시 버퍼 없이 segment 를 순회하며 파싱.
+        SpanInputStream stream(GetSegments());
+        return outMessage.ParseFromZeroCopyStream(&stream);
+    }
+
+private:
+    uint16_t m_PacketId = 0;
+    std::array<std::span<const std::byte>, 2> m_Segments{};
+};
+
+} // namespace LibNetworks::Core
@@ -0,0 +1,128 @@
+﻿module;
+
+#include <cstdint>
+
+export module networks.core.send_flush_batch;
+
+import std;
+
+namespace LibNetworks::Core
+{
+
+// 완료 배치 종료 시점까지 송신 flush 를 미룰 수 있는 대상 (IOSession 등).
+export class IDeferredSendFlush
+{
+public:
+    virtual ~IDeferredSendFlush() = default;
+
+    // 지연된 송신을 실제로 post 한다. Defer 를 받은 워커 스레드에서 호출된다.
+    virtual void FlushDeferredSend() = 0;
+};
+
+/**
+ * SendFlushBatch
+ * 워커 스레드 단위(thread_local) 지연 flush 목록.
+ *
+ * - SendFlushBatchScope 로 활성화된 완료 처리 워커 스레드에서만 Defer 가능.
+ *   그 외 스레드(타이머, 사용자 스레드)에서는 Defer 가 false → 호출자가 즉시 flush 한다.
+ * - 워커는 완료 1건 처리 후 FlushExpired(), 대기 중인 완료가 없으면(배치 종료) FlushAll() 호출.
+ * - 중복 등록 방지는 호출자 책임 (세션이 자체 플래그로 관리).
+ */
+export class SendFlushBatch
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static bool IsActive() noexcept { return State().bActive; }
+
+    static bool HasPending() noexcept { return !State().Entries.empty(); }
+
+    // deadline 까지 flush 를 미룬다. 현재 스레드에 활성 배치가 없으면 false.
+    static bool Defer(std::shared_ptr<IDeferredSendFlush> pTarget, Clock::time_point deadline)
+    {
+        auto& state = State();
+        if (!state.bActive || !pTarget)
+        {
+            return false;
+        }
+
+        state.Entries.push_back({ std::move(pTarget), deadline });
+        return true;
+    }
+
+    // deadline 이 지난 대상만 flush.
+    static void FlushExpired(Clock::time_point now = Clock::now())
+    {
+        auto& entries = State().Entries;
+        if (entries.empty())
+        {
+            return;
+        }
+
+        // FlushDeferredSend 내부에서 다시 Defer 될 수 있으므로 목록에서 분리한 뒤 실행.
+        std::vector<std::shared_ptr<IDeferredSendFlush>> expired;
+        std::erase_if(entries, [&](Entry& rfEntry)
+            {
+                if (rfEntry.Deadline > now)
+                {
+                    return false;
+                }
+                expired.push_back(std::move(rfEntry.pTarget));
+                return true;
+            });
+
+        for (auto& pTarget : expired)
+        {
+            pTarget->FlushDeferredSend();
+        }
+    }
+
+    // 배치 종료 — 남은 대상을 모두 flush.
+    static void FlushAll()
+    {
+        auto entries = std::exchange(State().Entries, {});
+        for (auto& entry : entries)
+        {
+            entry.pTarget->FlushDeferredSend();
+        }
+    }
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<IDeferredSendFlush> pTarget;
+        Clock::time_point Deadline;
+    };
+
+    struct ThreadState
+    {
+        bool bActive = false;
+        std::vector<Entry> Entries;
+    };
+
+    static ThreadState& State() noexcept
+    {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    friend class SendFlushBatchScope;
+};
+
+// 워커 스레드 루프 전체를 감싸는 RAII. 소멸 시 남은 지연 flush 를 모두 처리한다.
+export class SendFlushBatchScope
+{
+public:
+    SendFlushBatchScope() noexcept { SendFlushBatch::State().bActive = true; }
+
+    ~SendFlushBatchScope()
+    {
+        SendFlushBatch::FlushAll();
+        SendFlushBatch::State().bActive = false;
+    }
+
+    SendFlushBatchScope(const SendFlushBatchScope&) = delete;
+    SendFlushBatchScope& operator=(const SendFlushBatchScope&) = delete;
+};
+
+} // namespace LibNetworks::Core
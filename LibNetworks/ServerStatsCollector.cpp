@@ -86,6 +86,11 @@ SummaryData ServerStatsCollector::SnapshotSummary() const
         if (!pSession) continue;
         out.totalRxBytes += pSession->GetTotalRxBytes();
         out.totalTxBytes += pSession->GetTotalTxBytes();
+        out.sessionBufferBytes += pSession->GetBufferBytes();
+    }
+    if (out.activeSessionCount > 0)
+    {
+        out.bytesPerSession = out.sessionBufferBytes / out.activeSessionCount;
     }
 
     // Idle disconnect 카운트.
@@ -105,6 +110,8 @@ SummaryData ServerStatsCollector::SnapshotSummary() const
         out.processMemoryBytes = m_pSampler->SnapshotMemoryBytes();
     }
 
+    out.completionBatches = Core::CompletionBatchStats::Snapshot();
+
     return out;
 }
 
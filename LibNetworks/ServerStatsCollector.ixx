@@ -13,6 +13,7 @@ export module networks.stats.server_stats_collector;
 import std;
 import networks.sessions.isession_stats;
 import networks.stats.stats_sampler;
+import networks.core.completion_batch_stats;
 
 
 namespace LibNetworks::Stats
@@ -39,6 +40,11 @@ export struct SummaryData
     std::uint64_t processMemoryBytes  = 0;
     double        processCpuPercent   = 0.0;
     std::int64_t  serverTimestampMs   = 0;  // Unix epoch ms (시계 동기용)
+    std::uint64_t sessionBufferBytes  = 0;  // 전체 세션이 붙들고 있는 송수신 버퍼 합
+    std::uint64_t bytesPerSession     = 0;  // sessionBufferBytes / activeSessionCount
+
+    // 워커 wake 1회당 꺼낸 완료 수 분포 (GQCSEx 1회 기준).
+    Core::CompletionBatchHistogram completionBatches;
 };
 
 
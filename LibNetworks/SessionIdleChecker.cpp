@@ -10,6 +10,10 @@
 //      - 각 IIdleAware: last==0 skip, elapsed >= threshold 면 RequestDisconnect(IdleTimeout)
 //      - RequestDisconnect 예외도 catch-all (한 세션 오류가 다른 세션 처리 막지 않음)
 //   3. Stop: m_Running=false + TimerQueue::Cancel(wait=true) → 진행 중 tick 완료 대기.
+//   4. deadline 추적 모드 (Provider 없음):
+//      - Track: deadline = now + threshold 의 bucket 에 weak 참조 등록.
+//      - OnTick: 지난 tick 들의 bucket 만 꺼내 lastRecv 재확인 → 만료면 disconnect,
+//        수신이 있었으면 lastRecv + threshold 로 재등록. 활성 세션도 threshold 당 1회만 검사된다.
 //
 // 로깅: Logger "IdleChecker" 카테고리. Logger 다중 호출 ICE 방지 위해 spdlog 헤더를 GMF 에 포함
 // (CLAUDE.md 로깅 지침 준수).
@@ -48,6 +52,12 @@ inline std::int64_t NowMs() noexcept
     return std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::steady_clock::now().time_since_epoch()).count();
 }
+
+// deadline bucket 1칸 폭 (ms).
+inline std::int64_t TickMs(const IdleCheckerConfig& rfConfig) noexcept
+{
+    return (std::max<std::int64_t>)(rfConfig.tickIntervalMs.count(), 1);
+}
 } // anonymous namespace
 
 
@@ -59,6 +69,18 @@ SessionIdleChecker::SessionIdleChecker(IdleCheckerConfig cfg, SnapshotProvider p
 }
 
 
+SessionIdleChecker::SessionIdleChecker(IdleCheckerConfig cfg)
+    : m_Config(cfg)
+{
+    const auto tickMs = TickMs(m_Config);
+
+    // deadline 은 최대 now + threshold → 처리된 tick 보다 threshold/tick + 1 이상 앞설 수 없다.
+    const auto bucketCount = static_cast<std::size_t>((m_Config.thresholdMs.count() + tickMs - 1) / tickMs) + 2;
+    m_Buckets.resize(bucketCount);
+    m_ProcessedTick = NowMs() / tickMs;
+}
+
+
 // Design Ref: §6.1 Error #7/8 — 소멸 시 자동 Stop (idempotent).
 SessionIdleChecker::~SessionIdleChecker()
 {
@@ -94,8 +116,8 @@ void SessionIdleChecker::Start()
 
     m_TimerId.store(static_cast<std::uint64_t>(id), std::memory_order_release);
 
-    LogInfo(std::format("Started. ThresholdMs : {}, TickIntervalMs : {}",
-        m_Config.thresholdMs.count(), m_Config.tickIntervalMs.count()));
+    LogInfo(std::format("Started. ThresholdMs : {}, TickIntervalMs : {}, Mode : {}",
+        m_Config.thresholdMs.count(), m_Config.tickIntervalMs.count(), m_Provider ? "Snapshot" : "Deadline"));
 }
 
 
@@ -122,6 +144,40 @@ void SessionIdleChecker::Stop()
 }
 
 
+void SessionIdleChecker::Track(const std::shared_ptr<IIdleAware>& pSession)
+{
+    if (!pSession || m_Buckets.empty())
+    {
+        return;
+    }
+
+    // 등록 시점은 수신 이력이 없을 수 있으므로 now 기준 — 도래 시 lastRecv 로 다시 판정.
+    std::lock_guard<std::mutex> lock(m_BucketMutex);
+    InsertLocked(pSession, NowMs() + m_Config.thresholdMs.count());
+}
+
+
+std::size_t SessionIdleChecker::GetTrackedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_BucketMutex);
+    return m_TrackedCount;
+}
+
+
+void SessionIdleChecker::InsertLocked(std::weak_ptr<IIdleAware> pSession, std::int64_t deadlineMs)
+{
+    const auto tickMs = TickMs(m_Config);
+    const auto bucketCount = static_cast<std::int64_t>(m_Buckets.size());
+
+    // 이미 비운 tick 이면 다음 tick, ring 을 넘으면 마지막 칸 (도래 시 재판정).
+    auto tick = (deadlineMs + tickMs - 1) / tickMs;
+    tick = std::clamp(tick, m_ProcessedTick + 1, m_ProcessedTick + bucketCount - 1);
+
+    m_Buckets[static_cast<std::size_t>(tick % bucketCount)].push_back(std::move(pSession));
+    ++m_TrackedCount;
+}
+
+
 // Design Ref: §2.2 Callback flow, §6.2 Exception policy.
 void SessionIdleChecker::OnTick()
 {
@@ -131,6 +187,19 @@ void SessionIdleChecker::OnTick()
         return;
     }
 
+    if (m_Provider)
+    {
+        ScanSnapshot(NowMs());
+    }
+    else
+    {
+        ExpireDeadlines(NowMs());
+    }
+}
+
+
+void SessionIdleChecker::ScanSnapshot(std::int64_t nowMs)
+{
     // 2. 스냅샷 수집 (Provider 예외는 catch, 다음 tick 유지).
     std::vector<std::shared_ptr<IIdleAware>> snapshot;
     try
@@ -148,7 +217,6 @@ void SessionIdleChecker::OnTick()
         return;
     }
 
-    const auto   nowMs       = NowMs();
     const auto   thresholdMs = m_Config.thresholdMs.count();
 
     // 3. 각 세션 검사. 한 세션 예외가 다른 세션 처리 방해하지 않도록 per-session try/catch.
@@ -162,19 +230,101 @@ void SessionIdleChecker::OnTick()
         const auto elapsed = nowMs - last;
         if (elapsed < thresholdMs) continue;
 
-        try
+        Disconnect(*pSession);
+    }
+}
+
+
+void SessionIdleChecker::ExpireDeadlines(std::int64_t nowMs)
+{
+    const auto tickMs = TickMs(m_Config);
+    const auto nowTick = nowMs / tickMs;
+
+    // 1. 지난 tick 의 bucket 을 통째로 꺼낸다 (tick 이 밀려도 ring 1바퀴면 전부).
+    std::vector<std::weak_ptr<IIdleAware>> due;
+    {
+        std::lock_guard<std::mutex> lock(m_BucketMutex);
+
+        const auto bucketCount = static_cast<std::int64_t>(m_Buckets.size());
+        const auto steps = (std::min)(nowTick - m_ProcessedTick, bucketCount);
+        for (std::int64_t i = 1; i <= steps; ++i)
         {
-            pSession->RequestDisconnect(DisconnectReason::IdleTimeout);
-            m_DisconnectCount.fetch_add(1, std::memory_order_relaxed);
+            auto& bucket = m_Buckets[static_cast<std::size_t>((m_ProcessedTick + i) % bucketCount)];
+            if (due.empty())
+            {
+                due.swap(bucket);
+            }
+            else
+            {
+                std::move(bucket.begin(), bucket.end(), std::back_inserter(due));
+                bucket.clear();
+            }
         }
-        catch (const std::exception& e)
+
+        m_ProcessedTick = (std::max)(m_ProcessedTick, nowTick);
+        m_TrackedCount -= due.size();
+    }
+
+    if (due.empty())
+    {
+        return;
+    }
+
+    // 2. 꺼낸 세션만 lastRecv 재확인. 락 밖에서 — RequestDisconnect 가 세션 정리 경로를 탈 수 있다.
+    const auto thresholdMs = m_Config.thresholdMs.count();
+
+    std::vector<std::pair<std::weak_ptr<IIdleAware>, std::int64_t>> requeue;
+    requeue.reserve(due.size());
+
+    for (auto& pWeak : due)
+    {
+        auto pSession = pWeak.lock();
+        if (!pSession) continue;  // 해제된 세션 — 추적 종료
+
+        const auto last = pSession->GetLastRecvTimeMs();
+        if (last == 0)
         {
-            LogError(std::format("RequestDisconnect threw: {}", e.what()));
+            // 아직 수신 이력 없음 — 연결 직후 세션. threshold 뒤 다시 확인.
+            requeue.emplace_back(std::move(pWeak), nowMs + thresholdMs);
+            continue;
         }
-        catch (...)
+
+        if (nowMs - last < thresholdMs)
         {
-            LogError("RequestDisconnect threw unknown");
+            requeue.emplace_back(std::move(pWeak), last + thresholdMs);
+            continue;
         }
+
+        // disconnect 요청한 세션은 추적에서 뺀다 (중복 요청 / 카운트 방지).
+        Disconnect(*pSession);
+    }
+
+    // 3. 살아 있는 세션은 새 deadline 으로 재등록.
+    if (!requeue.empty())
+    {
+        std::lock_guard<std::mutex> lock(m_BucketMutex);
+        for (auto& [pWeak, deadlineMs] : requeue)
+        {
+            InsertLocked(std::move(pWeak), deadlineMs);
+        }
+    }
+}
+
+
+void SessionIdleChecker::Disconnect(IIdleAware& rfSession)
+{
+    try
+    {
+        rfSession.RequestDisconnect(DisconnectReason::IdleTimeout);
+        m_DisconnectCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    catch (const std::exception& e)
+    {
+        LogError(std::format("RequestDisconnect threw: {}", e.what()));
+    }
+    catch (...)
+    {
+        LogError("RequestDisconnect threw unknown");
     }
 }
 
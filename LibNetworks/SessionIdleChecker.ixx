@@ -6,6 +6,8 @@
 //   - TimerQueue::GetInstance() 에 periodic tick 을 등록.
 //   - SnapshotProvider 콜백을 통해 IIdleAware 세션 스냅샷 수집 (타입 불변 non-template).
 //   - threshold 초과한 세션에 RequestDisconnect(IdleTimeout) 호출.
+//   - Provider 없이 생성하면 deadline 추적 모드 — 세션은 Track 으로 등록하고, deadline
+//     (lastRecv + threshold) 별 bucket 에 걸린다. tick 은 deadline 이 도래한 bucket 만 검사.
 //
 // Thread-safety:
 //   - Start/Stop 은 소유자(단일 스레드)에서 호출.
@@ -43,6 +45,10 @@ public:
     using SnapshotProvider = std::function<std::vector<std::shared_ptr<IIdleAware>>()>;
 
     SessionIdleChecker(IdleCheckerConfig cfg, SnapshotProvider provider);
+
+    // deadline 추적 모드. 세션은 연결 직후 Track 으로 등록.
+    explicit SessionIdleChecker(IdleCheckerConfig cfg);
+
     ~SessionIdleChecker();
 
     SessionIdleChecker(const SessionIdleChecker&)            = delete;
@@ -60,6 +66,14 @@ public:
     // 현재 설정 조회 (immutable).
     const IdleCheckerConfig& GetConfig() const noexcept { return m_Config; }
 
+    // deadline 추적 모드에서 세션 등록. 연결 직후 1회 (수신 경로는 lastRecv atomic 갱신만).
+    // weak 참조로 보관 — 해제된 세션은 자기 deadline bucket 이 도래할 때 빠진다.
+    // Thread-safety: 다중 스레드에서 동시 호출 가능.
+    void Track(const std::shared_ptr<IIdleAware>& pSession);
+
+    // deadline 추적 모드에서 bucket 에 걸린 세션 수 (해제된 세션이 검사 전까지 포함될 수 있음).
+    std::size_t GetTrackedCount() const;
+
     // 지금까지 idle 로 disconnect 요청한 세션 수 (누적, 관측용).
     std::uint64_t GetDisconnectCount() const noexcept
     {
@@ -70,8 +84,27 @@ private:
     // TimerQueue tick 콜백 본체. Start 에서 람다 캡처로 호출.
     void OnTick();
 
+    // Provider 모드 — 스냅샷 전체 검사.
+    void ScanSnapshot(std::int64_t nowMs);
+
+    // deadline 추적 모드 — 도래한 bucket 만 검사, 아직 살아 있는 세션은 새 deadline 으로 재등록.
+    void ExpireDeadlines(std::int64_t nowMs);
+
+    // deadline 을 bucket tick 으로 (올림 — 도래 시점에는 deadline 이 지나 있다). m_BucketMutex 보유 상태.
+    void InsertLocked(std::weak_ptr<IIdleAware> pSession, std::int64_t deadlineMs);
+
+    // 세션 1개 idle 판정 + RequestDisconnect. 예외는 삼킨다.
+    void Disconnect(IIdleAware& rfSession);
+
     IdleCheckerConfig               m_Config;
     SnapshotProvider                m_Provider;
+
+    // deadline bucket ring — index = (deadline tick) % size. size 는 threshold / tick + 여유.
+    mutable std::mutex                                    m_BucketMutex;
+    std::vector<std::vector<std::weak_ptr<IIdleAware>>>   m_Buckets;
+    std::int64_t                                          m_ProcessedTick   { 0 };  // 마지막으로 비운 tick
+    std::size_t                                           m_TrackedCount    { 0 };
+
     std::atomic<std::uint64_t>      m_TimerId         { 0 };  // 0 = kInvalidTimerId
     std::atomic<bool>               m_Running         { false };
     std::atomic<std::uint64_t>      m_DisconnectCount { 0 };
@@ -0,0 +1,150 @@
+﻿// SessionPool.ixx
+// -----------------------------------------------------------------------------
+// 세션 객체 재사용 풀 — accept 가 몰리는 부하에서 세션/링 버퍼 할당 해제를 반복하지 않도록
+// 종료된 세션을 free list 에 보관했다가 다음 accept 에 되살린다.
+//
+// 동작:
+//   - Acquire 는 free list 에서 꺼내 fnReset 으로 초기화 (hit), 비어 있으면 fnCreate 로 생성 (miss).
+//   - 반환되는 shared_ptr 의 deleter 가 Release 로 돌려준다. 마지막 참조가 사라지는 시점은
+//     TryFireOnDisconnected 이후 (세션 목록 / 완료 guard 가 모두 놓은 뒤) 이다.
+//   - outstanding I/O 가 남은 세션 / free list 가 maxIdle 에 도달한 경우는 그대로 delete.
+//   - 풀이 먼저 소멸하면 deleter 는 delete 로 폴백 (weak_ptr 로 풀 참조).
+//
+// Thread-safety:
+//   - Acquire / Release 는 임의 스레드 (accept 워커 / IOCP 워커) 에서 호출. free list 는 mutex 보호.
+//   - fnReset / 세션 delete 는 락 밖에서 수행.
+// -----------------------------------------------------------------------------
+module;
+
+#include <cstdint>
+
+export module networks.sessions.session_pool;
+
+import std;
+import networks.sessions.io_session;
+
+
+namespace LibNetworks::Sessions
+{
+
+// 풀 통계 스냅샷. Hits + Misses = 누적 Acquire 수.
+export struct SessionPoolStats
+{
+    std::uint64_t Hits      = 0;   // free list 에서 재사용
+    std::uint64_t Misses    = 0;   // 새로 생성
+    std::uint64_t Recycled  = 0;   // free list 로 반환
+    std::uint64_t Discarded = 0;   // 반환 불가 (outstanding I/O / 풀 가득 참) → delete
+    std::size_t   Idle      = 0;   // 현재 free list 크기
+};
+
+
+export template<typename TSession>
+    requires std::derived_from<TSession, IOSession>
+class SessionPool : public std::enable_shared_from_this<SessionPool<TSession>>
+{
+public:
+    // 반드시 shared_ptr 로 생성 (deleter 가 weak_ptr 로 풀을 참조).
+    static std::shared_ptr<SessionPool> Create(std::size_t maxIdle)
+    {
+        return std::shared_ptr<SessionPool>(new SessionPool(maxIdle));
+    }
+
+    SessionPool(const SessionPool&) = delete;
+    SessionPool& operator=(const SessionPool&) = delete;
+
+    // fnCreate : () -> std::unique_ptr<TSession>  (miss)
+    // fnReset  : (TSession&) -> void              (hit, 새 소켓/상태로 초기화)
+    template<typename FnCreate, typename FnReset>
+    std::shared_ptr<TSession> Acquire(FnCreate&& fnCreate, FnReset&& fnReset)
+    {
+        std::unique_ptr<TSession> pSession;
+        {
+            std::lock_guard lock(m_Mutex);
+            if (!m_Idle.empty())
+            {
+                pSession = std::move(m_Idle.back());
+                m_Idle.pop_back();
+            }
+        }
+
+        if (pSession)
+        {
+            m_Hits.fetch_add(1, std::memory_order_relaxed);
+            fnReset(*pSession);
+        }
+        else
+        {
+            m_Misses.fetch_add(1, std::memory_order_relaxed);
+            pSession = fnCreate();
+            if (!pSession)
+            {
+                return nullptr;
+            }
+        }
+
+        std::weak_ptr<SessionPool> wpPool = this->weak_from_this();
+        return std::shared_ptr<TSession>(pSession.release(), [wpPool](TSession* pRaw)
+            {
+                if (auto pPool = wpPool.lock())
+                {
+                    pPool->Release(pRaw);
+                    return;
+                }
+                delete pRaw;
+            });
+    }
+
+    SessionPoolStats GetStats() const
+    {
+        SessionPoolStats stats;
+        stats.Hits      = m_Hits.load(std::memory_order_relaxed);
+        stats.Misses    = m_Misses.load(std::memory_order_relaxed);
+        stats.Recycled  = m_Recycled.load(std::memory_order_relaxed);
+        stats.Discarded = m_Discarded.load(std::memory_order_relaxed);
+
+        std::lock_guard lock(m_Mutex);
+        stats.Idle = m_Idle.size();
+        return stats;
+    }
+
+    std::size_t GetMaxIdle() const noexcept { return m_MaxIdle; }
+
+private:
+    explicit SessionPool(std::size_t maxIdle) : m_MaxIdle(maxIdle)
+    {
+        m_Idle.reserve(maxIdle);
+    }
+
+    void Release(TSession* pRaw)
+    {
+        // 락 해제 뒤 소멸되도록 락보다 먼저 선언.
+        std::unique_ptr<TSession> pSession(pRaw);
+        if (!pSession->IsReusable())
+        {
+            m_Discarded.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::lock_guard lock(m_Mutex);
+        if (m_Idle.size() >= m_MaxIdle)
+        {
+            m_Discarded.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_Idle.push_back(std::move(pSession));
+        m_Recycled.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    const std::size_t m_MaxIdle;
+
+    mutable std::mutex m_Mutex;
+    std::vector<std::unique_ptr<TSession>> m_Idle;
+
+    std::atomic<std::uint64_t> m_Hits { 0 };
+    std::atomic<std::uint64_t> m_Misses { 0 };
+    std::atomic<std::uint64_t> m_Recycled { 0 };
+    std::atomic<std::uint64_t> m_Discarded { 0 };
+};
+
+} // namespace LibNetworks::Sessions
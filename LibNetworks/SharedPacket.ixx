@@ -0,0 +1,74 @@
+﻿module;
+
+#include <cstdint>
+#include <google/protobuf/message.h>
+
+export module networks.core.shared_packet;
+
+import std;
+import commons.buffers.slab_pool;
+import networks.core.packet;
+import networks.core.span_output_stream;
+
+namespace LibNetworks::Core
+{
+
+/**
+ * SharedPacket
+ * 한 번 직렬화한 패킷 프레임 ([Size][Packet ID][Payload]) 을 여러 세션이 참조로 공유한다.
+ *
+ * - 브로드캐스트 시 ByteSizeLong / 직렬화는 1회, 세션마다 복사하지 않는다 (IOSession 은 gather-send 로 참조 송신).
+ * - 프레임은 불변. 세션은 송신 완료 시점까지 참조를 들고 있다가 놓는다 — 마지막 참조가 해제할 때 반환.
+ * - 기본 생성 / 직렬화 실패는 빈 패킷 (IsValid() == false).
+ *
+ * [Thread Safety] 복사 / 소멸은 임의 스레드에서 가능 (shared_ptr 참조 카운트). 내용은 읽기 전용.
+ */
+export class SharedPacket
+{
+public:
+    SharedPacket() = default;
+
+    // 헤더 + Protobuf Body 를 단일 프레임으로 직렬화.
+    static SharedPacket Serialize(const uint16_t packetId, const google::protobuf::Message& rfMessage)
+    {
+        const size_t bodySize = rfMessage.ByteSizeLong();
+        const size_t totalSize = Packet::GetHeaderSize() + Packet::GetPacketIdSize() + bodySize;
+        if (totalSize > (std::numeric_limits<uint16_t>::max)())
+        {
+            return {};
+        }
+
+        auto pFrame = std::make_shared<Frame>(totalSize);
+        const std::span<std::byte> segment(*pFrame);
+        if (!SerializePacketToSpans(std::span<const std::span<std::byte>>(&segment, 1), packetId, rfMessage, bodySize))
+        {
+            return {};
+        }
+
+        return SharedPacket(std::move(pFrame));
+    }
+
+    bool IsValid() const noexcept { return m_pFrame != nullptr; }
+
+    std::span<const std::byte> GetBytes() const noexcept
+    {
+        return m_pFrame ? std::span<const std::byte>(*m_pFrame) : std::span<const std::byte>{};
+    }
+
+    size_t GetSize() const noexcept { return m_pFrame ? m_pFrame->size() : 0; }
+
+    // 이 프레임을 참조 중인 SharedPacket 수 (송신 대기 중인 세션 포함). 진단/테스트용.
+    long GetShareCount() const noexcept { return m_pFrame.use_count(); }
+
+private:
+    using Frame = LibCommons::Buffers::SlabVector<std::byte>;
+
+    explicit SharedPacket(std::shared_ptr<const Frame> pFrame) noexcept
+        : m_pFrame(std::move(pFrame))
+    {
+    }
+
+    std::shared_ptr<const Frame> m_pFrame{};
+};
+
+} // namespace LibNetworks::Core
@@ -0,0 +1,107 @@
+﻿module;
+
+#include <cstdint>
+#include <google/protobuf/io/zero_copy_stream.h>
+
+export module networks.core.span_input_stream;
+
+import std;
+
+namespace LibNetworks::Core
+{
+
+/**
+ * SpanInputStream
+ * 비연속 메모리 segment 목록(IBuffer::GetReadBuffers, PacketView::GetSegments)을
+ * protobuf ZeroCopyInputStream 으로 노출하는 어댑터.
+ *
+ * - segment 데이터를 복사하지 않는다. Next() 는 segment 내부 포인터를 그대로 반환.
+ * - segment 목록과 가리키는 메모리는 스트림 사용이 끝날 때까지 유효해야 한다.
+ *
+ * 사용 예)
+ *   SpanInputStream stream(view.GetSegments());
+ *   message.ParseFromZeroCopyStream(&stream);
+ */
+export class SpanInputStream final : public google::protobuf::io::ZeroCopyInputStream
+{
+public:
+    explicit SpanInputStream(std::span<const std::span<const std::byte>> segments) noexcept
+        : m_Segments(segments)
+    {
+    }
+
+    SpanInputStream(const SpanInputStream&) = delete;
+    SpanInputStream& operator=(const SpanInputStream&) = delete;
+
+    bool Next(const void** data, int* size) override
+    {
+        while (m_SegmentIndex < m_Segments.size())
+        {
+            const auto& segment = m_Segments[m_SegmentIndex];
+            if (m_SegmentOffset < segment.size())
+            {
+                const size_t remaining = segment.size() - m_SegmentOffset;
+                const size_t chunk = std::min(remaining, static_cast<size_t>(std::numeric_limits<int>::max()));
+
+                *data = segment.data() + m_SegmentOffset;
+                *size = static_cast<int>(chunk);
+
+                m_SegmentOffset += chunk;
+                m_ByteCount += static_cast<std::int64_t>(chunk);
+                m_LastChunkSize = chunk;
+                return true;
+            }
+
+            ++m_SegmentIndex;
+            m_SegmentOffset = 0;
+        }
+
+        m_LastChunkSize = 0;
+        return false;
+    }
+
+    // 직전 Next() 로 받은 chunk 의 끝에서 count 바이트를 되돌린다 (protobuf 계약상 직전 chunk 범위 내).
+    void BackUp(int count) override
+    {
+        const size_t backUp = std::min(static_cast<size_t>(count), m_LastChunkSize);
+        m_SegmentOffset -= backUp;
+        m_ByteCount -= static_cast<std::int64_t>(backUp);
+        m_LastChunkSize = 0;
+    }
+
+    bool Skip(int count) override
+    {
+        m_LastChunkSize = 0;
+
+        size_t toSkip = static_cast<size_t>(count);
+        while (toSkip > 0 && m_SegmentIndex < m_Segments.size())
+        {
+            const auto& segment = m_Segments[m_SegmentIndex];
+            const size_t remaining = segment.size() - m_SegmentOffset;
+            if (toSkip < remaining)
+            {
+                m_SegmentOffset += toSkip;
+                m_ByteCount += static_cast<std::int64_t>(toSkip);
+                return true;
+            }
+
+            toSkip -= remaining;
+            m_ByteCount += static_cast<std::int64_t>(remaining);
+            ++m_SegmentIndex;
+            m_SegmentOffset = 0;
+        }
+
+        return toSkip == 0;
+    }
+
+    std::int64_t ByteCount() const override { return m_ByteCount; }
+
+private:
+    std::span<const std::span<const std::byte>> m_Segments{};
+    size_t m_SegmentIndex = 0;
+    size_t m_SegmentOffset = 0;
+    size_t m_LastChunkSize = 0;
+    std::int64_t m_ByteCount = 0;
+};
+
+} // namespace LibNetworks::Core
@@ -0,0 +1,148 @@
+﻿module;
+
+#include <cstdint>
+#include <cstring>
+#include <WinSock2.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+
+export module networks.core.span_output_stream;
+
+import std;
+import networks.core.packet;
+
+namespace LibNetworks::Core
+{
+
+/**
+ * SpanOutputStream
+ * 송신 버퍼에서 예약한 segment 목록(IBuffer::AllocateWrite 결과)을
+ * protobuf ZeroCopyOutputStream 으로 노출하는 어댑터.
+ *
+ * - Next() 는 segment 내부 포인터를 그대로 반환 → 직렬화 결과가 송신 버퍼에 한 번만 기록된다.
+ * - 예약 영역(segment 총합)을 넘어서 쓰지 않는다. 초과 시 Next() 가 false.
+ */
+export class SpanOutputStream final : public google::protobuf::io::ZeroCopyOutputStream
+{
+public:
+    explicit SpanOutputStream(std::span<const std::span<std::byte>> segments) noexcept
+        : m_Segments(segments)
+    {
+    }
+
+    SpanOutputStream(const SpanOutputStream&) = delete;
+    SpanOutputStream& operator=(const SpanOutputStream&) = delete;
+
+    bool Next(void** data, int* size) override
+    {
+        while (m_SegmentIndex < m_Segments.size())
+        {
+            const auto& segment = m_Segments[m_SegmentIndex];
+            if (m_SegmentOffset < segment.size())
+            {
+                const size_t remaining = segment.size() - m_SegmentOffset;
+                const size_t chunk = std::min(remaining, static_cast<size_t>(std::numeric_limits<int>::max()));
+
+                *data = segment.data() + m_SegmentOffset;
+                *size = static_cast<int>(chunk);
+
+                m_SegmentOffset += chunk;
+                m_ByteCount += static_cast<std::int64_t>(chunk);
+                m_LastChunkSize = chunk;
+                return true;
+            }
+
+            ++m_SegmentIndex;
+            m_SegmentOffset = 0;
+        }
+
+        m_LastChunkSize = 0;
+        return false;
+    }
+
+    // 직전 Next() 로 받은 chunk 중 쓰지 않은 끝부분 count 바이트를 반환한다.
+    void BackUp(int count) override
+    {
+        const size_t backUp = std::min(static_cast<size_t>(count), m_LastChunkSize);
+        m_SegmentOffset -= backUp;
+        m_ByteCount -= static_cast<std::int64_t>(backUp);
+        m_LastChunkSize = 0;
+    }
+
+    std::int64_t ByteCount() const override { return m_ByteCount; }
+
+    // segment 경계와 무관하게 raw 바이트 기록 (패킷 헤더 등 소량 데이터용).
+    bool WriteRaw(const void* pData, size_t size)
+    {
+        const auto* pSrc = static_cast<const std::byte*>(pData);
+        while (size > 0)
+        {
+            void* pChunk = nullptr;
+            int chunkSize = 0;
+            if (!Next(&pChunk, &chunkSize))
+            {
+                return false;
+            }
+
+            const size_t toCopy = std::min(size, static_cast<size_t>(chunkSize));
+            std::memcpy(pChunk, pSrc, toCopy);
+            BackUp(chunkSize - static_cast<int>(toCopy));
+
+            pSrc += toCopy;
+            size -= toCopy;
+        }
+        return true;
+    }
+
+private:
+    std::span<const std::span<std::byte>> m_Segments{};
+    size_t m_SegmentIndex = 0;
+    size_t m_SegmentOffset = 0;
+    size_t m_LastChunkSize = 0;
+    std::int64_t m_ByteCount = 0;
+};
+
+// 패킷 헤더([Size][Packet ID]) + protobuf Body 를 예약 segment 에 직접 직렬화.
+// segments 총합은 Packet::GetHeaderSize() + Packet::GetPacketIdSize() + bodySize 여야 한다.
+// Body 가 남은 연속 공간에 들어가면 SerializeToArray, Wrap 지점에 걸치면 SpanOutputStream 경유.
+export inline bool SerializePacketToSpans(std::span<const std::span<std::byte>> segments,
+    const uint16_t packetId, const google::protobuf::Message& rfMessage, const size_t bodySize)
+{
+    const size_t totalSize = Packet::GetHeaderSize() + Packet::GetPacketIdSize() + bodySize;
+
+    SpanOutputStream stream(segments);
+
+    const uint16_t sizeNet = htons(static_cast<uint16_t>(totalSize));
+    const uint16_t idNet = htons(packetId);
+    if (!stream.WriteRaw(&sizeNet, sizeof(sizeNet)) || !stream.WriteRaw(&idNet, sizeof(idNet)))
+    {
+        return false;
+    }
+
+    if (bodySize == 0)
+    {
+        return true;
+    }
+
+    void* pChunk = nullptr;
+    int chunkSize = 0;
+    if (!stream.Next(&pChunk, &chunkSize))
+    {
+        return false;
+    }
+
+    if (static_cast<size_t>(chunkSize) >= bodySize)
+    {
+        return rfMessage.SerializeToArray(pChunk, static_cast<int>(bodySize));
+    }
+
+    stream.BackUp(chunkSize);
+    if (!rfMessage.SerializeToZeroCopyStream(&stream))
+    {
+        return false;
+    }
+
+    return static_cast<size_t>(stream.ByteCount()) == totalSize;
+}
+
+} // namespace LibNetworks::Core
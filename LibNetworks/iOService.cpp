@@ -1,18 +1,60 @@
 ﻿module;
 
 #include <Windows.h>
+#include <winternl.h>
 #include <spdlog/spdlog.h>
+#pragma comment(lib, "ntdll.lib") // RtlNtStatusToDosError
 module networks.services.io_service;
 
 import commons.logger;
 import commons.rwlock; 
+import commons.thread_affinity;
 import networks.core.io_consumer;
+import networks.core.io_operation;
+import networks.core.send_flush_batch;
+import networks.core.completion_batch_stats;
 
 namespace LibNetworks::Services
 {
 
+namespace
+{
+// completion / accept 마다 도는 경로 전용. 시작 / 종료 로그는 이름 카테고리 그대로.
+constinit LibCommons::HotPathLogCategory s_HotPathLogCategory{ "IOService" };
+
+// GQCS 결과 → 플랫폼 중립 완료 통지. 에러 코드는 GQCS 직후 캡처한 값을 그대로 전달한다.
+void DispatchCompletion(ULONG_PTR completionId, bool bSuccess, DWORD bytesTransferred, OVERLAPPED* pOverlapped, DWORD dwError)
+{
+    auto pConsumer = reinterpret_cast<Core::IIOConsumer*>(completionId);
+    if (!pConsumer)
+    {
+        return;
+    }
+
+    Core::IoCompletion completion{};
+    completion.pOperation = Core::IoOperation::FromOverlapped(pOverlapped);
+    completion.bSuccess = bSuccess;
+    completion.BytesTransferred = bytesTransferred;
+    completion.ErrorCode = bSuccess ? 0 : static_cast<int>(dwError);
+    pConsumer->OnIOCompleted(completion);
+}
+
+// GQCSEx 항목은 OVERLAPPED::Internal 에 NTSTATUS 를 남긴다 — GQCS 와 같은 Win32 에러 코드로 변환.
+DWORD GetEntryError(const OVERLAPPED_ENTRY& rfEntry)
+{
+    if (!rfEntry.lpOverlapped)
+    {
+        return ERROR_SUCCESS;
+    }
+
+    const auto status = static_cast<NTSTATUS>(rfEntry.lpOverlapped->Internal);
+    return status >= 0 ? ERROR_SUCCESS : ::RtlNtStatusToDosError(status);
+}
+}
+
 
 IOService::IOService()
+    : m_CompletionBatchSize(m_DefaultCompletionBatchSize.load(std::memory_order_relaxed))
 {
 
 }
@@ -38,63 +80,98 @@ bool IOService::Start(uint32_t threadCount)
 
     m_bTerminated.store(false, std::memory_order_release);
 
-    auto fDoWorker = [this, &logger]()
+    auto fDoWorker = [this, &logger, batchSize = m_CompletionBatchSize](std::uint32_t workerIndex)
         {
+            if (m_FirstWorkerProcessor && !LibCommons::ThreadAffinity::PinCurrentThread(*m_FirstWorkerProcessor + workerIndex))
+            {
+                logger.LogWarning("IOService", "Worker thread, Failed to pin processor. Index : {}, Error : {}", *m_FirstWorkerProcessor + workerIndex, ::GetLastError());
+            }
+
+            // 세션 송신 flush 지연(adaptive) 대상 목록 — 완료 배치 종료 시점에 flush.
+            Core::SendFlushBatchScope sendFlushScope;
+
+            std::vector<OVERLAPPED_ENTRY> entries(batchSize);
+
             while (true)
             {
-                DWORD bytesTransferred = 0;
-                ULONG_PTR completionId = 0;
-                OVERLAPPED* pOverlapped = nullptr;
+                ULONG count = 0;
+
+                // 지연 flush 가 남아 있으면 대기 없이 폴링 — 큐가 비면(배치 종료) 바로 flush.
+                const DWORD timeoutMs = Core::SendFlushBatch::HasPending() ? 0 : INFINITE;
 
-                BOOL bResult = ::GetQueuedCompletionStatus(m_hICOP, &bytesTransferred, &completionId, &pOverlapped, INFINITE);
-                if (!bResult)
+                // wake 1회(커널 전환 1회)에 최대 batchSize 개의 완료를 꺼낸다.
+                if (!::GetQueuedCompletionStatusEx(m_hICOP, entries.data(), static_cast<ULONG>(entries.size()), &count, timeoutMs, FALSE))
                 {
-                    DWORD dwError = ::GetLastError();
-                    if (ERROR_ABANDONED_WAIT_0 == dwError || ERROR_CONNECTION_ABORTED == dwError)
+                    const DWORD dwError = ::GetLastError();
+                    if (WAIT_TIMEOUT == dwError)
                     {
-                        // IOCP 정상종료
-                        logger.LogError("IOService", "Worker thread, IOCP handle closed or operation aborted. Error : {}", dwError);
+                        Core::SendFlushBatch::FlushAll();
+                        continue;
+                    }
 
+                    if (ERROR_ABANDONED_WAIT_0 == dwError || ERROR_INVALID_HANDLE == dwError)
+                    {
+                        // IOCP 정상종료
+                        logger.LogError("IOService", "Worker thread, IOCP handle closed. Error : {}", dwError);
                         break;
                     }
 
-                    if (ERROR_NETNAME_DELETED == dwError || ERROR_CONNECTION_ABORTED == dwError)
-                    {
-                        logger.LogInfo("IOService", "Worker thread, Connection closed. Error: {}", dwError);
+                    logger.LogError("IOService", "Worker thread, GetQueuedCompletionStatusEx failed. Error: {}", dwError);
+                    continue;
+                }
 
-                        auto pConsumer = reinterpret_cast<Core::IIOConsumer*>(completionId);
-                        if (pConsumer)
-                        {
-                            pConsumer->OnIOCompleted(FALSE, bytesTransferred, pOverlapped);
-                        }
+                Core::CompletionBatchStats::Record(count);
 
+                ULONG shutdownCount = 0;
+                for (ULONG i = 0; i < count; ++i)
+                {
+                    const auto& rfEntry = entries[i];
+                    if (C_THREAD_SHUTDOWN_COMPLETION_KEY == rfEntry.lpCompletionKey)
+                    {
+                        ++shutdownCount;
                         continue;
                     }
 
-                    // ERROR_OPERATION_ABORTED = “취소된 I/O의 완료 통지
-                    if (ERROR_OPERATION_ABORTED != dwError)
+                    const DWORD dwError = GetEntryError(rfEntry);
+                    if (ERROR_NETNAME_DELETED == dwError || ERROR_CONNECTION_ABORTED == dwError)
                     {
-                        logger.LogError("IOService", "Worker thread, GetQueuedCompletionStatus failed. Error: {}", dwError);
-                    }                    
+                        logger.LogInfo(s_HotPathLogCategory, "Worker thread, Connection closed. Error: {}", dwError);
+                    }
+                    else if (ERROR_SUCCESS != dwError && ERROR_OPERATION_ABORTED != dwError)
+                    {
+                        // ERROR_OPERATION_ABORTED = “취소된 I/O의 완료 통지
+                        logger.LogError(s_HotPathLogCategory, "Worker thread, Completion failed. Error: {}", dwError);
+                    }
+
+                    DispatchCompletion(rfEntry.lpCompletionKey, ERROR_SUCCESS == dwError, rfEntry.dwNumberOfBytesTransferred, rfEntry.lpOverlapped, dwError);
+
+                    // deadline 이 지난 지연 flush 처리 (배치가 길어도 지연 상한 보장).
+                    Core::SendFlushBatch::FlushExpired();
                 }
 
-                if (C_THREAD_SHUTDOWN_COMPLETION_KEY == completionId)
+                if (shutdownCount > 0)
                 {
+                    // 종료 신호는 워커당 1개 — 한 배치에 여러 개가 들어왔으면 나머지는 다른 워커 몫으로 되돌린다.
+                    for (ULONG i = 1; i < shutdownCount; ++i)
+                    {
+                        Post(C_THREAD_SHUTDOWN_COMPLETION_KEY);
+                    }
+
                     logger.LogInfo("IOService", "Worker thread, Shutdown signal received. Exiting thread.");
                     break;
                 }
 
-                auto pConsumer = reinterpret_cast<Core::IIOConsumer*>(completionId);
-                if (pConsumer)
+                // 배치가 가득 차지 않았다 = 큐가 비었다 → 배치 종료 hook. 가득 찼으면 다음 dequeue 를 폴링으로 이어 간다.
+                if (count < entries.size())
                 {
-                    pConsumer->OnIOCompleted(bResult == TRUE, bytesTransferred, pOverlapped);
+                    Core::SendFlushBatch::FlushAll();
                 }
             }
         };
 
-    for (size_t i = 0; i < threadCount; i++)
+    for (uint32_t i = 0; i < threadCount; i++)
     {
-        m_Workers.emplace_back(fDoWorker);
+        m_Workers.emplace_back(fDoWorker, i);
     }
 
     return true; 
@@ -157,7 +234,7 @@ bool IOService::Associate(SOCKET& rfSocket, ULONG_PTR completionId) const
         return false;
     }
 
-    logger.LogInfo("IOService", "Associate, Socket associated successfully. CompletionId : {}", completionId);
+    logger.LogInfo(s_HotPathLogCategory, "Associate, Socket associated successfully. CompletionId : {}", completionId);
 
     return true;
 }
@@ -172,6 +249,16 @@ bool IOService::Post(ULONG_PTR uCompletionKey, DWORD bytes, OVERLAPPED* ov) cons
     return true;
 }
 
+void IOService::SetCompletionBatchSize(std::uint32_t batchSize) noexcept
+{
+    m_CompletionBatchSize = std::clamp<std::uint32_t>(batchSize, 1, kMaxCompletionBatchSize);
+}
+
+void IOService::SetDefaultCompletionBatchSize(std::uint32_t batchSize) noexcept
+{
+    m_DefaultCompletionBatchSize.store(std::clamp<std::uint32_t>(batchSize, 1, kMaxCompletionBatchSize), std::memory_order_relaxed);
+}
+
 bool IOService::CreateCompletionPort()
 {
 
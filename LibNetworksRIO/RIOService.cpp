@@ -15,6 +15,15 @@ import commons.logger;
 namespace LibNetworks::Services
 {
 
+namespace
+{
+// completion 마다 도는 경로 (WorkerLoop / ProcessResult) 전용.
+constinit LibCommons::HotPathLogCategory s_HotPathLogCategory{ "RIOService" };
+
+// completion 마다의 Debug 추적은 64 건에 1 건만.
+constinit LibCommons::LogSampler s_CompletionTraceSampler{ "RIOService.CompletionTrace", 64 };
+}
+
 RIOService::~RIOService()
 {
     Stop();
@@ -102,7 +111,7 @@ void RIOService::WorkerLoop()
 
         if (count == RIO_CORRUPT_CQ)
         {
-            LibCommons::Logger::GetInstance().LogError("RIOService", "WorkerLoop - RIO_CORRUPT_CQ detected. Stopping worker.");
+            LibCommons::Logger::GetInstance().LogError(s_HotPathLogCategory, "WorkerLoop - RIO_CORRUPT_CQ detected. Stopping worker.");
             break;
         }
 
@@ -118,11 +127,11 @@ void RIOService::ProcessResult(const RIORESULT& result)
     Core::RioContext* pContext = reinterpret_cast<Core::RioContext*>(result.RequestContext);
     if (pContext == nullptr || pContext->pSession == nullptr)
     {
-        LibCommons::Logger::GetInstance().LogError("RIOService", "Request Context is not valid.");
+        LibCommons::Logger::GetInstance().LogError(s_HotPathLogCategory, "Request Context is not valid.");
         return;
     }
 
-    LibCommons::Logger::GetInstance().LogInfo("RIOService", "Processing RIO result: Status : {}, BytesTransferred : {}, Operation Type : {}", 
+    LibCommons::Logger::GetInstance().LogDebug(s_HotPathLogCategory, s_CompletionTraceSampler, "Processing RIO result: Status : {}, BytesTransferred : {}, Operation Type : {}", 
         result.Status, result.BytesTransferred, (pContext->OpType == Core::RioOperationType::Receive ? "Receive" : "Send"));
 
     LibNetworks::Sessions::RIOSession* pSession = reinterpret_cast<LibNetworks::Sessions::RIOSession*>(pContext->pSession);
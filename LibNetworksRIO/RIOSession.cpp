@@ -17,13 +17,28 @@ import commons.logger;
 namespace LibNetworks::Sessions
 {
 
+namespace
+{
+// 송수신 / completion 마다 도는 경로 — Release 에서는 Debug / Info 가 컴파일되지 않는다.
+constinit LibCommons::HotPathLogCategory s_LogCategory{ "RIOSession" };
+
+// 대량 접속 종료 / 송신 포화 때 세션마다 한 줄씩 나오는 경로 — 호출 위치별 rate limit (초당 1, burst 10).
+constinit LibCommons::LogRateLimit s_RecvBufferFullLogLimit{ "RIOSession.RecvBufferFull" };
+constinit LibCommons::LogRateLimit s_ReceiveFailedLogLimit{ "RIOSession.ReceiveFailed" };
+constinit LibCommons::LogRateLimit s_BackpressureLogLimit{ "RIOSession.Backpressure" };
+constinit LibCommons::LogRateLimit s_SendFailedLogLimit{ "RIOSession.SendFailed" };
+
+// 수신 요청마다의 Debug 추적은 64 건에 1 건만.
+constinit LibCommons::LogSampler s_RecvTraceSampler{ "RIOSession.RecvTrace", 64 };
+}
+
 RIOSession::RIOSession(const std::shared_ptr<Core::Socket>& pSocket, const Core::RioBufferSlice& recvSlice, const Core::RioBufferSlice& sendSlice, RIO_CQ completionQueue)
     : m_pSocket(pSocket), m_RecvSlice(recvSlice), m_SendSlice(sendSlice)
 {
     m_RQ = Core::RioExtension::GetTable().RIOCreateRequestQueue(pSocket->GetSocket(), 1, 1, 1, 1, completionQueue, completionQueue, this);
     if (m_RQ == RIO_INVALID_RQ)
     {
-        LibCommons::Logger::GetInstance().LogError("RIOSession", "RIOSession::Constructor - RIOCreateRequestQueue failed. Socket : {}, Error : {}", pSocket->GetSocket(), WSAGetLastError());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "RIOSession::Constructor - RIOCreateRequestQueue failed. Socket : {}, Error : {}", pSocket->GetSocket(), WSAGetLastError());
 
         // 
     }
@@ -47,7 +62,7 @@ bool RIOSession::Initialize()
 {
     if (m_RQ == RIO_INVALID_RQ)
     {
-        LibCommons::Logger::GetInstance().LogError("RIOSession", "RIOSession::Initialize - Failed to create RIO Request Queue. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "RIOSession::Initialize - Failed to create RIO Request Queue. Session Id : {}", GetSessionId());
         return false;
     }
 
@@ -71,7 +86,7 @@ void RIOSession::RequestRecv()
 {
     if (m_bIsDisconnected)
     {
-        LibCommons::Logger::GetInstance().LogWarning("RIOSession", "RequestRecv called on disconnected session. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogWarning(s_LogCategory, "RequestRecv called on disconnected session. Session Id : {}", GetSessionId());
 
         return;
     }
@@ -81,7 +96,7 @@ void RIOSession::RequestRecv()
 
     if (freeSpace == 0 || writeableBuffers.empty())
     {
-        LibCommons::Logger::GetInstance().LogError("RIOSession", "RequestRecv - No free space in receive buffer. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_RecvBufferFullLogLimit, "RequestRecv - No free space in receive buffer. Session Id : {}", GetSessionId());
         return;
     }
 
@@ -92,19 +107,29 @@ void RIOSession::RequestRecv()
     buf.Offset = m_RecvSlice.Offset + static_cast<ULONG>(writeableBuffers[0].data() - reinterpret_cast<std::byte*>(m_RecvSlice.pData));
     buf.Length = static_cast<ULONG>(writeableBuffers[0].size());
 
-    LibCommons::Logger::GetInstance().LogDebug("RIOSession", "RequestRecv - RIOReceive called. Session Id : {}, Offset : {}, Length : {}", GetSessionId(), buf.Offset, buf.Length);
+    LibCommons::Logger::GetInstance().LogDebug(s_LogCategory, s_RecvTraceSampler, "RequestRecv - RIOReceive called. Session Id : {}, Offset : {}, Length : {}", GetSessionId(), buf.Offset, buf.Length);
 
     if (!Core::RioExtension::GetTable().RIOReceive(m_RQ, &buf, 1, 0, &m_RecvContext))
     {
-        LibCommons::Logger::GetInstance().LogError("RIOSession", "RequestRecv - RIOReceive failed. Session Id : {}, Error : {}", GetSessionId(), WSAGetLastError());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_ReceiveFailedLogLimit, "RequestRecv - RIOReceive failed. Session Id : {}, Error : {}", GetSessionId(), WSAGetLastError());
     }
 }
 
 void RIOSession::SendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage)
+{
+    EnqueueMessage(packetId, rfMessage, false);
+}
+
+SendResult RIOSession::TrySendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage)
+{
+    return EnqueueMessage(packetId, rfMessage, true);
+}
+
+SendResult RIOSession::EnqueueMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage, bool bTry)
 {
     if (m_bIsDisconnected)
     {
-        return;
+        return SendResult::Disconnected;
     }
 
     const size_t bodySize = rfMessage.ByteSizeLong();
@@ -113,52 +138,152 @@ void RIOSession::SendMessage(const uint16_t packetId, const google::protobuf::Me
     // Safety Check: 대기 중인 데이터가 너무 많으면 연결 종료 (Backpressure)
     if (m_PendingTotalBytes.load(std::memory_order_acquire) > MAX_PENDING_BYTES)
     {
-        LibCommons::Logger::GetInstance().LogWarning("RIOSession", "SendMessage - Backpressure limit exceeded ({}MB). Disconnecting session. Session Id : {}",
+        if (bTry)
+        {
+            return SendResult::Overflow;
+        }
+
+        LibCommons::Logger::GetInstance().LogWarning(s_LogCategory, s_BackpressureLogLimit, "SendMessage - Backpressure limit exceeded ({}MB). Disconnecting session. Session Id : {}",
             MAX_PENDING_BYTES / (1024 * 1024), GetSessionId());
         m_bIsDisconnected = true;
         OnDisconnected();
-        return;
-    }
-
-    // 패킷 직렬화
-    std::vector<std::byte> packetData(totalSize);
-    uint16_t sizeNet = htons(static_cast<uint16_t>(totalSize));
-    uint16_t idNet = htons(packetId);
-
-    std::memcpy(packetData.data(), &sizeNet, sizeof(sizeNet));
-    std::memcpy(packetData.data() + sizeof(sizeNet), &idNet, sizeof(idNet));
-    if (bodySize > 0)
-    {
-        rfMessage.SerializeToArray(packetData.data() + Core::Packet::GetHeaderSize() + Core::Packet::GetPacketIdSize(), static_cast<int>(bodySize));
+        return SendResult::Overflow;
     }
 
+    bool bSerializeFailed = false;
     {
         std::lock_guard lock(m_SendQueueMutex);
 
+        if (bTry && m_SendWatermark.IsAboveHigh(m_PendingTotalBytes.load(std::memory_order_relaxed) + m_pSendBuffer->CanReadSize()))
+        {
+            return SendResult::WouldBlock;
+        }
+
         bool bWrittenDirectly = false;
 
-        // 1. Fast-Path: 큐가 비어있고, 버퍼에 즉시 쓸 공간이 충분한 경우
-        if (m_PendingSendQueue.empty())
+        // 1. Fast-Path: 큐가 비어있고 버퍼 공간이 충분하면 송신 버퍼에 직접 직렬화 (중간 복사 없음)
+        //    TryPostSendFromQueue 도 같은 뮤텍스 하에서 실행되므로 예약~직렬화 사이에 송신되지 않는다.
+        if (m_PendingSendQueue.empty() && m_pSendBuffer->CanWriteSize() >= totalSize)
         {
-            if (m_pSendBuffer->CanWriteSize() >= totalSize)
+            if (m_pSendBuffer->AllocateWrite(totalSize, m_SendReserveBuffers))
             {
-                if (m_pSendBuffer->Write(packetData))
-                {
-                    bWrittenDirectly = true;
-                }
+                bWrittenDirectly = true;
+                bSerializeFailed = !Core::SerializePacketToSpans(m_SendReserveBuffers, packetId, rfMessage, bodySize);
             }
         }
 
         // 2. Slow-Path: 즉시 처리가 불가능하거나 큐에 데이터가 있는 경우 큐에 넣기
         if (!bWrittenDirectly)
         {
-            m_PendingSendQueue.push_back({ std::move(packetData), 0 });
-            m_PendingTotalBytes += totalSize;
+            LibCommons::Buffers::SlabVector<std::byte> packetData(totalSize);
+            const std::span<std::byte> packetSpan(packetData);
+            bSerializeFailed = !Core::SerializePacketToSpans(std::span(&packetSpan, 1), packetId, rfMessage, bodySize);
+
+            if (!bSerializeFailed)
+            {
+                m_PendingSendQueue.push_back({ std::move(packetData), 0 });
+                m_PendingTotalBytes += totalSize;
+            }
         }
     }
 
+    if (bSerializeFailed)
+    {
+        // 예약 영역이 불완전하게 채워졌을 수 있으므로 스트림을 더 이상 신뢰할 수 없다.
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "SendMessage - Serialize failed. Disconnecting session. Session Id : {}, Packet Id : {}", GetSessionId(), packetId);
+        m_bIsDisconnected = true;
+        OnDisconnected();
+        return SendResult::Failed;
+    }
+
+    UpdateSendBackpressure();
+
     // 큐에 데이터가 있거나 방금 넣었으면 Flush 시도
     FlushPendingSendQueue();
+    return SendResult::Ok;
+}
+
+SendResult RIOSession::SendSharedPacket(const Core::SharedPacket& rfPacket)
+{
+    if (m_bIsDisconnected)
+    {
+        return SendResult::Disconnected;
+    }
+
+    if (!rfPacket.IsValid())
+    {
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "SendSharedPacket - Invalid packet. Session Id : {}", GetSessionId());
+        return SendResult::Failed;
+    }
+
+    if (m_PendingTotalBytes.load(std::memory_order_acquire) > MAX_PENDING_BYTES)
+    {
+        return SendResult::Overflow;
+    }
+
+    const auto bytes = rfPacket.GetBytes();
+    {
+        std::lock_guard lock(m_SendQueueMutex);
+
+        if (m_SendWatermark.IsAboveHigh(m_PendingTotalBytes.load(std::memory_order_relaxed) + m_pSendBuffer->CanReadSize()))
+        {
+            return SendResult::WouldBlock;
+        }
+
+        // 순서 유지: 대기 큐가 비어 있을 때만 송신 버퍼에 바로 쓴다.
+        const bool bWrittenDirectly = m_PendingSendQueue.empty()
+            && m_pSendBuffer->CanWriteSize() >= bytes.size()
+            && m_pSendBuffer->Write(bytes);
+
+        if (!bWrittenDirectly)
+        {
+            m_PendingSendQueue.push_back({ LibCommons::Buffers::SlabVector<std::byte>(bytes.begin(), bytes.end()), 0 });
+            m_PendingTotalBytes += bytes.size();
+        }
+    }
+
+    UpdateSendBackpressure();
+    FlushPendingSendQueue();
+    return SendResult::Ok;
+}
+
+void RIOSession::UpdateSendBackpressure()
+{
+    // 호출 전에 잡아 둔 적재량은 다른 스레드의 송신 / 완료와 엇갈려 낡을 수 있으므로 판단 직전에 다시 읽는다.
+    m_SendWatermark.Update(
+        [this]()
+        {
+            std::lock_guard lock(m_SendQueueMutex);
+            return m_PendingTotalBytes.load(std::memory_order_relaxed) + m_pSendBuffer->CanReadSize();
+        },
+        [this](bool bBackpressured, size_t pendingBytes)
+        {
+            LibCommons::Logger::GetInstance().LogDebug(s_LogCategory, "Send backpressure {}. Session Id : {}, Pending : {}",
+                bBackpressured ? "on" : "off", GetSessionId(), pendingBytes);
+            OnSendBackpressure(bBackpressured);
+        });
+}
+
+void RIOSession::Cork()
+{
+    m_CorkDepth.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void RIOSession::Uncork()
+{
+    const int previousDepth = m_CorkDepth.fetch_sub(1, std::memory_order_acq_rel);
+    if (previousDepth <= 0)
+    {
+        m_CorkDepth.fetch_add(1, std::memory_order_acq_rel);
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, "Uncork - underflow. Session Id : {}, Previous : {}", GetSessionId(), previousDepth);
+        return;
+    }
+
+    if (previousDepth == 1 && !m_bIsDisconnected)
+    {
+        // Cork 동안 누적된 송신 버퍼/대기 큐를 한 번에 송신
+        FlushPendingSendQueue();
+    }
 }
 
 void RIOSession::FlushPendingSendQueue()
@@ -213,35 +338,14 @@ void RIOSession::FlushPendingSendQueue()
     TryPostSendFromQueue();
 }
 
-void RIOSession::WriteToBuffers(const std::vector<std::span<std::byte>>& buffers, size_t& offset, const void* pData, size_t len)
+void RIOSession::TryPostSendFromQueue()
 {
-    const uint8_t* pSrc = reinterpret_cast<const uint8_t*>(pData);
-    size_t remaining = len;
-    size_t skip = offset;
-
-    for (const auto& span : buffers)
+    // Cork 중이면 마지막 Uncork 에서 송신
+    if (m_CorkDepth.load(std::memory_order_acquire) > 0)
     {
-        if (skip >= span.size())
-        {
-            skip -= span.size();
-            continue;
-        }
-
-        size_t toCopy = (std::min)(remaining, span.size() - skip);
-        std::memcpy(span.data() + skip, pSrc, toCopy);
-        pSrc += toCopy;
-        remaining -= toCopy;
-        skip = 0;
-        if (remaining == 0)
-        {
-            break;
-        }
+        return;
     }
-    offset += len;
-}
 
-void RIOSession::TryPostSendFromQueue()
-{
     bool expected = false;
     if (!m_bSendInProgress.compare_exchange_strong(expected, true))
     {
@@ -265,7 +369,7 @@ void RIOSession::TryPostSendFromQueue()
     if (!Core::RioExtension::GetTable().RIOSend(m_RQ, &buf, 1, 0, &m_SendContext))
     {
         m_bSendInProgress = false;
-        LibCommons::Logger::GetInstance().LogError("RIOSession", "TryPostSendFromQueue - RIOSend failed. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogError(s_LogCategory, s_SendFailedLogLimit, "TryPostSendFromQueue - RIOSend failed. Session Id : {}", GetSessionId());
     }
 }
 
@@ -273,7 +377,7 @@ void RIOSession::OnRioIOCompleted(bool bSuccess, DWORD bytesTransferred, Core::R
 {
     if (!bSuccess || (opType == Core::RioOperationType::Receive && bytesTransferred == 0))
     {
-        LibCommons::Logger::GetInstance().LogInfo("RIOSession", "OnRioIOCompleted - Disconnected detected. Session Id : {}", GetSessionId());
+        LibCommons::Logger::GetInstance().LogInfo(s_LogCategory, "OnRioIOCompleted - Disconnected detected. Session Id : {}", GetSessionId());
         m_bIsDisconnected = true;
 
         OnDisconnected();
@@ -295,49 +399,67 @@ void RIOSession::OnRioIOCompleted(bool bSuccess, DWORD bytesTransferred, Core::R
         break;
     case Core::RioOperationType::Send:
         {
-            std::lock_guard lock(m_SendQueueMutex);
-            m_pSendBuffer->Consume(bytesTransferred);
-            m_bSendInProgress = false;
-            // Design Ref: server-status §3.3 — 누적 송신 바이트.
-            m_TotalTxBytes.fetch_add(bytesTransferred, std::memory_order_relaxed);
+            {
+                std::lock_guard lock(m_SendQueueMutex);
+                m_pSendBuffer->Consume(bytesTransferred);
+                m_bSendInProgress = false;
+                // Design Ref: server-status §3.3 — 누적 송신 바이트.
+                m_TotalTxBytes.fetch_add(bytesTransferred, std::memory_order_relaxed);
+            }
+            UpdateSendBackpressure();
+            FlushPendingSendQueue();
         }
-        FlushPendingSendQueue();
         break;
     }
 }
 
 void RIOSession::OnAccepted()
 {
-    LibCommons::Logger::GetInstance().LogInfo("RIOSession", "Session accepted. Session Id : {}", GetSessionId());
+    LibCommons::Logger::GetInstance().LogInfo(s_LogCategory, "Session accepted. Session Id : {}", GetSessionId());
     StartReceiveLoop();
 }
 
 void RIOSession::OnConnected()
 {
-    LibCommons::Logger::GetInstance().LogInfo("RIOSession", "Session connected. Session Id : {}", GetSessionId());
+    LibCommons::Logger::GetInstance().LogInfo(s_LogCategory, "Session connected. Session Id : {}", GetSessionId());
     StartReceiveLoop();
 }
 
 void RIOSession::OnDisconnected()
 {
-    LibCommons::Logger::GetInstance().LogInfo("RIOSession", "Session disconnected. Session Id : {}", GetSessionId());
+    LibCommons::Logger::GetInstance().LogInfo(s_LogCategory, "Session disconnected. Session Id : {}", GetSessionId());
 }
 
 void RIOSession::ReadReceivedBuffers()
 {
+    // 수신 슬라이스를 복사 없이 PacketView 로 전달하고, 핸들러 반환 후 프레임 단위로 Consume.
+    if (m_pReceiveBuffer->GetReadBuffers(m_RecvReadBuffers) == 0)
+    {
+        return;
+    }
+
+    // 배치 내 핸들러들의 응답을 모아 dispatch 종료 시 1회 송신
+    SendBatch sendBatch(*this);
+
+    size_t offset = 0;
     while (true)
     {
-        auto frame = Core::PacketFramer::TryFrameFromBuffer(*m_pReceiveBuffer);
+        auto frame = Core::PacketFramer::TryFrameView(m_RecvReadBuffers, offset);
         if (frame.Result != Core::PacketFrameResult::Ok)
         {
             break;
         }
 
-        if (frame.PacketOpt.has_value())
+        if (frame.ViewOpt.has_value())
         {
-            OnPacketReceived(*frame.PacketOpt);
+            OnPacketViewReceived(*frame.ViewOpt);
         }
+
+        m_pReceiveBuffer->Consume(frame.FrameSize);
+        offset += frame.FrameSize;
     }
+
+    m_RecvReadBuffers.clear();
 }
 
 
@@ -18,8 +18,12 @@ import networks.core.rio_context;
 import networks.core.rio_buffer_manager;
 import networks.core.socket;
 import networks.core.packet;
+import networks.core.packet_view;
 import networks.core.packet_framer;
+import networks.core.span_output_stream;
+import networks.core.shared_packet;
 import commons.buffers.external_circle_buffer_queue;
+import commons.buffers.slab_pool;
 
 namespace LibNetworks::Sessions
 {
@@ -44,9 +48,22 @@ public:
 
     // 패킷 메시지 전송
     virtual void SendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage) override;
+    // 대기 큐 + 송신 버퍼 적재량이 high watermark 이상이면 WouldBlock, MAX_PENDING_BYTES 초과면 Overflow.
+    virtual SendResult TrySendMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage) override;
+
+    // RIOSend 는 등록 버퍼만 보낼 수 있으므로 공유 프레임을 송신 버퍼 (또는 대기 큐) 로 복사한다.
+    // 직렬화는 공유되고 세션당 memcpy 1회만 남는다. watermark / 한도 규칙은 TrySendMessage 와 동일.
+    virtual SendResult SendSharedPacket(const Core::SharedPacket& rfPacket) override;
+
+    virtual void SetSendWatermarks(size_t lowBytes, size_t highBytes) override { m_SendWatermark.Set(lowBytes, highBytes); }
+    virtual bool IsSendBackpressured() const override { return m_SendWatermark.IsBackpressured(); }
     // 세션 ID 조회
     virtual uint64_t GetSessionId() const override { return m_SessionId; }
 
+    // 송신 corking — Cork 중에는 RIOSend 를 보류하고 마지막 Uncork 시 누적분을 1회 송신.
+    virtual void Cork() override;
+    virtual void Uncork() override;
+
     // IRioConsumer 상속 대신 직접 호출될 함수
     // RIO I/O 완료 처리
     void OnRioIOCompleted(bool bSuccess, DWORD bytesTransferred, Core::RioOperationType opType);
@@ -72,7 +89,11 @@ public:
     }
 
 protected:
-    // 패킷 수신 이벤트 처리
+    // 패킷 수신 이벤트 처리 (zero-copy). rfView 는 핸들러 반환 전까지만 유효하며 반환 후 Consume 된다.
+    // 기본 구현은 ToOwned() 복사 후 OnPacketReceived 로 위임.
+    virtual void OnPacketViewReceived(const Core::PacketView& rfView) { OnPacketReceived(rfView.ToOwned()); }
+
+    // 패킷 수신 이벤트 처리 (소유 Packet)
     virtual void OnPacketReceived(const Core::Packet& rfPacket) {}
 
 private:
@@ -85,12 +106,17 @@ private:
     void TryPostSendFromQueue();
     // 수신 버퍼 읽기
     void ReadReceivedBuffers();
-    // 버퍼에 데이터 기록
-    void WriteToBuffers(const std::vector<std::span<std::byte>>& buffers, size_t& offset, const void* pData, size_t len);
 
     // 대기 중인 전송 데이터 처리
     void FlushPendingSendQueue();
 
+    // SendMessage / TrySendMessage 공통. bTry 면 watermark 를 지키고 한도 초과 시 세션을 유지한다.
+    SendResult EnqueueMessage(const uint16_t packetId, const google::protobuf::Message& rfMessage, bool bTry);
+
+    // 대기 큐 + 송신 버퍼 적재량으로 watermark 전이 판단 — 전이 시 OnSendBackpressure 호출.
+    // 적재량은 판단 직전에 m_SendQueueMutex 아래에서 다시 읽는다. m_SendQueueMutex 비보유 상태에서 호출.
+    void UpdateSendBackpressure();
+
 private:
     // 연결된 소켓
     std::shared_ptr<Core::Socket> m_pSocket;
@@ -109,6 +135,8 @@ private:
 
     // 전송 진행 상태
     std::atomic<bool> m_bSendInProgress = false;
+    // Cork 중첩 depth (0 보다 크면 RIOSend 보류)
+    std::atomic<int> m_CorkDepth = 0;
     // 최초 receive loop 시작 중복 방지
     std::atomic<bool> m_bReceiveLoopStarted = false;
     // 연결 종료 상태
@@ -117,7 +145,8 @@ private:
     // 대기 중인 패킷 정보를 담는 구조체
     struct PendingPacket
     {
-        std::vector<std::byte> Data;
+        // 대기 패킷은 워커마다 생성/소멸이 잦아 SlabPool 에서 할당.
+        LibCommons::Buffers::SlabVector<std::byte> Data;
         size_t Offset = 0;
     };
 
@@ -125,13 +154,19 @@ private:
     std::deque<PendingPacket> m_PendingSendQueue;
     // 전송 큐 동기화용 뮤텍스
     std::mutex m_SendQueueMutex;
+    // Fast-Path 직렬화용 예약 segment 저장소 (m_SendQueueMutex 보호)
+    std::vector<std::span<std::byte>> m_SendReserveBuffers;
     // 수신 버퍼 동기화용 뮤텍스 (ExternalCircleBufferQueue는 thread-safe하지 않음)
     std::mutex m_RecvMutex;
+    // ReadReceivedBuffers 용 segment 저장소 (m_RecvMutex 보호)
+    std::vector<std::span<const std::byte>> m_RecvReadBuffers;
 
     // 대기 중인 총 바이트 수 (Backpressure용)
     std::atomic<size_t> m_PendingTotalBytes = 0;
     // 최대 대기 허용 바이트 (10MB) - 초과 시 연결 종료
     static constexpr size_t MAX_PENDING_BYTES = 10 * 1024 * 1024;
+    // 송신 적재량 high/low watermark 와 backpressure 상태.
+    SendWatermark m_SendWatermark{};
 
     // 세션 ID
     uint64_t m_SessionId = m_NextSessionId.fetch_add(1, std::memory_order_relaxed);
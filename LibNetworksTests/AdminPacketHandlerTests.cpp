@@ -1,12 +1,14 @@
 // AdminPacketHandlerTests.cpp
 // -----------------------------------------------------------------------------
-// Design Ref: server-status §8.6 — AdminPacketHandler dispatch 단위 테스트 (AH-01 ~ AH-05).
+// Design Ref: server-status §8.6 — AdminPacketHandler dispatch 단위 테스트 (AH-01 ~ AH-06).
 // FakeSession 으로 SendMessage 캡처. 실제 Collector(MockSessionStats provider) 와 함께
 // 엔드-투-엔드 검증 (Collector 는 별도 테스트에서 커버, 여기선 dispatch 중심).
 // -----------------------------------------------------------------------------
 #include "CppUnitTest.h"
 
 #include <WinSock2.h>
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <string>
@@ -17,6 +19,7 @@
 #include <Protocols/Admin.pb.h>
 #include <Protocols/Commons.pb.h>
 
+import commons.log_rate_limit;
 import networks.admin.admin_packet_handler;
 import networks.stats.server_stats_collector;
 import networks.stats.stats_sampler;
@@ -82,6 +85,9 @@ MakeMocks(std::uint32_t count)
     return out;
 }
 
+// AH-06 용 호출 위치 (burst 1 — 두 번째부터 억제).
+constinit LibCommons::LogRateLimit s_TestLogLimit{ "AdminPacketHandlerTests.Site", 1, 1 };
+
 // Admin.proto 의 메시지를 Packet 으로 래핑 (id + serialized body).
 template <class MsgT>
 LibNetworks::Core::Packet MakeAdminPacket(std::uint16_t packetId, const MsgT& msg)
@@ -260,6 +266,49 @@ public:
         Assert::IsTrue(session.sentMessages.empty(),
             L"parse 실패 시 응답을 보내지 않아야 함");
     }
+
+    // AH-06: 0x8005 LogSuppressionRequest → 0x8006 응답에 호출 위치별 억제 카운터 포함.
+    TEST_METHOD(Handle_LogSuppressionRequest_ReportsSites)
+    {
+        LibNetworks::Stats::ServerStatsCollector collector(
+            LibNetworks::Stats::ServerMode::IOCP,
+            []() { return std::vector<std::shared_ptr<LibNetworks::Sessions::ISessionStats>>{}; },
+            []() -> std::uint64_t { return 0ULL; },
+            nullptr);
+
+        LibNetworks::Admin::AdminPacketHandler handler(collector);
+
+        const auto now = std::chrono::steady_clock::now();
+        for (int i = 0; i < 5; ++i)
+        {
+            s_TestLogLimit.Admit(now);
+        }
+        const auto expected = s_TestLogLimit.GetStats();
+
+        ::fastport::protocols::admin::AdminLogSuppressionRequest request;
+        request.mutable_header()->set_request_id(6);
+
+        FakeSession session;
+        Assert::IsTrue(handler.HandlePacket(session,
+            MakeAdminPacket(LibNetworks::Admin::kPacketId_LogSuppressionReq, request)));
+
+        Assert::AreEqual(static_cast<size_t>(1), session.sentMessages.size());
+        Assert::AreEqual<std::uint16_t>(
+            LibNetworks::Admin::kPacketId_LogSuppressionRes,
+            session.sentMessages.front().first);
+
+        ::fastport::protocols::admin::AdminLogSuppressionResponse response;
+        Assert::IsTrue(response.ParseFromString(session.sentMessages.front().second));
+        Assert::AreEqual<std::uint64_t>(6ULL, response.header().request_id());
+
+        const auto it = std::find_if(response.sites().begin(), response.sites().end(),
+            [](const auto& rfSite) { return rfSite.name() == "AdminPacketHandlerTests.Site"; });
+        Assert::IsTrue(it != response.sites().end(), L"Admit 된 호출 위치는 응답에 포함");
+        Assert::IsTrue(::fastport::protocols::admin::LOG_SITE_KIND_RATE_LIMIT == it->kind());
+        Assert::AreEqual<std::uint64_t>(expected.Admitted, it->admitted());
+        Assert::AreEqual<std::uint64_t>(expected.Suppressed, it->suppressed());
+        Assert::IsTrue(it->suppressed() >= 4, L"burst 1 — 같은 시각 5 회 중 4 회 억제");
+    }
 };
 
 } // namespace LibNetworksTests
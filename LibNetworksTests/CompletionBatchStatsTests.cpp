@@ -0,0 +1,117 @@
+﻿// CompletionBatchStatsTests.cpp
+// -----------------------------------------------------------------------------
+// 완료 dequeue 배치 크기 히스토그램 검증.
+// - CompletionBatchHistogram : bucket 경계 (2^(i-1), 2^i], 마지막 bucket 상한 없음
+// - CompletionBatchStats     : Record / Snapshot / Reset, 0 개 배치 무시
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+import networks.core.completion_batch_stats;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibNetworks::Core;
+
+namespace LibNetworksTests
+{
+
+TEST_CLASS(CompletionBatchStatsTests)
+{
+public:
+    TEST_METHOD_INITIALIZE(Setup)
+    {
+        CompletionBatchStats::Reset();
+    }
+
+    TEST_METHOD(Histogram_BucketBoundaries)
+    {
+        Assert::AreEqual<std::size_t>(0, CompletionBatchHistogram::BucketOf(1));
+        Assert::AreEqual<std::size_t>(1, CompletionBatchHistogram::BucketOf(2));
+        Assert::AreEqual<std::size_t>(2, CompletionBatchHistogram::BucketOf(3));
+        Assert::AreEqual<std::size_t>(2, CompletionBatchHistogram::BucketOf(4));
+        Assert::AreEqual<std::size_t>(3, CompletionBatchHistogram::BucketOf(5));
+        Assert::AreEqual<std::size_t>(6, CompletionBatchHistogram::BucketOf(64));
+        Assert::AreEqual<std::size_t>(7, CompletionBatchHistogram::BucketOf(65));
+        Assert::AreEqual<std::size_t>(CompletionBatchHistogram::kBucketCount - 1, CompletionBatchHistogram::BucketOf(100000));
+    }
+
+    TEST_METHOD(Histogram_UpperBoundMatchesBucketOf)
+    {
+        for (std::size_t i = 0; i + 1 < CompletionBatchHistogram::kBucketCount; ++i)
+        {
+            const auto upper = CompletionBatchHistogram::UpperBound(i);
+            Assert::AreEqual(i, CompletionBatchHistogram::BucketOf(upper));
+            Assert::AreEqual(i + 1, CompletionBatchHistogram::BucketOf(upper + 1));
+        }
+
+        Assert::AreEqual<std::uint32_t>(0, CompletionBatchHistogram::UpperBound(CompletionBatchHistogram::kBucketCount - 1));
+    }
+
+    TEST_METHOD(Record_AccumulatesBatchesAndCompletions)
+    {
+        CompletionBatchStats::Record(1);
+        CompletionBatchStats::Record(1);
+        CompletionBatchStats::Record(3);
+        CompletionBatchStats::Record(64);
+
+        const auto snapshot = CompletionBatchStats::Snapshot();
+        Assert::AreEqual<std::uint64_t>(2, snapshot.Buckets[0]);
+        Assert::AreEqual<std::uint64_t>(1, snapshot.Buckets[2]);
+        Assert::AreEqual<std::uint64_t>(1, snapshot.Buckets[6]);
+        Assert::AreEqual<std::uint64_t>(4, snapshot.BatchCount);
+        Assert::AreEqual<std::uint64_t>(69, snapshot.CompletionCount);
+    }
+
+    TEST_METHOD(Record_ZeroIgnored)
+    {
+        CompletionBatchStats::Record(0);
+
+        const auto snapshot = CompletionBatchStats::Snapshot();
+        Assert::AreEqual<std::uint64_t>(0, snapshot.BatchCount);
+        Assert::AreEqual<std::uint64_t>(0, snapshot.CompletionCount);
+    }
+
+    TEST_METHOD(Reset_ClearsAll)
+    {
+        CompletionBatchStats::Record(8);
+        CompletionBatchStats::Reset();
+
+        const auto snapshot = CompletionBatchStats::Snapshot();
+        for (const auto bucket : snapshot.Buckets)
+        {
+            Assert::AreEqual<std::uint64_t>(0, bucket);
+        }
+        Assert::AreEqual<std::uint64_t>(0, snapshot.BatchCount);
+    }
+
+    TEST_METHOD(Record_ConcurrentWorkers)
+    {
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 10000;
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < kThreads; ++t)
+        {
+            workers.emplace_back([]()
+                {
+                    for (int i = 0; i < kPerThread; ++i)
+                    {
+                        CompletionBatchStats::Record(2);
+                    }
+                });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        const auto snapshot = CompletionBatchStats::Snapshot();
+        Assert::AreEqual<std::uint64_t>(kThreads * kPerThread, snapshot.Buckets[1]);
+        Assert::AreEqual<std::uint64_t>(kThreads * kPerThread * 2ULL, snapshot.CompletionCount);
+    }
+};
+
+} // namespace LibNetworksTests
@@ -2,7 +2,7 @@
 // -----------------------------------------------------------------------------
 // Design Ref: server-status §8.3 — IOSession 누적 바이트 카운터 단위 테스트 (IB-01 ~ IB-05).
 // TestableIOSession 이 IOSession 을 서브클래스로 받아 OnIOCompleted 를 public 으로 노출 +
-// protected 로 승격된 m_RecvOverlapped/m_SendOverlapped 의 주소를 전달해 시뮬레이션.
+// protected 로 승격된 m_RecvOperation/m_SendOperation 의 주소를 IoCompletion 으로 전달해 시뮬레이션.
 // 실제 소켓은 INVALID_SOCKET 상태 — OnIOCompleted 경로의 부가 동작(RequestDisconnect 등)
 // 은 무해하게 실패하므로 카운터 검증만 집중.
 // -----------------------------------------------------------------------------
@@ -12,12 +12,30 @@
 #include <memory>
 #include <cstdint>
 #include <atomic>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <span>
+#include <thread>
+
+#include <Protocols/Benchmark.pb.h>
 
 import networks.sessions.io_session;
+import networks.sessions.inetwork_session;
 import networks.sessions.outbound_session;
 import networks.core.socket;
 import networks.core.packet;
+import networks.core.shared_packet;
+import networks.core.io_operation;
+import networks.core.io_backend;
 import commons.buffers.circle_buffer_queue;
+import commons.buffers.segmented_buffer;
+import commons.thread_pool;
+import commons.strand;
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -25,7 +43,7 @@ namespace LibNetworksTests
 {
 
 // 테스트 전용 서브클래스 — OnIOCompleted 를 public 으로 alias + 시뮬레이션 헬퍼 제공.
-// protected m_RecvOverlapped/m_SendOverlapped 에 자기 자신이 접근.
+// protected m_RecvOperation/m_SendOperation 에 자기 자신이 접근.
 class TestableIOSession : public LibNetworks::Sessions::IOSession
 {
 public:
@@ -33,11 +51,11 @@ public:
 
     // 테스트용 outstanding 을 1 증가시키고 Real Recv 완료를 시뮬레이트.
     // Real Recv 성공 완료를 시뮬레이트. CommitWrite(bytes) → m_TotalRxBytes += bytes.
-    void SimulateRealRecvSuccess(DWORD bytes)
+    void SimulateRealRecvSuccess(std::size_t bytes)
     {
         DebugSetOutstandingIoCountForTest(DebugGetOutstandingIoCountForTest() + 1);
-        m_RecvOverlapped.IsZeroByte = false;
-        this->OnIOCompleted(true, bytes, &m_RecvOverlapped.Overlapped);
+        m_RecvOperation.IsZeroByte = false;
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_RecvOperation, true, bytes });
     }
 
     // 테스트용 outstanding 을 1 증가시키고 Zero-byte Recv 완료를 시뮬레이트.
@@ -45,31 +63,60 @@ public:
     void SimulateZeroByteRecvComplete()
     {
         DebugSetOutstandingIoCountForTest(DebugGetOutstandingIoCountForTest() + 1);
-        m_RecvOverlapped.IsZeroByte = true;
-        this->OnIOCompleted(true, 0, &m_RecvOverlapped.Overlapped);
+        m_RecvOperation.IsZeroByte = true;
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_RecvOperation, true, 0 });
     }
 
     // 테스트용 outstanding 을 1 증가시키고 Send 완료를 시뮬레이트.
     // Send 완료를 시뮬레이트. m_TotalTxBytes += bytes.
-    void SimulateSendSuccess(DWORD bytes)
+    void SimulateSendSuccess(std::size_t bytes)
     {
         DebugSetOutstandingIoCountForTest(DebugGetOutstandingIoCountForTest() + 1);
-        this->OnIOCompleted(true, bytes, &m_SendOverlapped.Overlapped);
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_SendOperation, true, bytes });
     }
 
     // 기존 outstanding 을 drain 하는 Send completion 을 시뮬레이트.
-    void CompleteSendFromExistingOutstanding(DWORD bytes)
+    void CompleteSendFromExistingOutstanding(std::size_t bytes)
     {
-        this->OnIOCompleted(true, bytes, &m_SendOverlapped.Overlapped);
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_SendOperation, true, bytes });
     }
 
     // 기존 outstanding 을 drain 하는 Real Recv completion 을 시뮬레이트.
     // counter 를 증가시키지 않으므로, 호출자가 사전에 SetOutstandingIoCountForTest
     // 로 counter 를 올려둬야 한다.
-    void CompleteRealRecvFromExistingOutstanding(DWORD bytes)
+    void CompleteRealRecvFromExistingOutstanding(std::size_t bytes)
     {
-        m_RecvOverlapped.IsZeroByte = false;
-        this->OnIOCompleted(true, bytes, &m_RecvOverlapped.Overlapped);
+        m_RecvOperation.IsZeroByte = false;
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_RecvOperation, true, bytes });
+    }
+
+    // 수신 버퍼 기록 영역에 프레임 바이트를 채운 뒤 Real Recv 완료를 시뮬레이트.
+    void SimulateRecvFrames(std::span<const std::byte> frames)
+    {
+        std::vector<std::span<std::byte>> writable;
+        m_pReceiveBuffer->GetWriteableBuffers(writable);
+
+        std::size_t copied = 0;
+        for (const auto& span : writable)
+        {
+            const std::size_t bytes = (std::min)(span.size(), frames.size() - copied);
+            std::memcpy(span.data(), frames.data() + copied, bytes);
+            copied += bytes;
+        }
+
+        SimulateRealRecvSuccess(frames.size());
+    }
+
+    // 수신 루프 개시 (백엔드 주입 테스트용).
+    void StartReceiveLoopForTest()
+    {
+        StartReceiveLoop();
+    }
+
+    // 직전에 post 된 Recv 요청 완료를 시뮬레이트 (outstanding 은 PostRecv 시점에 이미 증가).
+    void CompletePostedRecv(std::size_t bytes)
+    {
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_RecvOperation, true, bytes });
     }
 
     // 테스트 전용 outstanding 강제 설정.
@@ -96,12 +143,40 @@ public:
         return m_PacketReceivedCount.load();
     }
 
+    // 테스트 전용 배달 packet id (배달 순서) / 마지막 배달 스레드 조회.
+    std::vector<std::uint16_t> GetReceivedPacketIdsForTest() const
+    {
+        std::lock_guard lock(m_ReceivedMutex);
+        return m_ReceivedPacketIds;
+    }
+    std::thread::id GetLastPacketThreadForTest() const
+    {
+        std::lock_guard lock(m_ReceivedMutex);
+        return m_LastPacketThread;
+    }
+
     // 테스트 전용 OnSent 호출 횟수 조회.
     int GetOnSentCountForTest() const noexcept
     {
         return m_OnSentCount.load();
     }
 
+    // 테스트 전용 OnSendBackpressure 호출 횟수 / 마지막 상태 조회.
+    int GetBackpressureEventCountForTest() const noexcept
+    {
+        return m_BackpressureEventCount.load();
+    }
+    bool GetLastBackpressureForTest() const noexcept
+    {
+        return m_bLastBackpressure.load();
+    }
+
+    // 테스트 전용 송신 버퍼 적재량 조회.
+    std::size_t GetPendingSendBytesForTest() const
+    {
+        return m_pSendBuffer->CanReadSize();
+    }
+
 protected:
     // 테스트 전용 disconnect callback 집계.
     void OnDisconnected() override
@@ -110,8 +185,13 @@ protected:
     }
 
     // 테스트 전용 packet 배달 집계 — Rule D1 drop 경로 검증에 사용.
-    void OnPacketReceived(const LibNetworks::Core::Packet& /*rfPacket*/) override
+    void OnPacketReceived(const LibNetworks::Core::Packet& rfPacket) override
     {
+        {
+            std::lock_guard lock(m_ReceivedMutex);
+            m_ReceivedPacketIds.push_back(rfPacket.GetPacketId());
+            m_LastPacketThread = std::this_thread::get_id();
+        }
         m_PacketReceivedCount.fetch_add(1);
     }
 
@@ -121,10 +201,23 @@ protected:
         m_OnSentCount.fetch_add(1);
     }
 
+    // 테스트 전용 backpressure 전이 집계.
+    void OnSendBackpressure(bool bBackpressured) override
+    {
+        m_bLastBackpressure.store(bBackpressured);
+        m_BackpressureEventCount.fetch_add(1);
+    }
+
 private:
     std::atomic<int> m_DisconnectedCount { 0 };
     std::atomic<int> m_PacketReceivedCount { 0 };
     std::atomic<int> m_OnSentCount { 0 };
+    std::atomic<int> m_BackpressureEventCount { 0 };
+    std::atomic<bool> m_bLastBackpressure { false };
+
+    mutable std::mutex m_ReceivedMutex;
+    std::vector<std::uint16_t> m_ReceivedPacketIds;
+    std::thread::id m_LastPacketThread;
 };
 
 class TestableOutboundSession : public LibNetworks::Sessions::OutboundSession
@@ -144,7 +237,7 @@ public:
 
     void CompleteConnectFromExistingOutstanding(bool success)
     {
-        this->OnIOCompleted(success, 0, &GetConnectOverlapped());
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &GetConnectOperation(), success, 0 });
     }
 
     int GetOutstandingIoCountForTest() const noexcept
@@ -181,6 +274,42 @@ private:
 
 namespace
 {
+// 실제 소켓 I/O 없이 post 요청만 기록하는 테스트용 백엔드.
+struct RecordingIoBackend : public LibNetworks::Core::IIoBackend
+{
+    int RecvPostCount = 0;
+    int SendPostCount = 0;
+    std::vector<std::byte> LastSendBytes;
+    bool bLastRecvZeroByte = false;
+    std::size_t LastRecvBufferBytes = 0;
+    bool bFailPosts = false;
+
+    bool PostRecv(LibNetworks::Core::Socket&, LibNetworks::Core::IoOperation& rfOperation, int& rfErrorCode) override
+    {
+        ++RecvPostCount;
+        bLastRecvZeroByte = rfOperation.IsZeroByte;
+        LastRecvBufferBytes = 0;
+        for (const auto& buffer : rfOperation.Buffers)
+        {
+            LastRecvBufferBytes += buffer.size();
+        }
+        rfErrorCode = bFailPosts ? -1 : 0;
+        return !bFailPosts;
+    }
+
+    bool PostSend(LibNetworks::Core::Socket&, LibNetworks::Core::IoOperation& rfOperation, int& rfErrorCode) override
+    {
+        ++SendPostCount;
+        LastSendBytes.clear();
+        for (const auto& buffer : rfOperation.Buffers)
+        {
+            LastSendBytes.insert(LastSendBytes.end(), buffer.begin(), buffer.end());
+        }
+        rfErrorCode = bFailPosts ? -1 : 0;
+        return !bFailPosts;
+    }
+};
+
 // 세션 factory — 8KB 버퍼 + 기본 (unconnected) Socket 으로 세션 생성.
 // 실제 네트워크 I/O 는 하지 않으므로 소켓은 INVALID_SOCKET 상태여도 무방.
 std::shared_ptr<TestableIOSession> MakeSession(std::size_t bufCap = 8 * 1024)
@@ -191,6 +320,51 @@ std::shared_ptr<TestableIOSession> MakeSession(std::size_t bufCap = 8 * 1024)
     return std::make_shared<TestableIOSession>(pSocket, std::move(pRecv), std::move(pSend));
 }
 
+std::shared_ptr<TestableIOSession> MakeSessionWithBackend(LibNetworks::Core::IIoBackend& rfBackend, std::size_t bufCap = 8 * 1024)
+{
+    auto pSocket = std::make_shared<LibNetworks::Core::Socket>();
+    auto pRecv   = std::make_unique<LibCommons::Buffers::CircleBufferQueue>(bufCap);
+    auto pSend   = std::make_unique<LibCommons::Buffers::CircleBufferQueue>(bufCap);
+    return std::make_shared<TestableIOSession>(pSocket, std::move(pRecv), std::move(pSend), rfBackend);
+}
+
+// packet id 별 작은 프레임들을 이어 붙인 수신 바이트.
+std::vector<std::byte> MakeFrames(std::initializer_list<std::uint16_t> packetIds)
+{
+    std::vector<std::byte> bytes;
+    for (const auto packetId : packetIds)
+    {
+        const LibNetworks::Core::Packet packet(packetId, std::string("payload"));
+        const auto raw = packet.GetRawSpan();
+        bytes.insert(bytes.end(), raw.begin(), raw.end());
+    }
+    return bytes;
+}
+
+// 조건이 만족될 때까지 대기 (최대 5초).
+template<typename TPredicate>
+bool WaitUntil(TPredicate predicate)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+// 약 1KB 패킷 1개 분량 메시지.
+::fastport::protocols::benchmark::BenchmarkRequest MakeKilobyteMessage()
+{
+    ::fastport::protocols::benchmark::BenchmarkRequest message;
+    message.set_payload(std::string(1000, 'x'));
+    return message;
+}
+
 std::shared_ptr<TestableOutboundSession> MakeOutboundSession(std::size_t bufCap = 8 * 1024)
 {
     auto pSocket = std::make_shared<LibNetworks::Core::Socket>();
@@ -198,6 +372,49 @@ std::shared_ptr<TestableOutboundSession> MakeOutboundSession(std::size_t bufCap
     auto pSend   = std::make_unique<LibCommons::Buffers::CircleBufferQueue>(bufCap);
     return std::make_shared<TestableOutboundSession>(pSocket, std::move(pRecv), std::move(pSend));
 }
+
+// 여러 스레드가 동시에 송신하는 테스트용 백엔드 — post 된 바이트를 순서대로 이어 붙이고,
+// 완료 스레드가 가져갈 수 있도록 미완료 송신 크기를 남긴다 (송신 outstanding 은 세션이 1개로 제한).
+struct ConcurrentSendIoBackend : public LibNetworks::Core::IIoBackend
+{
+    std::mutex Mutex;
+    std::vector<std::byte> SentStream;
+    std::atomic<std::size_t> PostedSendBytes { 0 };
+
+    bool PostRecv(LibNetworks::Core::Socket&, LibNetworks::Core::IoOperation&, int& rfErrorCode) override
+    {
+        rfErrorCode = 0;
+        return true;
+    }
+
+    bool PostSend(LibNetworks::Core::Socket&, LibNetworks::Core::IoOperation& rfOperation, int& rfErrorCode) override
+    {
+        std::size_t bytes = 0;
+        {
+            std::lock_guard lock(Mutex);
+            for (const auto& buffer : rfOperation.Buffers)
+            {
+                SentStream.insert(SentStream.end(), buffer.begin(), buffer.end());
+                bytes += buffer.size();
+            }
+        }
+        rfErrorCode = 0;
+        PostedSendBytes.store(bytes, std::memory_order_release);
+        return true;
+    }
+};
+
+// 기본 송신 경로와 같은 SegmentedBuffer 송신 버퍼 세션 — 비워질 때마다 청크를 반납한다.
+std::shared_ptr<TestableIOSession> MakeSegmentedSendSession(LibNetworks::Core::IIoBackend& rfBackend)
+{
+    constexpr std::size_t kChunkSize = 4 * 1024;
+    constexpr std::size_t kMaxCapacity = 4 * 1024 * 1024;
+
+    auto pSocket = std::make_shared<LibNetworks::Core::Socket>();
+    auto pRecv   = std::make_unique<LibCommons::Buffers::CircleBufferQueue>(8 * 1024);
+    auto pSend   = std::make_unique<LibCommons::Buffers::SegmentedBuffer>(kChunkSize, kMaxCapacity);
+    return std::make_shared<TestableIOSession>(pSocket, std::move(pRecv), std::move(pSend), rfBackend);
+}
 } // anonymous namespace
 
 
@@ -451,4 +668,430 @@ public:
     }
 };
 
+TEST_CLASS(IOSessionBackendTests)
+{
+public:
+
+    // BE-01: 수신 루프 개시 → 주입된 백엔드로 zero-byte Recv post (버퍼 없음).
+    TEST_METHOD(StartReceiveLoop_PostsZeroByteRecvThroughBackend)
+    {
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+
+        pSession->StartReceiveLoopForTest();
+
+        Assert::AreEqual(1, backend.RecvPostCount, L"수신 루프 개시 시 Recv 가 백엔드로 1회 post 되어야 함");
+        Assert::IsTrue(backend.bLastRecvZeroByte, L"첫 Recv 는 zero-byte 요청이어야 함");
+        Assert::AreEqual<std::size_t>(0, backend.LastRecvBufferBytes, L"zero-byte Recv 는 버퍼를 싣지 않아야 함");
+        Assert::AreEqual(1, pSession->GetOutstandingIoCountForTest());
+    }
+
+    // BE-02: zero-byte 완료 → 기록 가능 영역 전체로 실제 Recv 재-post.
+    TEST_METHOD(ZeroByteCompletion_PostsRealRecvWithWritableBuffers)
+    {
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+
+        pSession->StartReceiveLoopForTest();
+        pSession->CompletePostedRecv(0);
+
+        Assert::AreEqual(2, backend.RecvPostCount, L"zero-byte 완료 후 실제 Recv 가 post 되어야 함");
+        Assert::IsFalse(backend.bLastRecvZeroByte);
+        Assert::IsTrue(backend.LastRecvBufferBytes > 0, L"실제 Recv 는 수신 버퍼의 기록 가능 영역을 실어야 함");
+        Assert::AreEqual(1, pSession->GetOutstandingIoCountForTest());
+    }
+
+    // BE-03: 백엔드 post 실패 → outstanding 복구 + 세션 종료.
+    TEST_METHOD(PostFailure_RollsBackOutstandingAndDisconnects)
+    {
+        RecordingIoBackend backend;
+        backend.bFailPosts = true;
+        auto pSession = MakeSessionWithBackend(backend);
+
+        pSession->StartReceiveLoopForTest();
+
+        Assert::AreEqual(1, backend.RecvPostCount);
+        Assert::AreEqual(0, pSession->GetOutstandingIoCountForTest(), L"post 실패 시 outstanding 은 0 으로 복구되어야 함");
+        Assert::AreEqual(1, pSession->GetDisconnectedCountForTest(), L"post 실패 시 세션은 종료되어야 함");
+    }
+};
+
+TEST_CLASS(IOSessionBackpressureTests)
+{
+public:
+
+    // BP-01: high 도달 시 OnSendBackpressure(true) 1회, 이후 TrySendMessage 는 WouldBlock (SendMessage 는 적재).
+    TEST_METHOD(HighWatermark_FiresOnce_TrySendWouldBlock)
+    {
+        using LibNetworks::Sessions::SendResult;
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        pSession->SetSendWatermarks(1024, 4096);
+        const auto message = MakeKilobyteMessage();
+
+        while (!pSession->IsSendBackpressured())
+        {
+            Assert::IsTrue(SendResult::Ok == pSession->TrySendMessage(1, message), L"high 이전에는 적재되어야 함");
+        }
+        Assert::IsTrue(pSession->GetPendingSendBytesForTest() >= 4096);
+        Assert::AreEqual(1, pSession->GetBackpressureEventCountForTest());
+        Assert::IsTrue(pSession->GetLastBackpressureForTest());
+
+        const auto pendingBefore = pSession->GetPendingSendBytesForTest();
+        Assert::IsTrue(SendResult::WouldBlock == pSession->TrySendMessage(1, message));
+        Assert::AreEqual(pendingBefore, pSession->GetPendingSendBytesForTest(), L"WouldBlock 은 적재하지 않아야 함");
+
+        pSession->SendMessage(1, message);
+        Assert::IsTrue(pSession->GetPendingSendBytesForTest() > pendingBefore, L"SendMessage 는 watermark 와 무관하게 적재");
+        Assert::AreEqual(1, pSession->GetBackpressureEventCountForTest(), L"이미 backpressure 상태면 재발화하지 않음");
+    }
+
+    // BP-02: 송신 완료로 low 이하가 되면 OnSendBackpressure(false).
+    TEST_METHOD(LowWatermark_ReleasedOnSendCompletion)
+    {
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        pSession->SetSendWatermarks(1024, 4096);
+        const auto message = MakeKilobyteMessage();
+
+        while (!pSession->IsSendBackpressured())
+        {
+            pSession->SendMessage(1, message);
+        }
+
+        // low 보다 위 — 아직 해제되지 않음.
+        pSession->CompleteSendFromExistingOutstanding(1000);
+        Assert::IsTrue(pSession->IsSendBackpressured());
+
+        // 남은 송신이 재-post 된 상태 — 그 완료로 low 아래까지 소비.
+        const auto pending = pSession->GetPendingSendBytesForTest();
+        pSession->CompleteSendFromExistingOutstanding(pending - 100);
+
+        Assert::IsFalse(pSession->IsSendBackpressured());
+        Assert::AreEqual(2, pSession->GetBackpressureEventCountForTest());
+        Assert::IsFalse(pSession->GetLastBackpressureForTest());
+    }
+
+    // BP-03: TrySendMessage 는 버퍼 한도 초과 시 Overflow 만 반환하고 세션을 유지한다.
+    TEST_METHOD(TrySend_Overflow_KeepsSession)
+    {
+        using LibNetworks::Sessions::SendResult;
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend, 4 * 1024);
+        const auto message = MakeKilobyteMessage();
+
+        SendResult result = SendResult::Ok;
+        for (int i = 0; i < 8 && result == SendResult::Ok; ++i)
+        {
+            result = pSession->TrySendMessage(1, message);
+        }
+
+        Assert::IsTrue(SendResult::Overflow == result);
+        Assert::AreEqual(0, pSession->GetDisconnectedCountForTest(), L"Overflow 는 세션을 끊지 않아야 함");
+        Assert::IsTrue(SendResult::Overflow == pSession->TrySendMessage(1, message));
+    }
+
+    // BP-05: SegmentedBuffer 송신 버퍼에 여러 스레드가 동시에 SendMessage 하고 완료 스레드가 즉시 소비해도
+    // (버퍼가 비워질 때마다 청크 반납) 직렬화가 끝나지 않은 영역은 나가지 않는다 — 모든 프레임이 온전해야 함.
+    TEST_METHOD(ConcurrentSend_SegmentedBuffer_SendsOnlyCompleteFrames)
+    {
+        using LibNetworks::Core::SharedPacket;
+
+        constexpr int kSenderCount = 4;
+        constexpr int kMessagesPerSender = 500;
+
+        ConcurrentSendIoBackend backend;
+        auto pSession = MakeSegmentedSendSession(backend);
+        const auto message = MakeKilobyteMessage();
+
+        std::vector<std::vector<std::byte>> expectedFrames;
+        for (int sender = 0; sender < kSenderCount; ++sender)
+        {
+            const auto shared = SharedPacket::Serialize(static_cast<std::uint16_t>(sender + 1), message);
+            const auto frame = shared.GetBytes();
+            expectedFrames.emplace_back(frame.begin(), frame.end());
+        }
+        const std::size_t frameSize = expectedFrames.front().size();
+        const std::size_t totalBytes = frameSize * kSenderCount * kMessagesPerSender;
+
+        // 완료 스레드 — post 된 송신을 바로 완료시켜 버퍼를 0 까지 소비한다.
+        std::atomic<std::size_t> completedBytes { 0 };
+        std::thread completer([&]()
+            {
+                const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                while (completedBytes.load() < totalBytes && std::chrono::steady_clock::now() < deadline)
+                {
+                    const std::size_t bytes = backend.PostedSendBytes.exchange(0, std::memory_order_acq_rel);
+                    if (bytes == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    completedBytes += bytes;
+                    pSession->CompleteSendFromExistingOutstanding(bytes);
+                }
+            });
+
+        std::vector<std::thread> senders;
+        for (int sender = 0; sender < kSenderCount; ++sender)
+        {
+            senders.emplace_back([&, sender]()
+                {
+                    for (int i = 0; i < kMessagesPerSender; ++i)
+                    {
+                        pSession->SendMessage(static_cast<std::uint16_t>(sender + 1), message);
+                    }
+                });
+        }
+        for (auto& thread : senders)
+        {
+            thread.join();
+        }
+        completer.join();
+
+        Assert::AreEqual(totalBytes, completedBytes.load(), L"적재한 바이트가 모두 송신 완료되어야 함");
+        Assert::AreEqual(0, pSession->GetDisconnectedCountForTest());
+        Assert::AreEqual<std::size_t>(0, pSession->GetPendingSendBytes());
+
+        std::lock_guard lock(backend.Mutex);
+        Assert::AreEqual(totalBytes, backend.SentStream.size());
+        for (std::size_t offset = 0; offset < backend.SentStream.size(); offset += frameSize)
+        {
+            const auto begin = backend.SentStream.begin() + offset;
+            const bool bMatched = std::any_of(expectedFrames.begin(), expectedFrames.end(), [&](const auto& rfFrame)
+                {
+                    return std::equal(rfFrame.begin(), rfFrame.end(), begin);
+                });
+            Assert::IsTrue(bMatched, L"송신된 각 프레임은 직렬화가 끝난 온전한 프레임이어야 함");
+        }
+    }
+
+    // BP-04: 송신 스레드가 high 이상을 읽은 직후 완료가 0 까지 소비하고 Update 해도
+    // backpressure 에 갇히지 않고, on / off 통지가 순서대로 나간다.
+    TEST_METHOD(SendVsCompletion_Interleaved_EndsReleasedInOrder)
+    {
+        LibNetworks::Sessions::SendWatermark watermark;
+        watermark.Set(1024, 4096);
+
+        std::size_t pendingBytes = 8192;
+        std::vector<bool> events;
+        auto readPending = [&]() { return pendingBytes; };
+        auto notify = [&](bool bBackpressured, std::size_t) { events.push_back(bBackpressured); };
+
+        // 송신 쪽 Update 가 적재량을 읽은 순간 완료 쪽이 끼어든다 (다른 스레드의 동시 호출과 같은 순서).
+        bool bCompletionInjected = false;
+        watermark.Update([&]()
+            {
+                const std::size_t observed = pendingBytes;
+                if (!bCompletionInjected)
+                {
+                    bCompletionInjected = true;
+                    pendingBytes = 0;
+                    watermark.Update(readPending, notify);
+                }
+                return observed;
+            }, notify);
+
+        Assert::IsFalse(watermark.IsBackpressured(), L"빈 송신 큐로 backpressure 에 남으면 안 됨");
+        Assert::AreEqual<std::size_t>(2, events.size());
+        Assert::IsTrue(events[0]);
+        Assert::IsFalse(events[1]);
+    }
+};
+
+TEST_CLASS(IOSessionCorkTests)
+{
+public:
+
+    // CK-01: cork 중 SendMessage 는 송신 버퍼에만 쌓이고 post 되지 않으며,
+    // 중첩 SendBatch 의 가장 바깥 Uncork 에서 적재 순서대로 한 번의 gather-send 로 나간다.
+    TEST_METHOD(NestedSendBatch_HoldsSendsUntilOutermostUncork)
+    {
+        using LibNetworks::Core::SharedPacket;
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        const auto message = MakeKilobyteMessage();
+
+        std::vector<std::byte> expected;
+        for (std::uint16_t packetId = 1; packetId <= 3; ++packetId)
+        {
+            const auto shared = SharedPacket::Serialize(packetId, message);
+            const auto frame = shared.GetBytes();
+            expected.insert(expected.end(), frame.begin(), frame.end());
+        }
+
+        {
+            LibNetworks::Sessions::SendBatch outer(*pSession);
+            pSession->SendMessage(1, message);
+            {
+                LibNetworks::Sessions::SendBatch inner(*pSession);
+                pSession->SendMessage(2, message);
+            }
+            Assert::AreEqual(0, backend.SendPostCount, L"안쪽 Uncork 에서는 flush 하지 않아야 함");
+
+            pSession->SendMessage(3, message);
+            Assert::AreEqual(0, backend.SendPostCount, L"cork 중에는 post 하지 않아야 함");
+            Assert::AreEqual(expected.size(), pSession->GetPendingSendBytes());
+        }
+
+        Assert::AreEqual(1, backend.SendPostCount);
+        Assert::AreEqual(expected.size(), backend.LastSendBytes.size());
+        Assert::IsTrue(std::equal(expected.begin(), expected.end(), backend.LastSendBytes.begin()), L"적재 순서대로 한 번에 나가야 함");
+
+        // cork 가 풀린 뒤의 송신은 (진행 중인 송신이 끝나면) 바로 나간다.
+        pSession->CompleteSendFromExistingOutstanding(backend.LastSendBytes.size());
+        pSession->SendMessage(4, message);
+        Assert::AreEqual(2, backend.SendPostCount);
+    }
+};
+
+TEST_CLASS(IOSessionSharedPacketTests)
+{
+public:
+
+    // SP-01: 공유 프레임은 송신 버퍼 데이터와 적재 순서대로 한 번의 gather-send 로 나간다.
+    TEST_METHOD(SharedPacket_GatherSentInEnqueueOrder)
+    {
+        using LibNetworks::Core::SharedPacket;
+        using LibNetworks::Sessions::SendResult;
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        const auto message = MakeKilobyteMessage();
+        const auto shared = SharedPacket::Serialize(2, message);
+        const auto frameBytes = shared.GetBytes();
+        Assert::IsTrue(shared.IsValid());
+
+        pSession->Cork();
+        pSession->SendMessage(2, message);
+        Assert::IsTrue(SendResult::Ok == pSession->SendSharedPacket(shared));
+        pSession->SendMessage(2, message);
+        pSession->Uncork();
+
+        Assert::AreEqual(1, backend.SendPostCount);
+        Assert::AreEqual<std::size_t>(3 * frameBytes.size(), backend.LastSendBytes.size());
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            Assert::IsTrue(std::equal(frameBytes.begin(), frameBytes.end(), backend.LastSendBytes.begin() + i * frameBytes.size()),
+                L"같은 메시지의 SendMessage 프레임과 SharedPacket 프레임은 바이트 단위로 같아야 함");
+        }
+        Assert::AreEqual(2L, shared.GetShareCount(), L"송신 완료 전까지 세션이 참조를 보유");
+
+        pSession->CompleteSendFromExistingOutstanding(backend.LastSendBytes.size());
+        Assert::AreEqual(1L, shared.GetShareCount(), L"송신 완료 시 참조 해제");
+        Assert::AreEqual<std::size_t>(0, pSession->GetPendingSendBytes());
+    }
+
+    // SP-02: 부분 송신이면 남은 공유 프레임 바이트부터 이어서 재-post.
+    TEST_METHOD(SharedPacket_PartialSend_ResumesFromOffset)
+    {
+        using LibNetworks::Core::SharedPacket;
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        const auto shared = SharedPacket::Serialize(2, MakeKilobyteMessage());
+        const auto frameBytes = shared.GetBytes();
+
+        pSession->SendSharedPacket(shared);
+        Assert::AreEqual(1, backend.SendPostCount);
+        Assert::AreEqual(frameBytes.size(), pSession->GetPendingSendBytes());
+
+        pSession->CompleteSendFromExistingOutstanding(100);
+        Assert::AreEqual(2, backend.SendPostCount);
+        Assert::AreEqual(frameBytes.size() - 100, backend.LastSendBytes.size());
+        Assert::IsTrue(std::equal(frameBytes.begin() + 100, frameBytes.end(), backend.LastSendBytes.begin()));
+        Assert::AreEqual(2L, shared.GetShareCount());
+
+        pSession->CompleteSendFromExistingOutstanding(frameBytes.size() - 100);
+        Assert::AreEqual(1L, shared.GetShareCount());
+        Assert::AreEqual<std::size_t>(0, pSession->GetPendingSendBytes());
+    }
+
+    // SP-03: Broadcast 는 1회 직렬화한 프레임을 세션마다 참조로 적재하고, null / WouldBlock 세션은 건너뛴다.
+    TEST_METHOD(Broadcast_SharesOneFrame_SkipsBlockedSessions)
+    {
+        using LibNetworks::Core::SharedPacket;
+
+        RecordingIoBackend backend;
+        std::vector<std::shared_ptr<TestableIOSession>> sessions;
+        for (int i = 0; i < 3; ++i)
+        {
+            sessions.push_back(MakeSessionWithBackend(backend));
+        }
+        sessions.push_back(nullptr);
+
+        const auto shared = SharedPacket::Serialize(2, MakeKilobyteMessage());
+        Assert::AreEqual<std::size_t>(3, LibNetworks::Sessions::Broadcast(sessions, shared));
+        Assert::AreEqual(4L, shared.GetShareCount(), L"프레임은 복사되지 않고 세션 3개가 참조");
+
+        // high watermark 이상인 세션은 WouldBlock — 느린 수신자는 건너뛴다.
+        sessions[0]->SetSendWatermarks(0, 1);
+        Assert::AreEqual<std::size_t>(2, LibNetworks::Sessions::Broadcast(sessions, shared));
+    }
+};
+
+TEST_CLASS(IOSessionStrandTests)
+{
+public:
+
+    // ST-01: strand 설정 시 I/O 완료 스레드가 아닌 풀에서 수신 순서대로 배달되고,
+    // 대기 중인 패킷은 outstanding 으로 잡혀 있다.
+    TEST_METHOD(PacketStrand_DeliversInOrderOffIoThread)
+    {
+        auto pPool = LibCommons::ThreadPool::Create(2);
+        auto pStrand = LibCommons::Strand::Create(pPool);
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        pSession->SetPacketStrand(pStrand);
+
+        // strand 를 막아 두고 수신 — 배달 전 상태를 확인.
+        std::promise<void> gate;
+        pStrand->Post([future = gate.get_future().share()]() { future.wait(); });
+
+        const auto frames = MakeFrames({ 11, 12, 13 });
+        pSession->SimulateRecvFrames(frames);
+
+        Assert::AreEqual(0, pSession->GetPacketReceivedCountForTest(), L"strand 가 막혀 있으면 배달되면 안 됨");
+        Assert::AreEqual(1 + 3, pSession->GetOutstandingIoCountForTest(), L"재-post 된 Recv 1 + 대기 패킷 3");
+
+        gate.set_value();
+
+        Assert::IsTrue(WaitUntil([&]() { return pSession->GetOutstandingIoCountForTest() == 1; }));
+        Assert::IsTrue(std::vector<std::uint16_t>{ 11, 12, 13 } == pSession->GetReceivedPacketIdsForTest(), L"수신 순서대로 배달");
+        Assert::IsTrue(std::this_thread::get_id() != pSession->GetLastPacketThreadForTest(), L"I/O 완료 스레드에서 실행되면 안 됨");
+    }
+
+    // ST-02: 대기 중 종료되면 남은 패킷은 배달하지 않고, 모두 폐기된 뒤에 OnDisconnected 1회.
+    TEST_METHOD(PacketStrand_DisconnectWhileQueued_DropsThenFiresOnce)
+    {
+        auto pPool = LibCommons::ThreadPool::Create(2);
+        auto pStrand = LibCommons::Strand::Create(pPool);
+
+        RecordingIoBackend backend;
+        auto pSession = MakeSessionWithBackend(backend);
+        pSession->SetPacketStrand(pStrand);
+
+        std::promise<void> gate;
+        pStrand->Post([future = gate.get_future().share()]() { future.wait(); });
+
+        pSession->SimulateRecvFrames(MakeFrames({ 21, 22 }));
+
+        // 재-post 된 Recv 가 0 바이트로 완료 (상대 종료).
+        pSession->CompletePostedRecv(0);
+
+        Assert::AreEqual(0, pSession->GetDisconnectedCountForTest(), L"대기 패킷이 남아 있으면 OnDisconnected 가 fire 되면 안 됨");
+        Assert::AreEqual(2, pSession->GetOutstandingIoCountForTest());
+
+        gate.set_value();
+
+        Assert::IsTrue(WaitUntil([&]() { return pSession->GetDisconnectedCountForTest() == 1; }));
+        Assert::AreEqual(0, pSession->GetPacketReceivedCountForTest(), L"종료 이후 대기 패킷은 배달되지 않아야 함");
+        Assert::AreEqual(0, pSession->GetOutstandingIoCountForTest());
+    }
+};
+
 } // namespace LibNetworksTests
@@ -0,0 +1,137 @@
+﻿// PacketDispatcherTests.cpp
+// -----------------------------------------------------------------------------
+// 컴파일 타임 패킷 dispatch 표 검증.
+// - PacketHandler    : 메시지 파싱 후 멤버/자유 함수 핸들러 호출, 파싱 실패는 핸들러 미호출 + 카운트
+// - RawPacketHandler : PacketView 그대로 전달
+// - 미등록 ID (같은 page 의 빈 칸 / 없는 page) 는 false
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Protocols/Benchmark.pb.h>
+
+import networks.core.packet;
+import networks.core.packet_view;
+import networks.core.packet_dispatcher;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibNetworks::Core;
+
+namespace LibNetworksTests
+{
+
+namespace
+{
+using BenchmarkRequest = ::fastport::protocols::benchmark::BenchmarkRequest;
+
+struct DispatchContext
+{
+    std::vector<std::string> Calls;
+
+    void OnRequest(const BenchmarkRequest& request) { Calls.push_back("request:" + request.payload()); }
+    void OnRaw(const PacketView& rfView) { Calls.push_back("raw:" + std::to_string(rfView.GetPayloadSize())); }
+};
+
+void OnFreeRequest(DispatchContext& rfContext, const BenchmarkRequest& request)
+{
+    rfContext.Calls.push_back("free:" + std::to_string(request.sequence()));
+}
+
+using TestDispatcher = PacketDispatcher<DispatchContext,
+    PacketHandler<0x0001, BenchmarkRequest, &DispatchContext::OnRequest>,
+    PacketHandler<0x1001, BenchmarkRequest, &OnFreeRequest>,
+    RawPacketHandler<0x8001, &DispatchContext::OnRaw>>;
+
+Packet MakeRequestPacket(std::uint16_t packetId, const std::string& payload, std::uint32_t sequence = 0)
+{
+    BenchmarkRequest request;
+    request.set_payload(payload);
+    request.set_sequence(sequence);
+    return Packet(packetId, request.SerializeAsString());
+}
+}
+
+TEST_CLASS(PacketDispatcherTests)
+{
+public:
+    TEST_METHOD_INITIALIZE(Setup)
+    {
+        TestDispatcher::ResetStats();
+    }
+
+    TEST_METHOD(Dispatch_RoutesToTypedAndRawHandlers)
+    {
+        DispatchContext context;
+
+        const auto first = MakeRequestPacket(0x0001, "a");
+        const auto second = MakeRequestPacket(0x1001, "", 7);
+        const auto raw = Packet(0x8001, std::string(5, 'x'));
+
+        Assert::IsTrue(TestDispatcher::Dispatch(context, PacketView::FromPacket(first)));
+        Assert::IsTrue(TestDispatcher::Dispatch(context, PacketView::FromPacket(second)));
+        Assert::IsTrue(TestDispatcher::Dispatch(context, PacketView::FromPacket(raw)));
+
+        Assert::AreEqual<std::size_t>(3, context.Calls.size());
+        Assert::AreEqual(std::string("request:a"), context.Calls[0]);
+        Assert::AreEqual(std::string("free:7"), context.Calls[1]);
+        Assert::AreEqual(std::string("raw:5"), context.Calls[2]);
+    }
+
+    // 재사용 메시지 객체에 이전 파싱 결과가 남지 않아야 한다.
+    TEST_METHOD(Dispatch_ReusedMessage_HoldsNoStaleFields)
+    {
+        DispatchContext context;
+
+        const auto full = MakeRequestPacket(0x1001, "payload", 3);
+        const auto empty = MakeRequestPacket(0x1001, "");
+        TestDispatcher::Dispatch(context, PacketView::FromPacket(full));
+        TestDispatcher::Dispatch(context, PacketView::FromPacket(empty));
+
+        Assert::AreEqual(std::string("free:0"), context.Calls[1]);
+    }
+
+    TEST_METHOD(Dispatch_UnknownId_ReturnsFalse)
+    {
+        DispatchContext context;
+
+        for (const std::uint16_t packetId : { std::uint16_t{ 0x0002 }, std::uint16_t{ 0x8002 }, std::uint16_t{ 0x4001 }, std::uint16_t{ 0xFFFF } })
+        {
+            Assert::IsFalse(TestDispatcher::IsRegistered(packetId));
+            Assert::IsFalse(TestDispatcher::Dispatch(context, PacketView::FromPacket(Packet(packetId, std::string()))));
+        }
+        Assert::IsTrue(context.Calls.empty());
+        Assert::IsTrue(TestDispatcher::IsRegistered(0x8001));
+    }
+
+    TEST_METHOD(Stats_CountCallsAndParseFailures)
+    {
+        DispatchContext context;
+
+        const auto valid = MakeRequestPacket(0x0001, "a");
+        const auto broken = Packet(0x0001, std::string("\xFF\xFF\xFF", 3));
+        TestDispatcher::Dispatch(context, PacketView::FromPacket(valid));
+        TestDispatcher::Dispatch(context, PacketView::FromPacket(valid));
+        Assert::IsTrue(TestDispatcher::Dispatch(context, PacketView::FromPacket(broken)), L"등록된 ID 는 파싱 실패여도 처리됨");
+
+        Assert::AreEqual<std::size_t>(2, context.Calls.size(), L"파싱 실패 시 핸들러 미호출");
+
+        const auto stats = TestDispatcher::Snapshot();
+        Assert::AreEqual<std::size_t>(3, stats.size());
+        Assert::AreEqual<std::uint16_t>(0x0001, stats[0].PacketId);
+        Assert::AreEqual<std::uint64_t>(3, stats[0].CallCount);
+        Assert::AreEqual<std::uint64_t>(1, stats[0].ParseFailureCount);
+        Assert::AreEqual<std::uint64_t>(0, stats[1].CallCount);
+
+        std::uint64_t timed = 0;
+        for (const auto bucket : stats[0].TimeBuckets)
+        {
+            timed += bucket;
+        }
+        Assert::AreEqual<std::uint64_t>(3, timed);
+    }
+};
+
+} // namespace LibNetworksTests
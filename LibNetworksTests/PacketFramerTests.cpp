@@ -11,6 +11,7 @@
 
 import networks.core.packet_framer;
 import networks.core.packet;
+import networks.core.packet_view;
 import commons.buffers.circle_buffer_queue;
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -203,5 +204,102 @@ namespace LibNetworksTests
 			auto res3 = PacketFramer::TryFrameFromBuffer(buffer);
 			Assert::IsTrue(res3.Result == PacketFrameResult::NeedMore);
 		}
+
+		// 연속 패킷 2개를 TryFrameView 로 offset 을 이동하며 복사 없이 분리하는지 확인
+		TEST_METHOD(FrameView_MultiplePackets_NoConsume)
+		{
+			CircleBufferQueue buffer(1024);
+
+			// Packet 1: ID 10, "A" / Packet 2: ID 20, "BB"
+			const std::array<uint8_t, 11> stream = {
+				0x00, 0x05, 0x00, 0x0A, 'A',
+				0x00, 0x06, 0x00, 0x14, 'B', 'B' };
+			buffer.Write(std::as_bytes(std::span(stream)));
+
+			std::vector<std::span<const std::byte>> segments;
+			buffer.GetReadBuffers(segments);
+
+			auto res1 = PacketFramer::TryFrameView(segments, 0);
+			Assert::IsTrue(res1.Result == PacketFrameResult::Ok);
+			Assert::AreEqual((int)10, (int)res1.ViewOpt->GetPacketId());
+			Assert::AreEqual((size_t)5, res1.FrameSize);
+			Assert::AreEqual((size_t)1, res1.ViewOpt->GetPayloadSize());
+
+			auto res2 = PacketFramer::TryFrameView(segments, res1.FrameSize);
+			Assert::IsTrue(res2.Result == PacketFrameResult::Ok);
+			Assert::AreEqual((int)20, (int)res2.ViewOpt->GetPacketId());
+			Assert::AreEqual((size_t)6, res2.FrameSize);
+
+			auto res3 = PacketFramer::TryFrameView(segments, res1.FrameSize + res2.FrameSize);
+			Assert::IsTrue(res3.Result == PacketFrameResult::NeedMore);
+
+			// TryFrameView 는 버퍼를 소비하지 않는다 (호출자가 Consume)
+			Assert::AreEqual(stream.size(), buffer.CanReadSize());
+		}
+
+		// 링버퍼 Wrap 지점에 헤더 또는 Payload 가 걸쳐 있을 때 뷰로 정상 분리되는지 확인
+		// • padding 13 : 헤더(4바이트)가 경계에 걸침, Payload 는 연속
+		// • padding 10 : 헤더는 연속, Payload 가 2-segment 로 분할
+		TEST_METHOD(FrameView_WrapAround_SplitSegments)
+		{
+			for (const size_t paddingSize : { (size_t)13, (size_t)10 })
+			{
+				CircleBufferQueue buffer(16);
+
+				std::vector<uint8_t> padding(paddingSize, 0);
+				buffer.Write(std::as_bytes(std::span(padding)));
+				buffer.Consume(padding.size());
+
+				// Size 2+2+6 = 10, ID 1001, Payload "Hello!"
+				const std::array<uint8_t, 10> packet = { 0x00, 0x0A, 0x03, 0xE9, 'H', 'e', 'l', 'l', 'o', '!' };
+				buffer.Write(std::as_bytes(std::span(packet)));
+
+				std::vector<std::span<const std::byte>> segments;
+				buffer.GetReadBuffers(segments);
+				Assert::AreEqual((size_t)2, segments.size());
+
+				auto result = PacketFramer::TryFrameView(segments, 0);
+				Assert::IsTrue(result.Result == PacketFrameResult::Ok);
+				Assert::AreEqual((size_t)10, result.FrameSize);
+
+				const auto& view = result.ViewOpt.value();
+				Assert::AreEqual((int)1001, (int)view.GetPacketId());
+				Assert::AreEqual((size_t)6, view.GetPayloadSize());
+				Assert::AreEqual(paddingSize == 13, view.IsContiguous());
+
+				std::array<char, 6> payload{};
+				Assert::IsTrue(view.CopyPayloadTo(std::as_writable_bytes(std::span(payload))));
+				Assert::AreEqual(std::string("Hello!"), std::string(payload.data(), payload.size()));
+
+				// ToOwned 는 동일 ID/Payload 의 소유 Packet 을 만든다
+				auto owned = view.ToOwned();
+				Assert::AreEqual((int)1001, (int)owned.GetPacketId());
+				Assert::AreEqual((int)6, (int)owned.GetPayloadSize());
+				Assert::AreEqual((size_t)10, owned.GetPacketSize());
+			}
+		}
+
+		// 잘못된 크기 / 불완전 패킷에 대한 TryFrameView 결과 확인
+		TEST_METHOD(FrameView_InvalidAndNeedMore)
+		{
+			CircleBufferQueue buffer(64);
+			std::vector<std::span<const std::byte>> segments;
+
+			// Size 3 (< 4) → Invalid
+			const std::array<uint8_t, 3> tooSmall = { 0x00, 0x03, 0x01 };
+			buffer.Write(std::as_bytes(std::span(tooSmall)));
+			buffer.GetReadBuffers(segments);
+			Assert::IsTrue(PacketFramer::TryFrameView(segments, 0).Result == PacketFrameResult::Invalid);
+			buffer.Clear();
+
+			// Size 10 인데 7바이트만 존재 → NeedMore
+			const std::array<uint8_t, 7> partial = { 0x00, 0x0A, 0x03, 0xE9, '1', '2', '3' };
+			buffer.Write(std::as_bytes(std::span(partial)));
+			buffer.GetReadBuffers(segments);
+			Assert::IsTrue(PacketFramer::TryFrameView(segments, 0).Result == PacketFrameResult::NeedMore);
+
+			// 1바이트 헤더 → NeedMore
+			Assert::IsTrue(PacketFramer::TryFrameView(segments, 6).Result == PacketFrameResult::NeedMore);
+		}
 	};
 }
@@ -0,0 +1,127 @@
+﻿// PacketParseBenchmarkTests.cpp
+// -----------------------------------------------------------------------------
+// 수신 링버퍼 → protobuf 파싱 경로 비교 (4K / 8K / 16K payload).
+//   Legacy : TryFrameFromBuffer(Pop → vector → Packet string 복사) + ParseFromString
+//   View   : GetReadBuffers + TryFrameView + SpanInputStream 파싱 + Consume
+// 링버퍼 용량을 프레임 크기의 정수배가 아니게 잡아 Wrap 지점 분할이 주기적으로 발생.
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <WinSock2.h>
+
+#include <Protocols/Benchmark.pb.h>
+
+#pragma comment(lib, "ws2_32.lib")
+
+import std;
+import networks.core.packet;
+import networks.core.packet_view;
+import networks.core.packet_framer;
+import commons.buffers.circle_buffer_queue;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibNetworks::Core;
+using namespace LibCommons::Buffers;
+
+namespace LibNetworksTests
+{
+
+namespace
+{
+constexpr uint16_t kBenchmarkPacketId = 0x1001;
+constexpr int kIterations = 20000;
+
+std::vector<std::byte> MakeFrame(size_t payloadSize)
+{
+    ::fastport::protocols::benchmark::BenchmarkRequest request;
+    request.mutable_header()->set_request_id(1);
+    request.set_client_timestamp_ns(1);
+    request.set_sequence(1);
+    request.set_payload(std::string(payloadSize, 'p'));
+
+    const std::string body = request.SerializeAsString();
+    const uint16_t sizeNet = htons(static_cast<uint16_t>(body.size() + Packet::GetHeaderSize() + Packet::GetPacketIdSize()));
+    const uint16_t idNet = htons(kBenchmarkPacketId);
+
+    std::vector<std::byte> frame(body.size() + Packet::GetHeaderSize() + Packet::GetPacketIdSize());
+    std::memcpy(frame.data(), &sizeNet, sizeof(sizeNet));
+    std::memcpy(frame.data() + sizeof(sizeNet), &idNet, sizeof(idNet));
+    std::memcpy(frame.data() + sizeof(sizeNet) + sizeof(idNet), body.data(), body.size());
+    return frame;
+}
+
+double RunLegacy(const std::vector<std::byte>& frame)
+{
+    CircleBufferQueue buffer(frame.size() * 3 / 2 + 7);
+    ::fastport::protocols::benchmark::BenchmarkRequest request;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i)
+    {
+        buffer.Write(frame);
+        auto result = PacketFramer::TryFrameFromBuffer(buffer);
+        result.PacketOpt->ParseMessage(request);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    return elapsed.count();
+}
+
+double RunView(const std::vector<std::byte>& frame)
+{
+    CircleBufferQueue buffer(frame.size() * 3 / 2 + 7);
+    ::fastport::protocols::benchmark::BenchmarkRequest request;
+    std::vector<std::span<const std::byte>> segments;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i)
+    {
+        buffer.Write(frame);
+        buffer.GetReadBuffers(segments);
+        auto result = PacketFramer::TryFrameView(segments, 0);
+        result.ViewOpt->ParseMessage(request);
+        buffer.Consume(result.FrameSize);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    return elapsed.count();
+}
+
+void Report(size_t payloadSize)
+{
+    const auto frame = MakeFrame(payloadSize);
+    const double legacyMs = RunLegacy(frame);
+    const double viewMs = RunView(frame);
+
+    std::string msg = std::format("Payload {} bytes x {} : Legacy {:.3f} ms, View {:.3f} ms",
+        payloadSize, kIterations, legacyMs, viewMs);
+    Logger::WriteMessage(msg.c_str());
+}
+}
+
+TEST_CLASS(PacketParseBenchmarkTests)
+{
+public:
+    TEST_METHOD(Benchmark_Parse_4K)
+    {
+        Report(4 * 1024);
+    }
+
+    TEST_METHOD(Benchmark_Parse_8K)
+    {
+        Report(8 * 1024);
+    }
+
+    TEST_METHOD(Benchmark_Parse_16K)
+    {
+        Report(16 * 1024);
+    }
+};
+
+} // namespace LibNetworksTests
@@ -0,0 +1,132 @@
+﻿// SendFlushBatchTests.cpp
+// -----------------------------------------------------------------------------
+// 송신 corking / 지연 flush 검증.
+// - SendFlushBatch : 워커 스레드(thread_local) 활성 여부, deadline 기반 FlushExpired, 배치 종료 FlushAll
+// - SendBatch      : Cork/Uncork RAII 중첩
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <WinSock2.h>
+#include <memory>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <google/protobuf/message.h>
+
+import networks.core.send_flush_batch;
+import networks.sessions.inetwork_session;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibNetworks::Core;
+
+namespace LibNetworksTests
+{
+
+namespace
+{
+struct CountingFlushTarget : public IDeferredSendFlush
+{
+    std::atomic<int> FlushCount { 0 };
+
+    void FlushDeferredSend() override { FlushCount.fetch_add(1); }
+};
+
+// Cork depth 를 기록하는 최소 세션. 실제 IOSession 의 보류 / gather-send 는 IOSessionCorkTests 에서 검증.
+struct CorkTrackingSession : public LibNetworks::Sessions::INetworkSession
+{
+    int Depth = 0;
+    int FlushCount = 0;
+
+    void SendMessage(const uint16_t, const google::protobuf::Message&) override {}
+    uint64_t GetSessionId() const override { return 1; }
+    void OnAccepted() override {}
+    void OnConnected() override {}
+    void OnDisconnected() override {}
+
+    void Cork() override { ++Depth; }
+    void Uncork() override
+    {
+        if (--Depth == 0)
+        {
+            ++FlushCount;
+        }
+    }
+};
+}
+
+TEST_CLASS(SendFlushBatchTests)
+{
+public:
+
+    // SFB-01: 활성 배치가 없는 스레드에서는 Defer 불가 → 호출자가 즉시 flush.
+    TEST_METHOD(Defer_WithoutScope_ReturnsFalse)
+    {
+        auto pTarget = std::make_shared<CountingFlushTarget>();
+
+        Assert::IsFalse(SendFlushBatch::IsActive());
+        Assert::IsFalse(SendFlushBatch::Defer(pTarget, SendFlushBatch::Clock::now()));
+        Assert::IsFalse(SendFlushBatch::HasPending());
+        Assert::AreEqual(0, pTarget->FlushCount.load());
+    }
+
+    // SFB-02: FlushExpired 는 deadline 이 지난 대상만, FlushAll 은 나머지를 모두 flush.
+    TEST_METHOD(FlushExpired_RespectsDeadline)
+    {
+        auto pExpired = std::make_shared<CountingFlushTarget>();
+        auto pLater = std::make_shared<CountingFlushTarget>();
+
+        SendFlushBatchScope scope;
+        const auto now = SendFlushBatch::Clock::now();
+        Assert::IsTrue(SendFlushBatch::Defer(pExpired, now));
+        Assert::IsTrue(SendFlushBatch::Defer(pLater, now + std::chrono::hours(1)));
+
+        SendFlushBatch::FlushExpired(now);
+        Assert::AreEqual(1, pExpired->FlushCount.load());
+        Assert::AreEqual(0, pLater->FlushCount.load());
+        Assert::IsTrue(SendFlushBatch::HasPending());
+
+        SendFlushBatch::FlushAll();
+        Assert::AreEqual(1, pLater->FlushCount.load());
+        Assert::IsFalse(SendFlushBatch::HasPending());
+    }
+
+    // SFB-03: 스코프 종료 시 남은 대상 flush, 스레드 간 목록은 독립.
+    TEST_METHOD(Scope_FlushesOnExit_ThreadLocal)
+    {
+        auto pTarget = std::make_shared<CountingFlushTarget>();
+        {
+            SendFlushBatchScope scope;
+            Assert::IsTrue(SendFlushBatch::Defer(pTarget, SendFlushBatch::Clock::now() + std::chrono::hours(1)));
+
+            bool bOtherThreadActive = true;
+            std::thread other([&bOtherThreadActive]() { bOtherThreadActive = SendFlushBatch::IsActive(); });
+            other.join();
+            Assert::IsFalse(bOtherThreadActive);
+
+            Assert::AreEqual(0, pTarget->FlushCount.load());
+        }
+
+        Assert::AreEqual(1, pTarget->FlushCount.load());
+        Assert::IsFalse(SendFlushBatch::IsActive());
+    }
+
+    // SFB-04: SendBatch 중첩 시 가장 바깥 스코프 종료에서만 flush.
+    TEST_METHOD(SendBatch_Nested_FlushesOnce)
+    {
+        CorkTrackingSession session;
+        {
+            LibNetworks::Sessions::SendBatch outer(session);
+            {
+                LibNetworks::Sessions::SendBatch inner(session);
+                Assert::AreEqual(2, session.Depth);
+            }
+            Assert::AreEqual(0, session.FlushCount);
+        }
+
+        Assert::AreEqual(0, session.Depth);
+        Assert::AreEqual(1, session.FlushCount);
+    }
+};
+
+} // namespace LibNetworksTests
@@ -15,6 +15,7 @@
 import networks.stats.server_stats_collector;
 import networks.stats.stats_sampler;
 import networks.sessions.isession_stats;
+import networks.core.completion_batch_stats;
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace std::chrono_literals;
@@ -28,9 +29,11 @@ struct MockSessionStats : public LibNetworks::Sessions::ISessionStats
 {
     std::uint64_t rx = 0;
     std::uint64_t tx = 0;
+    std::uint64_t bufferBytes = 0;
 
     std::uint64_t GetTotalRxBytes() const noexcept override { return rx; }
     std::uint64_t GetTotalTxBytes() const noexcept override { return tx; }
+    std::uint64_t GetBufferBytes() const noexcept override { return bufferBytes; }
 };
 
 
@@ -137,6 +140,46 @@ public:
         Assert::AreEqual<std::uint64_t>(0ULL, summary.processMemoryBytes);
     }
 
+    // 완료 배치 히스토그램은 CompletionBatchStats 스냅샷을 그대로 싣는다.
+    TEST_METHOD(Summary_CompletionBatchHistogram)
+    {
+        LibNetworks::Core::CompletionBatchStats::Reset();
+        LibNetworks::Core::CompletionBatchStats::Record(1);
+        LibNetworks::Core::CompletionBatchStats::Record(16);
+
+        LibNetworks::Stats::ServerStatsCollector collector(
+            LibNetworks::Stats::ServerMode::IOCP,
+            []() { return std::vector<std::shared_ptr<LibNetworks::Sessions::ISessionStats>>{}; },
+            nullptr,
+            /*pSampler=*/nullptr);
+
+        const auto summary = collector.SnapshotSummary();
+        Assert::AreEqual<std::uint64_t>(2ULL, summary.completionBatches.BatchCount);
+        Assert::AreEqual<std::uint64_t>(17ULL, summary.completionBatches.CompletionCount);
+        Assert::AreEqual<std::uint64_t>(1ULL, summary.completionBatches.Buckets[0]);
+        Assert::AreEqual<std::uint64_t>(1ULL, summary.completionBatches.Buckets[4]);
+
+        LibNetworks::Core::CompletionBatchStats::Reset();
+    }
+
+    // 세션 버퍼 상주 바이트 합과 세션당 평균 (유휴 세션 0 포함).
+    TEST_METHOD(Summary_SessionBufferBytes)
+    {
+        auto mocks = MakeMocks(4);
+        static_cast<MockSessionStats*>(mocks[0].get())->bufferBytes = 64 * 1024;
+        static_cast<MockSessionStats*>(mocks[1].get())->bufferBytes = 128 * 1024;
+
+        LibNetworks::Stats::ServerStatsCollector collector(
+            LibNetworks::Stats::ServerMode::IOCP,
+            [mocks]() { return mocks; },
+            nullptr,
+            /*pSampler=*/nullptr);
+
+        const auto summary = collector.SnapshotSummary();
+        Assert::AreEqual<std::uint64_t>(192ULL * 1024, summary.sessionBufferBytes);
+        Assert::AreEqual<std::uint64_t>(48ULL * 1024, summary.bytesPerSession);
+    }
+
     // SC-06: 5 sessions, offset=1, limit=2 → sessions=2개, total=5.
     TEST_METHOD(SessionList_OffsetLimit_Paging)
     {
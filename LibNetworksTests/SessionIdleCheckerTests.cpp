@@ -7,7 +7,7 @@ import commons.logger;
 import commons.timer_queue;
 import std;
 
-// Design Ref: session-idle-timeout §8.3 — SessionIdleChecker 단위 테스트 (I-01 ~ I-08).
+// Design Ref: session-idle-timeout §8.3 — SessionIdleChecker 단위 테스트 (I-01 ~ I-10).
 // Mock IIdleAware 로 IdleChecker 격리. TimerQueue 는 실제 인스턴스(싱글톤) 사용.
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -329,6 +329,73 @@ public:
         Assert::IsTrue(normalMock->disconnectCount.load() >= 1,
             L"한 세션의 예외가 다른 세션 처리를 막으면 안 됨");
     }
+
+    // I-09: deadline 추적 모드 — stale 세션은 threshold + tick 이내 1회만 disconnect, 활성 세션은 유지.
+    TEST_METHOD(Track_StaleAndFreshSessions_DisconnectsOnlyStaleOnce)
+    {
+        auto staleMock = std::make_shared<MockIdleAware>();
+        auto freshMock = std::make_shared<MockIdleAware>();
+        staleMock->lastRecvMs.store(NowMs());
+        freshMock->lastRecvMs.store(NowMs());
+
+        LibNetworks::Sessions::IdleCheckerConfig cfg;
+        cfg.thresholdMs    = 200ms;
+        cfg.tickIntervalMs = 50ms;
+
+        LibNetworks::Sessions::SessionIdleChecker checker(cfg);
+        checker.Start();
+        checker.Track(staleMock);
+        checker.Track(freshMock);
+
+        std::atomic<bool> running { true };
+        std::thread trafficThread([&]() {
+            while (running.load()) {
+                freshMock->lastRecvMs.store(NowMs());
+                std::this_thread::sleep_for(30ms);
+            }
+        });
+
+        std::this_thread::sleep_for(700ms);
+        checker.Stop();
+
+        running.store(false);
+        trafficThread.join();
+
+        Assert::AreEqual(1, staleMock->disconnectCount.load(),
+            L"deadline 모드는 disconnect 한 세션을 추적에서 빼므로 1회만 요청");
+        Assert::AreEqual(0, freshMock->disconnectCount.load(),
+            L"수신이 갱신되는 세션은 재등록만 되고 disconnect 되면 안 됨");
+        Assert::AreEqual(std::uint64_t{ 1 }, checker.GetDisconnectCount());
+        Assert::AreEqual(std::size_t{ 1 }, checker.GetTrackedCount(), L"활성 세션만 남아야 함");
+    }
+
+    // I-10: deadline 추적 모드 — 수신 이력 없는 세션은 skip, 해제된 세션은 deadline 도래 시 추적 종료.
+    TEST_METHOD(Track_NoRecvAndReleasedSessions_NotDisconnected)
+    {
+        auto noRecvMock = std::make_shared<MockIdleAware>();   // lastRecv == 0
+        auto releasedMock = std::make_shared<MockIdleAware>();
+        releasedMock->lastRecvMs.store(NowMs());
+
+        LibNetworks::Sessions::IdleCheckerConfig cfg;
+        cfg.thresholdMs    = 100ms;
+        cfg.tickIntervalMs = 50ms;
+
+        LibNetworks::Sessions::SessionIdleChecker checker(cfg);
+        checker.Start();
+        checker.Track(noRecvMock);
+        checker.Track(releasedMock);
+
+        std::weak_ptr<MockIdleAware> releasedWeak = releasedMock;
+        releasedMock.reset();
+
+        std::this_thread::sleep_for(400ms);
+        checker.Stop();
+
+        Assert::AreEqual(0, noRecvMock->disconnectCount.load(), L"last==0 세션은 skip");
+        Assert::IsTrue(releasedWeak.expired(), L"checker 가 세션 수명을 연장하면 안 됨");
+        Assert::AreEqual(std::uint64_t{ 0 }, checker.GetDisconnectCount());
+        Assert::AreEqual(std::size_t{ 1 }, checker.GetTrackedCount(), L"해제된 세션은 추적에서 빠져야 함");
+    }
 };
 
 } // namespace LibNetworksTests
@@ -0,0 +1,162 @@
+﻿// SessionPoolTests.cpp
+// -----------------------------------------------------------------------------
+// SessionPool 단위 테스트 (SP-01 ~ SP-05).
+// 실제 소켓 I/O 없이 IOSession 서브클래스로 반환 / 재사용 / 폐기 경로와 hit/miss 카운터를 검증.
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <WinSock2.h>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+import networks.sessions.io_session;
+import networks.sessions.session_pool;
+import networks.core.socket;
+import networks.core.io_operation;
+import commons.buffers.circle_buffer_queue;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace LibNetworksTests
+{
+
+namespace
+{
+class PooledTestSession : public LibNetworks::Sessions::IOSession
+{
+public:
+    using LibNetworks::Sessions::IOSession::IOSession;
+
+    // Real Recv 완료를 시뮬레이트 — 누적 Rx / 수신 버퍼 상태를 더럽힌다.
+    void SimulateRealRecvSuccess(std::size_t bytes)
+    {
+        DebugSetOutstandingIoCountForTest(DebugGetOutstandingIoCountForTest() + 1);
+        m_RecvOperation.IsZeroByte = false;
+        this->OnIOCompleted(LibNetworks::Core::IoCompletion{ &m_RecvOperation, true, bytes });
+    }
+
+    void SetOutstandingIoCountForTest(int outstanding) noexcept
+    {
+        DebugSetOutstandingIoCountForTest(outstanding);
+    }
+
+    bool IsDisconnectRequestedForTest() const noexcept
+    {
+        return IsDisconnectRequested();
+    }
+};
+
+using TestSessionPool = LibNetworks::Sessions::SessionPool<PooledTestSession>;
+
+std::unique_ptr<PooledTestSession> CreatePooledSession()
+{
+    return std::make_unique<PooledTestSession>(std::make_shared<LibNetworks::Core::Socket>(),
+        std::make_unique<LibCommons::Buffers::CircleBufferQueue>(8 * 1024),
+        std::make_unique<LibCommons::Buffers::CircleBufferQueue>(8 * 1024));
+}
+
+std::shared_ptr<PooledTestSession> AcquireFrom(TestSessionPool& rfPool, std::shared_ptr<LibNetworks::Core::Socket> pSocket = std::make_shared<LibNetworks::Core::Socket>())
+{
+    return rfPool.Acquire(
+        []() { return CreatePooledSession(); },
+        [&pSocket](PooledTestSession& rfSession) { rfSession.ResetForReuse(pSocket); });
+}
+} // anonymous namespace
+
+
+TEST_CLASS(SessionPoolTests)
+{
+public:
+
+    // SP-01: 첫 Acquire 는 miss, 반환 후 Acquire 는 같은 객체를 hit 로 재사용.
+    TEST_METHOD(Acquire_AfterRelease_ReusesSameObject)
+    {
+        auto pPool = TestSessionPool::Create(4);
+
+        auto pFirst = AcquireFrom(*pPool);
+        auto* pRaw = pFirst.get();
+        pFirst.reset();
+
+        auto pSecond = AcquireFrom(*pPool);
+
+        Assert::IsTrue(pRaw == pSecond.get(), L"반환된 세션 객체가 재사용되어야 함");
+
+        const auto stats = pPool->GetStats();
+        Assert::AreEqual<std::uint64_t>(1ULL, stats.Misses);
+        Assert::AreEqual<std::uint64_t>(1ULL, stats.Hits);
+        Assert::AreEqual<std::uint64_t>(1ULL, stats.Recycled);
+        Assert::AreEqual<std::size_t>(0, stats.Idle);
+    }
+
+    // SP-02: 재사용된 세션은 새 세션 id 를 받고 종료 상태 / 누적 카운터가 초기화된다.
+    TEST_METHOD(ResetForReuse_ClearsSessionState)
+    {
+        auto pPool = TestSessionPool::Create(4);
+
+        auto pFirst = AcquireFrom(*pPool);
+        const auto firstId = pFirst->GetSessionId();
+        pFirst->SimulateRealRecvSuccess(256);
+        pFirst->RequestDisconnect(LibNetworks::Sessions::DisconnectReason::Server);
+        Assert::IsTrue(pFirst->IsDisconnectRequestedForTest());
+        pFirst.reset();
+
+        auto pSecond = AcquireFrom(*pPool);
+
+        Assert::AreNotEqual(firstId, pSecond->GetSessionId(), L"재사용 세션은 새 id 를 받아야 함");
+        Assert::IsFalse(pSecond->IsDisconnectRequestedForTest(), L"종료 요청 상태가 초기화되어야 함");
+        Assert::AreEqual<std::uint64_t>(0ULL, pSecond->GetTotalRxBytes());
+        Assert::AreEqual<std::int64_t>(0, pSecond->GetLastRecvTimeMs());
+    }
+
+    // SP-03: outstanding I/O 가 남은 세션은 풀로 돌아가지 않고 폐기된다.
+    TEST_METHOD(Release_WithOutstandingIo_Discards)
+    {
+        auto pPool = TestSessionPool::Create(4);
+
+        auto pSession = AcquireFrom(*pPool);
+        pSession->SetOutstandingIoCountForTest(1);
+        // 실제 서버에서는 발생하지 않는 상태 — 폐기 시 소멸자가 불변식 위반 로그를 남긴다.
+        pSession.reset();
+
+        const auto stats = pPool->GetStats();
+        Assert::AreEqual<std::uint64_t>(1ULL, stats.Discarded);
+        Assert::AreEqual<std::uint64_t>(0ULL, stats.Recycled);
+        Assert::AreEqual<std::size_t>(0, stats.Idle);
+    }
+
+    // SP-04: free list 가 maxIdle 에 도달하면 초과분은 폐기.
+    TEST_METHOD(Release_BeyondMaxIdle_Discards)
+    {
+        auto pPool = TestSessionPool::Create(2);
+
+        {
+            std::vector<std::shared_ptr<PooledTestSession>> sessions;
+            for (int i = 0; i < 3; ++i)
+            {
+                sessions.push_back(AcquireFrom(*pPool));
+            }
+        }
+
+        const auto stats = pPool->GetStats();
+        Assert::AreEqual<std::uint64_t>(3ULL, stats.Misses);
+        Assert::AreEqual<std::uint64_t>(2ULL, stats.Recycled);
+        Assert::AreEqual<std::uint64_t>(1ULL, stats.Discarded);
+        Assert::AreEqual<std::size_t>(2, stats.Idle);
+    }
+
+    // SP-05: 풀이 먼저 소멸해도 살아 있던 세션은 마지막 참조 해제 시 정상 delete.
+    TEST_METHOD(Release_AfterPoolDestroyed_DeletesSession)
+    {
+        auto pPool = TestSessionPool::Create(4);
+        auto pSession = AcquireFrom(*pPool);
+        std::weak_ptr<PooledTestSession> wpSession = pSession;
+
+        pPool.reset();
+        pSession.reset();
+
+        Assert::IsTrue(wpSession.expired());
+    }
+};
+
+} // namespace LibNetworksTests
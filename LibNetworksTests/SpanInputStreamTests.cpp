@@ -0,0 +1,129 @@
+﻿// SpanInputStreamTests.cpp
+// -----------------------------------------------------------------------------
+// SpanInputStream(ZeroCopyInputStream 어댑터) 동작 검증.
+// - segment 순회 / BackUp / Skip / ByteCount 계약
+// - Wrap 지점에 걸친 PacketView 에서 protobuf 메시지 직접 파싱
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <Protocols/Benchmark.pb.h>
+
+import std;
+import networks.core.span_input_stream;
+import networks.core.packet_view;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibNetworks::Core;
+
+namespace LibNetworksTests
+{
+
+namespace
+{
+std::span<const std::byte> AsBytes(const std::string& s)
+{
+    return std::as_bytes(std::span(s.data(), s.size()));
+}
+}
+
+TEST_CLASS(SpanInputStreamTests)
+{
+public:
+
+    // SIS-01: segment 를 순서대로 복사 없이 반환하고 끝에서 false.
+    TEST_METHOD(Next_IteratesSegmentsWithoutCopy)
+    {
+        const std::string first = "ABC";
+        const std::string second = "DEFGH";
+        const std::array<std::span<const std::byte>, 2> segments = { AsBytes(first), AsBytes(second) };
+
+        SpanInputStream stream(segments);
+
+        const void* pData = nullptr;
+        int size = 0;
+
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::AreEqual(3, size);
+        Assert::IsTrue(pData == first.data());
+
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::AreEqual(5, size);
+        Assert::IsTrue(pData == second.data());
+
+        Assert::IsFalse(stream.Next(&pData, &size));
+        Assert::AreEqual((std::int64_t)8, stream.ByteCount());
+    }
+
+    // SIS-02: BackUp 후 Next 는 되돌린 바이트부터 다시 반환.
+    TEST_METHOD(BackUp_ReturnsRemainderOnNext)
+    {
+        const std::string first = "ABCDEF";
+        const std::array<std::span<const std::byte>, 1> segments = { AsBytes(first) };
+
+        SpanInputStream stream(segments);
+
+        const void* pData = nullptr;
+        int size = 0;
+        Assert::IsTrue(stream.Next(&pData, &size));
+        stream.BackUp(2);
+        Assert::AreEqual((std::int64_t)4, stream.ByteCount());
+
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::AreEqual(2, size);
+        Assert::AreEqual(std::string("EF"), std::string(static_cast<const char*>(pData), size));
+    }
+
+    // SIS-03: Skip 은 segment 경계를 넘어 이동, 범위 초과 시 false.
+    TEST_METHOD(Skip_CrossesSegmentBoundary)
+    {
+        const std::string first = "ABC";
+        const std::string second = "DEFGH";
+        const std::array<std::span<const std::byte>, 2> segments = { AsBytes(first), AsBytes(second) };
+
+        SpanInputStream stream(segments);
+        Assert::IsTrue(stream.Skip(4));
+        Assert::AreEqual((std::int64_t)4, stream.ByteCount());
+
+        const void* pData = nullptr;
+        int size = 0;
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::AreEqual(std::string("EFGH"), std::string(static_cast<const char*>(pData), size));
+
+        SpanInputStream overflow(segments);
+        Assert::IsFalse(overflow.Skip(9));
+        Assert::AreEqual((std::int64_t)8, overflow.ByteCount());
+    }
+
+    // SIS-04: Wrap 지점에서 임의 위치로 분할된 직렬화 결과를 PacketView 로 파싱해도 동일.
+    TEST_METHOD(PacketView_ParseMessage_AcrossSplitSegments)
+    {
+        ::fastport::protocols::benchmark::BenchmarkRequest src;
+        src.mutable_header()->set_request_id(77);
+        src.set_client_timestamp_ns(123456789ULL);
+        src.set_sequence(9);
+        src.set_payload(std::string(4096, 'x'));
+
+        std::string wire;
+        Assert::IsTrue(src.SerializeToString(&wire));
+
+        for (const size_t splitAt : { (size_t)1, (size_t)7, wire.size() / 2, wire.size() - 1 })
+        {
+            const auto bytes = AsBytes(wire);
+            PacketView view(0x1001, bytes.subspan(0, splitAt), bytes.subspan(splitAt));
+            Assert::IsFalse(view.IsContiguous());
+
+            ::fastport::protocols::benchmark::BenchmarkRequest dst;
+            Assert::IsTrue(view.ParseMessage(dst));
+            Assert::AreEqual((std::uint64_t)77, (std::uint64_t)dst.header().request_id());
+            Assert::AreEqual((std::uint64_t)123456789ULL, (std::uint64_t)dst.client_timestamp_ns());
+            Assert::AreEqual((std::uint32_t)9, (std::uint32_t)dst.sequence());
+            Assert::AreEqual(src.payload(), dst.payload());
+        }
+    }
+};
+
+} // namespace LibNetworksTests
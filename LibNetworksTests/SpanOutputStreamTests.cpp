@@ -0,0 +1,118 @@
+﻿// SpanOutputStreamTests.cpp
+// -----------------------------------------------------------------------------
+// SpanOutputStream(ZeroCopyOutputStream 어댑터) 및 SerializePacketToSpans 검증.
+// - segment 순회 / BackUp / WriteRaw 계약
+// - 링버퍼 Wrap 지점에 예약된 영역으로 직접 직렬화 → 프레이밍/파싱 라운드트립
+// -----------------------------------------------------------------------------
+#include "CppUnitTest.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <Protocols/Benchmark.pb.h>
+
+import std;
+import networks.core.span_output_stream;
+import networks.core.packet_view;
+import networks.core.packet_framer;
+import commons.buffers.circle_buffer_queue;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace LibNetworks::Core;
+using namespace LibCommons::Buffers;
+
+namespace LibNetworksTests
+{
+
+TEST_CLASS(SpanOutputStreamTests)
+{
+public:
+
+    // SOS-01: Next 는 segment 를 순서대로 반환, BackUp 은 직전 chunk 범위만 되돌림.
+    TEST_METHOD(Next_BackUp_ByteCount)
+    {
+        std::array<std::byte, 3> first{};
+        std::array<std::byte, 5> second{};
+        const std::array<std::span<std::byte>, 2> segments = { std::span(first), std::span(second) };
+
+        SpanOutputStream stream(segments);
+
+        void* pData = nullptr;
+        int size = 0;
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::IsTrue(pData == first.data());
+        Assert::AreEqual(3, size);
+
+        stream.BackUp(1);
+        Assert::AreEqual((std::int64_t)2, stream.ByteCount());
+
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::IsTrue(pData == first.data() + 2);
+        Assert::AreEqual(1, size);
+
+        Assert::IsTrue(stream.Next(&pData, &size));
+        Assert::IsTrue(pData == second.data());
+        Assert::AreEqual(5, size);
+
+        Assert::IsFalse(stream.Next(&pData, &size));
+        Assert::AreEqual((std::int64_t)8, stream.ByteCount());
+    }
+
+    // SOS-02: WriteRaw 는 segment 경계를 넘어 기록하고, 예약 영역 초과 시 false.
+    TEST_METHOD(WriteRaw_CrossesBoundary)
+    {
+        std::array<char, 3> first{};
+        std::array<char, 2> second{};
+        const std::array<std::span<std::byte>, 2> segments = {
+            std::as_writable_bytes(std::span(first)), std::as_writable_bytes(std::span(second)) };
+
+        SpanOutputStream stream(segments);
+        Assert::IsTrue(stream.WriteRaw("ABCD", 4));
+        Assert::AreEqual(std::string("ABC"), std::string(first.data(), first.size()));
+        Assert::AreEqual('D', second[0]);
+
+        Assert::IsFalse(stream.WriteRaw("XY", 2));
+    }
+
+    // SOS-03: 링버퍼 Wrap 지점에 걸친 예약 영역에 직접 직렬화한 패킷이 그대로 프레이밍/파싱됨.
+    TEST_METHOD(SerializePacketToSpans_WrapAround_Roundtrip)
+    {
+        ::fastport::protocols::benchmark::BenchmarkRequest src;
+        src.mutable_header()->set_request_id(5);
+        src.set_sequence(42);
+        src.set_payload(std::string(1000, 'z'));
+
+        const size_t bodySize = src.ByteSizeLong();
+        const size_t totalSize = bodySize + 4;
+
+        for (const size_t paddingSize : { (size_t)0, (size_t)1, (size_t)2, (size_t)3, (size_t)500, (size_t)1020 })
+        {
+            CircleBufferQueue buffer(1024 + 16);
+
+            // Head 를 앞으로 이동시켜 예약 영역이 Wrap 지점에 걸치도록 함
+            std::vector<std::byte> padding(paddingSize + 16);
+            buffer.Write(padding);
+            buffer.Consume(padding.size());
+
+            std::vector<std::span<std::byte>> reserved;
+            Assert::IsTrue(buffer.AllocateWrite(totalSize, reserved));
+            Assert::IsTrue(SerializePacketToSpans(reserved, 0x1001, src, bodySize));
+
+            std::vector<std::span<const std::byte>> segments;
+            buffer.GetReadBuffers(segments);
+
+            auto frame = PacketFramer::TryFrameView(segments, 0);
+            Assert::IsTrue(frame.Result == PacketFrameResult::Ok);
+            Assert::AreEqual(totalSize, frame.FrameSize);
+            Assert::AreEqual((int)0x1001, (int)frame.ViewOpt->GetPacketId());
+
+            ::fastport::protocols::benchmark::BenchmarkRequest dst;
+            Assert::IsTrue(frame.ViewOpt->ParseMessage(dst));
+            Assert::AreEqual((std::uint32_t)42, (std::uint32_t)dst.sequence());
+            Assert::AreEqual(src.payload(), dst.payload());
+        }
+    }
+};
+
+} // namespace LibNetworksTests